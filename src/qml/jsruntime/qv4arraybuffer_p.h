@@ -47,6 +47,10 @@ struct Q_QML_EXPORT SharedArrayBuffer : Object {
     bool hasSharedArrayData() const noexcept { return constArrayDataPointer().isShared(); }
     bool hasDetachedArrayData() const noexcept { return constArrayDataPointer().isNull(); }
     void detachArrayData() noexcept { arrayDataPointer().clear(); }
+    QByteArray takeArrayData() noexcept
+    {
+        return QByteArray(std::exchange(arrayDataPointer(), QArrayDataPointer<char>()));
+    }
 
     bool arrayDataNeedsDetach() const noexcept { return constArrayDataPointer().needsDetach(); }
 
@@ -128,6 +132,8 @@ struct Q_QML_EXPORT ArrayBuffer : SharedArrayBuffer
     const char *constArrayData() const { return d()->constArrayData(); }
     bool hasSharedArrayData() { return d()->hasSharedArrayData(); }
     void detachArrayData() { d()->detachArrayData(); }
+    // Moves the contents out without copying, leaving this buffer detached
+    QByteArray takeArrayData() { return d()->takeArrayData(); }
 
     void detach();
 };
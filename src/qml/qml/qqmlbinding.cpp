@@ -614,6 +614,20 @@ QVariant QQmlBinding::evaluate()
 
 void QQmlBinding::expressionChanged()
 {
+    // While a property transaction is being committed, evaluate once after all writes.
+    if (Q_UNLIKELY(QQmlPropertyTransactionPrivate::activeCommits.loadRelaxed())
+            && QQmlPropertyTransactionPrivate::deferBindingUpdate(this)) {
+        return;
+    }
+
+    // If the target's bindings are parked, defer the evaluation until the
+    // property is read or the target is unparked.
+    if (QObject *target = targetObject(); target && enabledFlag()) {
+        QQmlData *data = QQmlData::get(target);
+        if (Q_UNLIKELY(data && data->bindingsParked) && data->parkBinding(target, this))
+            return;
+    }
+
     update();
 }
 
@@ -11,6 +11,7 @@
 #include <private/qqmldebugconnector_p.h>
 #include <private/qqmldebugserviceinterfaces_p.h>
 #include "qqmlinfo.h"
+#include "qqmlproperty_p.h"
 
 #include <private/qjsvalue_p.h>
 #include <private/qv4value_p.h>
@@ -298,6 +299,13 @@ void QQmlBoundSignal_callback(QQmlNotifierEndpoint *e, void **a)
     if (!s->m_expression || !s->m_enabled)
         return;
 
+    // While a property transaction is being committed, run once all values are final.
+    if (Q_UNLIKELY(QQmlPropertyTransactionPrivate::activeCommits.loadRelaxed())
+            && QQmlPropertyTransactionPrivate::deferSignalHandler(
+                    s->m_expression.data(), s->senderAsObject(), s->signalIndex(), a)) {
+        return;
+    }
+
     QV4DebugService *service = QQmlDebugConnector::service<QV4DebugService>();
     if (service)
         service->signalEmitted(QString::fromUtf8(QMetaObjectPrivate::signal(
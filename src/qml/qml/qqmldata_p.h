@@ -26,6 +26,8 @@
 #include <qjsengine.h>
 #include <qvector.h>
 
+#include <atomic>
+
 QT_BEGIN_NAMESPACE
 
 template <class Key, class T> class QHash;
@@ -107,7 +109,10 @@ public:
     quint32 hasVMEMetaObject:1;
     // If we have another wrapper for a const QObject * in the multiply wrapped QObjects.
     quint32 hasConstWrapper: 1;
-    quint32 dummy:7;
+    // set while the object's bindings are parked: change notifications only
+    // mark them as pending, and they are evaluated when read or unparked.
+    quint32 bindingsParked:1;
+    quint32 dummy:6;
 
     // When bindingBitsSize < sizeof(ptr), we store the binding bit flags inside
     // bindingBitsValue. When we need more than sizeof(ptr) bits, we allocated
@@ -125,6 +130,16 @@ public:
 
     struct NotifyList {
         QAtomicInteger<quint64> connectionMask;
+        // Property change signals emitted from other threads and not delivered yet.
+        // Indexed like connectionMask, but only signals below 63 are tracked.
+        QAtomicInteger<quint64> pendingThreadNotifyMask;
+        // Property change signals that may be coalesced when emitted from other threads.
+        // Only written on the object's thread, from the property cache below.
+        QAtomicInteger<quint64> coalescedThreadNotifyMask;
+        // Other signals emitted from other threads and not delivered yet. No signals are
+        // coalesced while there are any, so that they are delivered in emission order.
+        QAtomicInt queuedThreadSignalCount;
+        const QQmlPropertyCache *coalescedThreadNotifyCache = nullptr;
         QQmlNotifierEndpoint *todo = nullptr;
         QQmlNotifierEndpoint**notifies = nullptr;
         quint16 maximumTodoIndex = 0;
@@ -165,6 +180,13 @@ public:
     inline void setPendingBindingBit(QObject *obj, int);
     inline void clearPendingBindingBit(int);
 
+    static void setBindingsParked(QObject *object, bool parked);
+    bool parkBinding(QObject *object, const QQmlAbstractBinding *binding);
+    // Lets the owner of the parking policy exclude properties that must stay live,
+    // for example those the policy itself depends on. Set once, from any thread.
+    using BindingParkingFilter = bool (*)(QObject *object, int coreIndex);
+    static std::atomic<BindingParkingFilter> bindingParkingFilter;
+
     quint16 lineNumber = 0;
     quint16 columnNumber = 0;
 
@@ -5,6 +5,7 @@
 #include "qqmlengine.h"
 
 #include <private/qqmlabstractbinding_p.h>
+#include <private/qqmlbinding_p.h>
 #include <private/qqmlboundsignal_p.h>
 #include <private/qqmlcontext_p.h>
 #include <private/qqmlnotifier_p.h>
@@ -26,6 +27,7 @@
 #include <QtQml/qqmlincubator.h>
 #include <QtQml/qqmlscriptstring.h>
 
+#include <QtCore/qalgorithms.h>
 #include <QtCore/qcoreapplication.h>
 #include <QtCore/qcryptographichash.h>
 #include <QtCore/qdir.h>
@@ -35,6 +37,7 @@
 #include <QtCore/qstandardpaths.h>
 #include <QtCore/qstorageinfo.h>
 #include <QtCore/qthread.h>
+#include <QtCore/qvarlengtharray.h>
 
 #if QT_CONFIG(qml_network)
 #include <QtQml/qqmlnetworkaccessmanagerfactory.h>
@@ -246,7 +249,7 @@ void QQmlPrivate::qdeclarativeelement_destructor(QObject *o)
 QQmlData::QQmlData(Ownership ownership)
     : ownMemory(ownership == OwnsMemory), indestructible(true), explicitIndestructibleSet(false),
       hasTaintedV4Object(false), isQueuedForDeletion(false), rootObjectInCreation(false),
-      hasInterceptorMetaObject(false), hasVMEMetaObject(false), hasConstWrapper(false), dummy(0),
+      hasInterceptorMetaObject(false), hasVMEMetaObject(false), hasConstWrapper(false), bindingsParked(false), dummy(0),
       bindingBitsArraySize(InlineBindingArraySize)
 {
     memset(bindingBitsValue, 0, sizeof(bindingBitsValue));
@@ -269,6 +272,37 @@ class QQmlThreadNotifierProxyObject : public QObject
 public:
     QPointer<QObject> target;
 
+    static QEvent::Type coalescedNotifyEventType()
+    {
+        static const QEvent::Type type = QEvent::Type(QEvent::registerEventType());
+        return type;
+    }
+
+    bool event(QEvent *e) override
+    {
+        if (e->type() != coalescedNotifyEventType())
+            return QObject::event(e);
+
+        if (target) {
+            QQmlData *ddata = QQmlData::get(target, false);
+            QQmlData::NotifyList *list = ddata ? ddata->notifyList.loadRelaxed() : nullptr;
+
+            // Take all pending signals at once. Any emission from now on schedules a new event.
+            quint64 pending = list ? list->pendingThreadNotifyMask.fetchAndStoreAcquire(0) : 0;
+            while (pending && target) {
+                const int signalIndex = qCountTrailingZeroBits(pending);
+                pending &= pending - 1;
+                if (QQmlNotifierEndpoint *ep = ddata->notify(signalIndex)) {
+                    void *args[] = { nullptr };
+                    QQmlNotifier::emitNotify(ep, args);
+                }
+            }
+        }
+
+        delete this;
+        return true;
+    }
+
     int qt_metacall(QMetaObject::Call, int methodIndex, void **a) override {
         if (!target)
             return -1;
@@ -277,6 +311,8 @@ public:
         Q_ASSERT(method.methodType() == QMetaMethod::Signal);
         int signalIndex = QMetaObjectPrivate::signalIndex(method);
         QQmlData *ddata = QQmlData::get(target, false);
+        if (QQmlData::NotifyList *list = ddata->notifyList.loadRelaxed())
+            list->queuedThreadSignalCount.deref();
         QQmlNotifierEndpoint *ep = ddata->notify(signalIndex);
         if (ep) QQmlNotifier::emitNotify(ep, a);
 
@@ -286,6 +322,30 @@ public:
     }
 };
 
+/*!
+    \internal
+    Updates the mask of signals below 63 that are the notify signal of a property
+    of the object, and may therefore be coalesced when emitted from another thread.
+    This must happen on the object's thread, as the property cache may be replaced
+    there. A replacing cache extends the previous one, so the mask stays valid in
+    the meantime.
+*/
+static void updateCoalescedThreadNotifyMask(const QQmlPropertyCache *cache, QQmlData::NotifyList *list)
+{
+    if (!cache || cache == list->coalescedThreadNotifyCache)
+        return;
+
+    quint64 mask = 0;
+    for (int ii = 0, count = cache->propertyCount(); ii < count; ++ii) {
+        const QQmlPropertyData *property = cache->property(ii);
+        const int notifyIndex = property ? property->notifyIndex() : -1;
+        if (notifyIndex >= 0 && notifyIndex < 63)
+            mask |= quint64(1) << notifyIndex;
+    }
+    list->coalescedThreadNotifyCache = cache;
+    list->coalescedThreadNotifyMask.storeRelease(mask);
+}
+
 void QQmlData::signalEmitted(QAbstractDeclarativeData *, QObject *object, int index, void **a)
 {
     QQmlData *ddata = QQmlData::get(object, false);
@@ -309,6 +369,32 @@ void QQmlData::signalEmitted(QAbstractDeclarativeData *, QObject *object, int in
             return;
 
         QMetaMethod m = QMetaObjectPrivate::signal(object->metaObject(), index);
+
+        // Parameterless change signals of properties are coalesced. As long as a notification
+        // is pending for the object, repeated emissions only set a bit in the notify list,
+        // without taking locks or allocating anything. All pending change signals of an
+        // object are then delivered by a single event. Only the latest value of a property
+        // matters, so this is not observable. Any other signal is queued, so that each
+        // emission is delivered. While such a signal is queued, change signals are queued
+        // as well, so that no change signal is delivered ahead of a signal emitted before it.
+        QQmlData::NotifyList *list = ddata->notifyList.loadRelaxed();
+        if (index < 63 && m.parameterCount() == 0
+                && list->queuedThreadSignalCount.loadAcquire() == 0) {
+            const quint64 bit = quint64(1) << index;
+            if (list->coalescedThreadNotifyMask.loadAcquire() & bit) {
+                const quint64 pending = list->pendingThreadNotifyMask.fetchAndOrRelease(bit);
+                if (pending)
+                    return;
+
+                QQmlThreadNotifierProxyObject *mpo = new QQmlThreadNotifierProxyObject;
+                mpo->target = object;
+                mpo->moveToThread(objectThreadData->thread.loadAcquire());
+                QCoreApplication::postEvent(
+                        mpo, new QEvent(QQmlThreadNotifierProxyObject::coalescedNotifyEventType()));
+                return;
+            }
+        }
+
         QList<QByteArray> parameterTypes = m.parameterTypes();
 
         auto ev = std::make_unique<QMetaCallEvent>(m.methodIndex(), 0, nullptr,
@@ -335,6 +421,7 @@ void QQmlData::signalEmitted(QAbstractDeclarativeData *, QObject *object, int in
             args[ii + 1] = types[ii + 1].create(a[ii + 1]);
         }
 
+        list->queuedThreadSignalCount.ref();
         QQmlThreadNotifierProxyObject *mpo = new QQmlThreadNotifierProxyObject;
         mpo->target = object;
         mpo->moveToThread(objectThreadData->thread.loadAcquire());
@@ -419,9 +506,75 @@ void QQmlData::flushPendingBinding(int coreIndex)
         b = b->nextBinding();
 
     if (b && b->targetPropertyIndex().coreIndex() == coreIndex &&
-            !b->targetPropertyIndex().hasValueTypeIndex())
-        b->setEnabled(true, QQmlPropertyData::BypassInterceptor |
-                            QQmlPropertyData::DontRemoveBinding);
+            !b->targetPropertyIndex().hasValueTypeIndex()) {
+        const QQmlPropertyData::WriteFlags flags
+                = QQmlPropertyData::BypassInterceptor | QQmlPropertyData::DontRemoveBinding;
+        if (b->enabledFlag() && b->kind() == QQmlAbstractBinding::QmlBinding) {
+            // A parked binding. It's already enabled, but has missed some updates.
+            static_cast<QQmlBinding *>(b)->update(flags);
+        } else {
+            b->setEnabled(true, flags);
+        }
+    }
+}
+
+std::atomic<QQmlData::BindingParkingFilter> QQmlData::bindingParkingFilter = nullptr;
+
+/*!
+    \internal
+    Parks or unparks the bindings on \a object. While parked, bindings that would be
+    re-evaluated because of a change notification are only marked as pending. They are
+    evaluated when the property is read from QML, or when the object is unparked.
+ */
+void QQmlData::setBindingsParked(QObject *object, bool parked)
+{
+    QQmlData *data = QQmlData::get(object, parked);
+    if (!data || bool(data->bindingsParked) == parked)
+        return;
+
+    data->bindingsParked = parked;
+    QQmlInterceptorMetaObject::setBindingsParked(object, data->propertyCache, parked);
+    if (parked)
+        return;
+
+    QVarLengthArray<int, 16> pending;
+    for (QQmlAbstractBinding *b = data->bindings; b; b = b->nextBinding()) {
+        const QQmlPropertyIndex index = b->targetPropertyIndex();
+        if (!index.hasValueTypeIndex() && index.coreIndex() <= 0xffff
+                && data->hasPendingBindingBit(index.coreIndex())) {
+            pending.append(index.coreIndex());
+        }
+    }
+
+    for (int coreIndex : std::as_const(pending)) {
+        // Evaluating a binding may delete the object, or park it again.
+        if (QQmlData::wasDeleted(object) || data->bindingsParked)
+            return;
+        if (data->hasPendingBindingBit(coreIndex))
+            data->flushPendingBinding(coreIndex);
+    }
+}
+
+/*!
+    \internal
+    Marks \a binding as pending instead of evaluating it, if the bindings on \a object
+    are parked. Returns \c true if the binding was parked.
+ */
+bool QQmlData::parkBinding(QObject *object, const QQmlAbstractBinding *binding)
+{
+    Q_ASSERT(bindingsParked);
+    const QQmlPropertyIndex index = binding->targetPropertyIndex();
+
+    // Pending bits are only tracked per core index.
+    if (index.hasValueTypeIndex() || index.coreIndex() > 0xffff)
+        return false;
+
+    const BindingParkingFilter filter = bindingParkingFilter.load(std::memory_order_acquire);
+    if (filter && !filter(object, index.coreIndex()))
+        return false;
+
+    setPendingBindingBit(object, index.coreIndex());
+    return true;
 }
 
 QQmlData::DeferredData::DeferredData() = default;
@@ -1274,6 +1427,8 @@ void QQmlData::addNotify(int index, QQmlNotifierEndpoint *endpoint)
 
     Q_ASSERT(!endpoint->isConnected());
 
+    updateCoalescedThreadNotifyMask(propertyCache.data(), list);
+
     index = qMin(index, 0xFFFF - 1);
 
     // Likewise, we don't really care _when_ the change in the connectionMask is propagated to other
@@ -123,6 +123,17 @@ public:
     QQmlError error(QQmlEngine *) const;
     void clearError();
     void clearActiveGuards();
+    // Returns whether \a predicate holds for the sender and signal index of any
+    // notifier the expression currently depends on.
+    template<typename Predicate>
+    bool anyActiveGuard(Predicate predicate) const
+    {
+        for (QQmlJavaScriptExpressionGuard *g = activeGuards.first(); g; g = activeGuards.next(g)) {
+            if (predicate(g->senderAsObject(), g->signalIndex()))
+                return true;
+        }
+        return false;
+    }
     QQmlDelayedError *delayedError();
     virtual bool mustCaptureBindableProperty() const {return true;}
 
@@ -6,6 +6,7 @@
 #include <private/qjsvalue_p.h>
 #include <private/qmetaobject_p.h>
 #include <private/qproperty_p.h>
+#include <private/qqmlbinding_p.h>
 #include <private/qqmlboundsignal_p.h>
 #include <private/qqmlbuiltinfunctions_p.h>
 #include <private/qqmldata_p.h>
@@ -29,9 +30,13 @@
 #include <QtCore/qdebug.h>
 #include <QtCore/qsequentialiterable.h>
 #include <QtCore/qstringlist.h>
+#include <QtCore/qvarlengtharray.h>
 #include <QtCore/qvector.h>
 
 #include <cmath>
+#include <functional>
+#include <queue>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -2068,6 +2073,389 @@ void QQmlPropertyPrivate::flushSignal(const QObject *sender, int signal_index)
     flush_vme_signal(sender, signal_index, indexInSignalRange);
 }
 
+/*!
+    \class QQmlPropertyTransaction
+    \internal
+    \brief The QQmlPropertyTransaction class groups property writes so that
+    dependent bindings are updated once.
+
+    Writing several properties one after another from C++ re-evaluates every
+    binding that depends on them after each individual write. Bindings that
+    depend on more than one of the written properties therefore run several
+    times and may briefly observe a mix of old and new values.
+
+    After begin(), writes made through the transaction are buffered. commit()
+    applies them in the order they were made and then evaluates each affected
+    binding exactly once, after all values are in place. Writing the same
+    property more than once keeps only the last value.
+
+    \code
+    QQmlPropertyTransaction transaction;
+    transaction.begin();
+    transaction.write(item, QStringLiteral("x"), 10);
+    transaction.write(item, QStringLiteral("y"), 20);
+    transaction.write(label, QStringLiteral("text"), QStringLiteral("ready"));
+    transaction.commit();
+    \endcode
+
+    Bindings are evaluated after the bindings they depend on, so a binding that
+    is reachable through several written properties, directly or through other
+    bindings, is still evaluated only once per commit.
+
+    QML signal handlers, such as \c onXChanged, run after all written values
+    and the values of the affected bindings are final. Handlers of the change
+    signals of the written properties, and of the properties of the affected
+    bindings, run once per commit, with the arguments of the last emission.
+    Handlers of other signals emitted during the commit run once per emission,
+    in the order of emission. Bindable properties are notified together at the end of the
+    commit. C++ slots connected to change signals are still called as each
+    property is written.
+
+    Items schedule at most one polish until the next frame, however many of
+    their properties a transaction writes.
+
+    Writes made while no transaction is active are applied immediately, like
+    QQmlProperty::write().
+
+    A transaction that is destroyed while active discards its pending writes.
+*/
+
+QBasicAtomicInt QQmlPropertyTransactionPrivate::activeCommits = Q_BASIC_ATOMIC_INITIALIZER(0);
+thread_local QQmlPropertyTransactionPrivate::DeferredBindings *
+        QQmlPropertyTransactionPrivate::deferredBindings = nullptr;
+
+static int notifySignalIndex(const QObject *object, int coreIndex)
+{
+    if (!object || coreIndex < 0)
+        return -1;
+    const QMetaProperty property = object->metaObject()->property(coreIndex);
+    return property.hasNotifySignal() ? QMetaObjectPrivate::signalIndex(property.notifySignal()) : -1;
+}
+
+bool QQmlPropertyTransactionPrivate::deferBindingUpdate(QQmlAbstractBinding *binding)
+{
+    DeferredBindings *deferred = deferredBindings;
+    if (!deferred || deferred->evaluating == binding)
+        return false;
+
+    if (!deferred->seen.contains(binding)) {
+        deferred->seen.insert(binding);
+        binding->ref.ref();
+
+        QObject *target = binding->targetObject();
+        const Notifier notifier(target, notifySignalIndex(target, binding->targetPropertyIndex().coreIndex()));
+        if (notifier.second != -1)
+            deferred->notifiers.insert(notifier);
+        deferred->bindings.append({ binding, notifier });
+    }
+    return true;
+}
+
+bool QQmlPropertyTransactionPrivate::deferSignalHandler(
+        QQmlBoundSignalExpression *expression, const QObject *sender, int signalIndex, void **a)
+{
+    DeferredBindings *deferred = deferredBindings;
+    if (!deferred || !sender)
+        return false;
+
+    // Copy the arguments, so that the handler can run after the emission returned.
+    const QMetaMethod signal = QMetaObjectPrivate::signal(sender->metaObject(), signalIndex);
+    QVariantList arguments;
+    arguments.reserve(signal.parameterCount());
+    for (int i = 0; i < signal.parameterCount(); ++i) {
+        const QMetaType type = signal.parameterMetaType(i);
+        if (!type.isValid())
+            return false;
+        arguments.append(QVariant(type, a ? a[i + 1] : nullptr));
+    }
+
+    // Only the last value of a written property matters. Every other emission is kept.
+    const bool isChange = deferred->notifiers.contains(Notifier(sender, signalIndex));
+    if (isChange) {
+        const auto it = deferred->changeHandlerIndices.constFind(expression);
+        if (it != deferred->changeHandlerIndices.constEnd()) {
+            deferred->handlers[*it].arguments = std::move(arguments);
+            return true;
+        }
+        deferred->changeHandlerIndices.insert(expression, deferred->handlers.size());
+    }
+
+    expression->addref();
+    deferred->handlers.append({ expression, const_cast<QObject *>(sender), std::move(arguments) });
+    return true;
+}
+
+/*!
+    \internal
+    Returns the order in which \a bindings are evaluated, so that a binding comes after the
+    bindings whose targets it reads. Bindings that do not depend on each other, or that
+    depend on each other in a cycle, keep the order in which they were notified.
+*/
+QList<qsizetype> QQmlPropertyTransactionPrivate::sortByDependencies(
+        const QList<DeferredBinding> &bindings)
+{
+    const qsizetype count = bindings.size();
+    QMultiHash<Notifier, qsizetype> producers;
+    for (qsizetype i = 0; i < count; ++i) {
+        if (bindings.at(i).notifier.second != -1)
+            producers.insert(bindings.at(i).notifier, i);
+    }
+
+    QList<QVarLengthArray<qsizetype, 4>> dependents(count);
+    QList<qsizetype> blockers(count, 0);
+    if (!producers.isEmpty()) {
+        for (qsizetype i = 0; i < count; ++i) {
+            const QQmlBinding *binding = static_cast<const QQmlBinding *>(bindings.at(i).binding);
+            binding->anyActiveGuard([&](QObject *sender, int signalIndex) {
+                const Notifier notifier(sender, signalIndex);
+                for (auto it = producers.constFind(notifier);
+                     it != producers.constEnd() && it.key() == notifier; ++it) {
+                    // A binding reading its own target does not wait for itself.
+                    if (*it == i)
+                        continue;
+                    dependents[*it].append(i);
+                    ++blockers[i];
+                }
+                return false;
+            });
+        }
+    }
+
+    std::priority_queue<qsizetype, std::vector<qsizetype>, std::greater<qsizetype>> ready;
+    for (qsizetype i = 0; i < count; ++i) {
+        if (blockers.at(i) == 0)
+            ready.push(i);
+    }
+
+    QList<qsizetype> order;
+    order.reserve(count);
+    QList<bool> sorted(count, false);
+    qsizetype firstUnsorted = 0;
+    while (order.size() < count) {
+        if (ready.empty()) {
+            // The rest depends on each other in a cycle. Break it at the earliest binding.
+            while (sorted.at(firstUnsorted))
+                ++firstUnsorted;
+            ready.push(firstUnsorted);
+        }
+
+        const qsizetype i = ready.top();
+        ready.pop();
+        if (sorted.at(i))
+            continue;
+        sorted[i] = true;
+        order.append(i);
+        for (qsizetype dependent : std::as_const(dependents[i])) {
+            if (--blockers[dependent] == 0 && !sorted.at(dependent))
+                ready.push(dependent);
+        }
+    }
+    return order;
+}
+
+void QQmlPropertyTransactionPrivate::flushDeferredBindings(DeferredBindings *deferred)
+{
+    // The pending bindings are sorted once per round. Bindings triggered during a round are
+    // evaluated in their place if they are still pending in it, and in the next round
+    // otherwise, so that each binding is evaluated once for the whole commit unless it
+    // depends on a binding evaluated after it.
+    Q_ASSERT(deferredBindings == deferred);
+    while (!deferred->bindings.isEmpty()) {
+        const QList<DeferredBinding> round = std::exchange(deferred->bindings, {});
+        const QList<qsizetype> order = sortByDependencies(round);
+        for (qsizetype index : order) {
+            QQmlAbstractBinding *binding = round.at(index).binding;
+            deferred->seen.remove(binding);
+
+            // Adopt the reference taken in deferBindingUpdate()
+            QQmlAbstractBinding::Ptr guard(binding);
+            binding->ref.deref();
+
+            // The binding may have been removed, or its target destroyed, in the meantime.
+            if (binding->isAddedToObject()) {
+                deferred->evaluating = binding;
+                static_cast<QQmlBinding *>(binding)->expressionChanged();
+                deferred->evaluating = nullptr;
+            }
+        }
+    }
+
+    // Signal handlers run once all values, including those of bindings, are final.
+    deferredBindings = nullptr;
+    const QList<DeferredHandler> handlers = std::exchange(deferred->handlers, {});
+    deferred->changeHandlerIndices.clear();
+    for (const DeferredHandler &handler : handlers) {
+        QQmlRefPointer<QQmlBoundSignalExpression> expression(
+                handler.expression, QQmlRefPointer<QQmlBoundSignalExpression>::Adopt);
+        // The sender may have been destroyed, or the handler's context invalidated.
+        if (handler.sender.isNull() || !expression->hasValidContext())
+            continue;
+
+        QVarLengthArray<void *, 9> args(handler.arguments.size() + 1);
+        args[0] = nullptr;
+        for (qsizetype i = 0; i < handler.arguments.size(); ++i)
+            args[i + 1] = const_cast<void *>(handler.arguments.at(i).constData());
+        expression->evaluate(args.data());
+        if (expression->hasError())
+            QQmlEnginePrivate::warning(expression->engine(), expression->error(expression->engine()));
+    }
+}
+
+/*!
+    Constructs an inactive transaction.
+*/
+QQmlPropertyTransaction::QQmlPropertyTransaction()
+    : d(new QQmlPropertyTransactionPrivate)
+{
+}
+
+/*!
+    \fn QQmlPropertyTransaction::QQmlPropertyTransaction(QQmlPropertyTransaction &&other)
+
+    Move-constructs a transaction from \a other, including its state and
+    buffered writes. The moved-from object can only be destroyed or assigned
+    to.
+*/
+
+/*!
+    \fn QQmlPropertyTransaction &QQmlPropertyTransaction::operator=(QQmlPropertyTransaction &&other)
+
+    Move-assigns \a other to this transaction.
+*/
+
+/*!
+    \fn void QQmlPropertyTransaction::swap(QQmlPropertyTransaction &other)
+    Swaps this transaction with \a other. This operation is very fast and
+    never fails.
+*/
+
+/*!
+    Destroys the transaction, discarding any writes that have not been
+    committed.
+*/
+QQmlPropertyTransaction::~QQmlPropertyTransaction()
+{
+    delete d;
+}
+
+/*!
+    Starts buffering writes. Calling begin() on an active transaction has no
+    effect.
+*/
+void QQmlPropertyTransaction::begin()
+{
+    d->active = true;
+}
+
+/*!
+    Returns \c true if begin() has been called and the transaction has not been
+    committed or discarded since.
+*/
+bool QQmlPropertyTransaction::isActive() const
+{
+    return d->active;
+}
+
+/*!
+    Buffers a write of \a value to \a property. Returns \c false if the
+    property is not a valid, writable property. Type conversion errors are only
+    detected when the write is applied, and are reported by commit().
+
+    If the transaction is not active, the value is written immediately and the
+    result of QQmlProperty::write() is returned.
+*/
+bool QQmlPropertyTransaction::write(const QQmlProperty &property, const QVariant &value)
+{
+    if (!d->active)
+        return property.write(value);
+
+    if (!property.isProperty() || !property.isWritable())
+        return false;
+
+    const auto it = d->writeIndices.constFind(property);
+    if (it != d->writeIndices.constEnd()) {
+        d->writes[*it].value = value;
+        return true;
+    }
+
+    d->writeIndices.insert(property, d->writes.size());
+    d->writes.append({ property, property.object(), value });
+    return true;
+}
+
+/*!
+    \overload
+
+    Buffers a write of \a value to the \a name property of \a object.
+*/
+bool QQmlPropertyTransaction::write(QObject *object, const QString &name, const QVariant &value)
+{
+    return write(QQmlProperty(object, name), value);
+}
+
+/*!
+    Applies all buffered writes and updates the bindings depending on them,
+    then makes the transaction inactive. Writes to objects that have been
+    destroyed since they were buffered are skipped.
+
+    Returns \c true if all writes succeeded. Returns \c false if any write
+    failed, or if the transaction was not active.
+*/
+bool QQmlPropertyTransaction::commit()
+{
+    if (!d->active)
+        return false;
+
+    d->active = false;
+    const QList<QQmlPropertyTransactionPrivate::PendingWrite> writes = std::exchange(d->writes, {});
+    d->writeIndices.clear();
+
+    // Transactions committed from a binding or handler that runs during an
+    // outer commit join the outer deferral.
+    QQmlPropertyTransactionPrivate::DeferredBindings deferred;
+    const bool outermost = !QQmlPropertyTransactionPrivate::deferredBindings;
+    if (outermost) {
+        QQmlPropertyTransactionPrivate::activeCommits.ref();
+        QQmlPropertyTransactionPrivate::deferredBindings = &deferred;
+    }
+
+    // Handlers of the change signals of written properties run once per commit.
+    QQmlPropertyTransactionPrivate::DeferredBindings *current
+            = QQmlPropertyTransactionPrivate::deferredBindings;
+    for (const QQmlPropertyTransactionPrivate::PendingWrite &write : writes) {
+        const int signalIndex = notifySignalIndex(write.object, write.property.index());
+        if (signalIndex != -1)
+            current->notifiers.insert({ write.object.data(), signalIndex });
+    }
+
+    bool ok = true;
+    Qt::beginPropertyUpdateGroup();
+    for (const QQmlPropertyTransactionPrivate::PendingWrite &write : writes) {
+        if (write.object.isNull())
+            ok = false;
+        else if (!write.property.write(write.value))
+            ok = false;
+    }
+    Qt::endPropertyUpdateGroup();
+
+    if (outermost) {
+        QQmlPropertyTransactionPrivate::flushDeferredBindings(&deferred);
+        QQmlPropertyTransactionPrivate::activeCommits.deref();
+    }
+
+    return ok;
+}
+
+/*!
+    Drops all buffered writes and makes the transaction inactive.
+*/
+void QQmlPropertyTransaction::discard()
+{
+    d->active = false;
+    d->writes.clear();
+    d->writeIndices.clear();
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qqmlproperty.cpp"
@@ -26,7 +26,11 @@
 
 #include <QtQml/qqmlengine.h>
 
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
 #include <QtCore/qpointer.h>
+#include <QtCore/qset.h>
+#include <QtCore/qvariant.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -155,6 +159,93 @@ public:
             QQmlPropertyPrivate::InitFlags flags);
 };
 
+class QQmlBoundSignalExpression;
+class QQmlPropertyTransactionPrivate
+{
+public:
+    struct PendingWrite
+    {
+        QQmlProperty property;
+        QPointer<QObject> object;
+        QVariant value;
+    };
+
+    using Notifier = std::pair<const QObject *, int>;
+
+    struct DeferredBinding
+    {
+        QQmlAbstractBinding *binding;
+        // The change signal of the binding's target property, if any
+        Notifier notifier;
+    };
+
+    struct DeferredHandler
+    {
+        QQmlBoundSignalExpression *expression;
+        QPointer<QObject> sender;
+        QVariantList arguments;
+    };
+
+    // Bindings whose dependencies changed, and QML signal handlers that were triggered,
+    // while a transaction was being committed. The bindings are evaluated once each, after
+    // all writes have landed, and after the bindings they depend on. The handlers run in
+    // the order of emission afterwards. Handlers of the change signals of written
+    // properties run once, with the arguments of the last emission.
+    struct DeferredBindings
+    {
+        QList<DeferredBinding> bindings;
+        QSet<QQmlAbstractBinding *> seen;
+        QQmlAbstractBinding *evaluating = nullptr;
+
+        // Change signals of the properties written by the transaction or its bindings
+        QSet<Notifier> notifiers;
+        QList<DeferredHandler> handlers;
+        QHash<QQmlBoundSignalExpression *, qsizetype> changeHandlerIndices;
+    };
+
+    static bool deferBindingUpdate(QQmlAbstractBinding *binding);
+    static bool deferSignalHandler(QQmlBoundSignalExpression *expression, const QObject *sender,
+                                   int signalIndex, void **a);
+    static void flushDeferredBindings(DeferredBindings *deferred);
+
+    QList<PendingWrite> writes;
+    QHash<QQmlProperty, qsizetype> writeIndices;
+    bool active = false;
+
+    // Number of commits in progress on any thread. Binding and signal notifications only
+    // look up the deferral state of their thread while this is non-zero.
+    static QBasicAtomicInt activeCommits;
+    static thread_local DeferredBindings *deferredBindings;
+
+private:
+    static QList<qsizetype> sortByDependencies(const QList<DeferredBinding> &bindings);
+};
+
+class Q_QML_EXPORT QQmlPropertyTransaction
+{
+    Q_DISABLE_COPY(QQmlPropertyTransaction)
+public:
+    QQmlPropertyTransaction();
+    QQmlPropertyTransaction(QQmlPropertyTransaction &&other) noexcept
+        : d(std::exchange(other.d, nullptr)) {}
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QQmlPropertyTransaction)
+    ~QQmlPropertyTransaction();
+
+    void swap(QQmlPropertyTransaction &other) noexcept { qt_ptr_swap(d, other.d); }
+
+    void begin();
+    bool isActive() const;
+
+    bool write(const QQmlProperty &, const QVariant &);
+    bool write(QObject *, const QString &, const QVariant &);
+
+    bool commit();
+    void discard();
+
+private:
+    QQmlPropertyTransactionPrivate *d;
+};
+
 Q_DECLARE_OPERATORS_FOR_FLAGS(QQmlPropertyPrivate::BindingFlags)
 Q_DECLARE_OPERATORS_FOR_FLAGS(QQmlPropertyPrivate::InitFlags);
 
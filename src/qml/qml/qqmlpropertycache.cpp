@@ -17,6 +17,9 @@
 
 #include <QtCore/qdebug.h>
 #include <QtCore/QCryptographicHash>
+#include <QtCore/qmath.h>
+#include <QtCore/qset.h>
+#include <QtCore/qthread.h>
 #include <QtCore/private/qtools_p.h>
 
 #include <limits.h>
@@ -167,6 +170,9 @@ QQmlPropertyCache::~QQmlPropertyCache()
         args = next;
     }
 
+    // The last reference may be dropped on any thread.
+    delete lookupTable.loadAcquire();
+
     // We must clear this prior to releasing the parent incase it is a
     // linked hash
     stringCache.clear();
@@ -577,6 +583,7 @@ void QQmlPropertyCache::append(const QMetaObject *metaObject,
 void QQmlPropertyCache::update(const QMetaObject *metaObject)
 {
     Q_ASSERT(metaObject);
+    resetLookupTable();
     stringCache.clear();
 
     // Preallocate enough space in the index caches for all the properties/methods/signals that
@@ -603,6 +610,7 @@ void QQmlPropertyCache::update(const QMetaObject *metaObject)
 */
 void QQmlPropertyCache::invalidate(const QMetaObject *metaObject)
 {
+    resetLookupTable();
     propertyIndexCache.clear();
     methodIndexCache.clear();
     signalHandlerIndexCache.clear();
@@ -628,6 +636,121 @@ void QQmlPropertyCache::invalidate(const QMetaObject *metaObject)
     }
 }
 
+QQmlPropertyCache::LookupTable *QQmlPropertyCache::LookupTable::create(
+        const StringCache &stringCache)
+{
+    std::unique_ptr<LookupTable> table(new LookupTable);
+
+    // Collect the node each name resolves to. Overridden names appear several times when
+    // iterating, but find() always yields the most derived one.
+    QVarLengthArray<StringCache::ConstIterator, 64> entries;
+    QSet<const void *> seen;
+    for (auto it = stringCache.begin(), end = stringCache.end(); it != end; ++it) {
+        const StringCache::ConstIterator canonical = stringCache.find(it.key());
+        if (!seen.contains(canonical.node())) {
+            seen.insert(canonical.node());
+            entries.append(canonical);
+        }
+    }
+
+    const quint32 count = quint32(entries.size());
+    if (count == 0)
+        return table.release();
+
+    const quint32 groupCount = qNextPowerOfTwo((count + 3) / 4 - 1);
+    table->groupMask = groupCount - 1;
+
+    // Place the largest groups first, while there is still room for them.
+    QVarLengthArray<QVarLengthArray<int, 8>, 16> groups(groupCount);
+    for (int i = 0, end = int(count); i < end; ++i)
+        groups[entries[i].node()->hash & table->groupMask].append(i);
+    QVarLengthArray<quint32, 16> order(groupCount);
+    for (quint32 g = 0; g < groupCount; ++g)
+        order[g] = g;
+    std::stable_sort(order.begin(), order.end(), [&groups](quint32 a, quint32 b) {
+        return groups[a].size() > groups[b].size();
+    });
+
+    constexpr quint32 MaxSeedTries = 1024;
+    for (quint32 slotCount = qNextPowerOfTwo(count); slotCount <= 2 * qNextPowerOfTwo(count);
+         slotCount *= 2) {
+        table->slotMask = slotCount - 1;
+        table->slots.reset(new StringCache::ConstIterator[slotCount]);
+        table->seeds.reset(new quint32[groupCount]());
+
+        bool placedAll = true;
+        QVarLengthArray<quint32, 8> placed;
+        for (quint32 g : std::as_const(order)) {
+            const auto &group = groups[g];
+            if (group.isEmpty())
+                break;
+
+            bool placedGroup = false;
+            for (quint32 seed = 0; seed < MaxSeedTries && !placedGroup; ++seed) {
+                table->seeds[g] = seed;
+                placed.clear();
+                placedGroup = true;
+                for (int i : group) {
+                    const quint32 slot = table->slotIndex(entries[i].node()->hash);
+                    if (table->slots[slot].node() || placed.contains(slot)) {
+                        placedGroup = false;
+                        break;
+                    }
+                    placed.append(slot);
+                }
+            }
+
+            if (!placedGroup) {
+                placedAll = false;
+                break;
+            }
+
+            for (int i = 0, end = int(group.size()); i < end; ++i)
+                table->slots[placed[i]] = entries[group[i]];
+        }
+
+        if (placedAll) {
+            table->isPerfect = true;
+            return table.release();
+        }
+    }
+
+    // Pathological hash distribution. Keep using the regular hash lookup.
+    table->slots.reset();
+    table->seeds.reset();
+    return table.release();
+}
+
+/*! \internal
+    Lazily builds the name lookup table on first use. The cache is complete and effectively
+    immutable by the time it is queried by name, but it may be queried from several threads.
+*/
+const QQmlPropertyCache::LookupTable *QQmlPropertyCache::createLookupTable() const
+{
+    const LookupTable *table = LookupTable::create(stringCache);
+    if (!lookupTable.testAndSetOrdered(nullptr, table)) {
+        delete table;
+        table = lookupTable.loadAcquire();
+    }
+    return table;
+}
+
+/*! \internal
+    Drops the name lookup table when the names of the cache change. Like modifying the string
+    cache itself, this is only allowed while no other thread can look up names in this cache,
+    that is while the cache is being built, or for caches owned by a single object, such as
+    those of QQmlOpenMetaObject. Readers do not hold a reference to the table, so it cannot be
+    dropped safely while they may still use it.
+
+    The table does not belong to the thread that built it. A type loader thread may do the
+    first lookup and hand the cache over to the GUI thread, which may then modify it. The
+    atomic exchange below takes over the table from whichever thread published it.
+*/
+void QQmlPropertyCache::resetLookupTable()
+{
+    delete lookupTable.fetchAndStoreAcquire(nullptr);
+}
+
 const QQmlPropertyData *QQmlPropertyCache::findProperty(
         StringCache::ConstIterator it, QObject *object,
         const QQmlRefPointer<QQmlContextData> &context) const
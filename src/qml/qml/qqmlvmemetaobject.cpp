@@ -24,6 +24,7 @@
 #include <private/qv4variantobject_p.h>
 
 #include <QtCore/qsequentialiterable.h>
+#include <QtCore/qvarlengtharray.h>
 
 #include <climits> // for CHAR_BIT
 
@@ -105,6 +106,82 @@ void QQmlVMEResolvedList::activateSignal() const
     m_metaObject->activate(m_metaObject->object, int(m_id), nullptr);
 }
 
+bool QQmlVMEInlinePropertyStorage::isInlineType(QMetaType metaType)
+{
+    switch (metaType.id()) {
+    case QMetaType::Int:
+    case QMetaType::Bool:
+    case QMetaType::Double:
+    case QMetaType::QString:
+    case QMetaType::QUrl:
+    case QMetaType::QColor:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*!
+    \internal
+    Lays out typed slots for the properties in [\a propOffset, \a propOffset + \a propCount)
+    of \a cache that have an inline type, and default-constructs them. The per-property
+    offsets are stored at the start of the same block. Returns the number of inline properties.
+ */
+int QQmlVMEInlinePropertyStorage::allocate(
+        const QQmlPropertyCache *cache, int propOffset, int propCount)
+{
+    Q_ASSERT(!m_block);
+    if (propCount <= 0)
+        return 0;
+
+    QVarLengthArray<quint16, 32> offsets(propCount);
+    qsizetype size = propCount * qsizetype(sizeof(quint16));
+    int inlineCount = 0;
+    for (int id = 0; id < propCount; ++id) {
+        offsets[id] = 0;
+        const QMetaType metaType = cache->property(propOffset + id)->propType();
+        if (!isInlineType(metaType))
+            continue;
+
+        const qsizetype alignment = metaType.alignOf();
+        const qsizetype offset = (size + alignment - 1) & ~(alignment - 1);
+        if (offset + metaType.sizeOf() > std::numeric_limits<quint16>::max())
+            continue;
+
+        offsets[id] = quint16(offset);
+        size = offset + metaType.sizeOf();
+        ++inlineCount;
+    }
+
+    if (inlineCount == 0)
+        return 0;
+
+    m_block = static_cast<char *>(::operator new(size));
+    m_count = propCount;
+    memcpy(m_block, offsets.constData(), propCount * sizeof(quint16));
+    for (int id = 0; id < propCount; ++id) {
+        if (offsets[id])
+            cache->property(propOffset + id)->propType().construct(m_block + offsets[id]);
+    }
+
+    return inlineCount;
+}
+
+void QQmlVMEInlinePropertyStorage::release(const QQmlPropertyCache *cache, int propOffset)
+{
+    if (!m_block)
+        return;
+
+    for (int id = 0; id < m_count; ++id) {
+        if (void *data = slot(id))
+            cache->property(propOffset + id)->propType().destruct(data);
+    }
+
+    ::operator delete(m_block);
+    m_block = nullptr;
+    m_count = 0;
+}
+
 void QQmlVMEMetaObject::list_append(QQmlListProperty<QObject> *prop, QObject *o)
 {
     const QQmlVMEResolvedList resolved(prop);
@@ -292,11 +369,57 @@ void QQmlInterceptorMetaObject::registerInterceptor(QQmlPropertyIndex index, QQm
     interceptors = interceptor;
 }
 
+/*!
+    \internal
+    Marks the bindings of \a obj as parked or not. While they are parked, reads
+    through the meta-object system evaluate a pending binding first, so that C++
+    readers don't see stale values. If \a obj has no interceptor meta-object, one
+    is installed while the bindings are parked and removed again afterwards.
+ */
+void QQmlInterceptorMetaObject::setBindingsParked(QObject *obj, const QQmlPropertyCache::ConstPtr &cache,
+                                                  bool parked)
+{
+    QQmlInterceptorMetaObject *mo = get(obj);
+    if (parked) {
+        if (!mo && cache) {
+            mo = new QQmlInterceptorMetaObject(obj, cache);
+            mo->installedForParking = true;
+        }
+        if (mo)
+            mo->bindingsParked = true;
+        return;
+    }
+
+    if (!mo)
+        return;
+    mo->bindingsParked = false;
+
+    // Keep it if value interceptors have been registered on it, or if another
+    // dynamic meta-object has been installed on top of it since.
+    QObjectPrivate *op = QObjectPrivate::get(obj);
+    if (!mo->installedForParking || mo->interceptors || op->metaObject != mo)
+        return;
+    op->metaObject = mo->parent.isT1() ? mo->parent.asT1() : nullptr;
+    QQmlData::get(obj)->hasInterceptorMetaObject = false;
+    delete mo;
+}
+
+static inline void flushParkedBinding(QObject *object, QMetaObject::Call c, int id)
+{
+    if (c != QMetaObject::ReadProperty || id < 0 || id > 0xffff)
+        return;
+    QQmlData *data = QQmlData::get(object);
+    if (data && data->bindingsParked && data->hasPendingBindingBit(id))
+        data->flushPendingBinding(id);
+}
+
 int QQmlInterceptorMetaObject::metaCall(QObject *o, QMetaObject::Call c, int id, void **a)
 {
     Q_ASSERT(o == object);
     Q_UNUSED(o);
 
+    if (Q_UNLIKELY(bindingsParked))
+        flushParkedBinding(object, c, id);
     if (intercept(c, id, a))
         return -1;
     return object->qt_metacall(c, id, a);
@@ -441,7 +564,14 @@ QQmlVMEMetaObject::QQmlVMEMetaObject(QV4::ExecutionEngine *engine,
 
     if (const QV4::CompiledData::Object *compiledObject = findCompiledObject()) {
         numAliases = compiledObject->nAliases;
-        if (const uint size = compiledObject->nProperties + compiledObject->nFunctions) {
+
+        // Properties of simple types are stored inline. The member data is still indexed by
+        // property id, and methods come after all properties, so we can only skip it if all
+        // properties are inline and there are no methods.
+        const uint numInlineProperties
+                = uint(inlineProperties.allocate(cache.data(), propOffset(), propCount()));
+        const uint size = compiledObject->nProperties + compiledObject->nFunctions;
+        if (size > numInlineProperties) {
             QV4::Heap::MemberData *data = QV4::MemberData::allocate(engine, size);
             // we only have a weak reference below; if the VMEMetaObject is already marked
             // (triggered by the allocate call above)
@@ -474,6 +604,7 @@ QQmlVMEMetaObject::~QQmlVMEMetaObject()
 {
     if (parent.isT1()) parent.asT1()->objectDestroyed(object);
     delete [] aliasEndpoints;
+    inlineProperties.release(cache.data(), propOffset());
 
     qDeleteAll(varObjectGuards);
 }
@@ -494,6 +625,11 @@ QV4::MemberData *QQmlVMEMetaObject::propertyAndMethodStorageAsMemberData() const
 
 void QQmlVMEMetaObject::writeProperty(int id, int v)
 {
+    if (int *slot = inlineProperties.value<int>(id)) {
+        *slot = v;
+        return;
+    }
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (md)
         md->set(engine, id, QV4::Value::fromInt32(v));
@@ -501,6 +637,11 @@ void QQmlVMEMetaObject::writeProperty(int id, int v)
 
 void QQmlVMEMetaObject::writeProperty(int id, bool v)
 {
+    if (bool *slot = inlineProperties.value<bool>(id)) {
+        *slot = v;
+        return;
+    }
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (md)
         md->set(engine, id, QV4::Value::fromBoolean(v));
@@ -508,6 +649,11 @@ void QQmlVMEMetaObject::writeProperty(int id, bool v)
 
 void QQmlVMEMetaObject::writeProperty(int id, double v)
 {
+    if (double *slot = inlineProperties.value<double>(id)) {
+        *slot = v;
+        return;
+    }
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (md)
         md->set(engine, id, QV4::Value::fromDouble(v));
@@ -515,6 +661,11 @@ void QQmlVMEMetaObject::writeProperty(int id, double v)
 
 void QQmlVMEMetaObject::writeProperty(int id, const QString& v)
 {
+    if (QString *slot = inlineProperties.value<QString>(id)) {
+        *slot = v;
+        return;
+    }
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (md) {
         QV4::Scope scope(engine);
@@ -542,6 +693,9 @@ void QQmlVMEMetaObject::writeProperty(int id, QObject* v)
 
 int QQmlVMEMetaObject::readPropertyAsInt(int id) const
 {
+    if (const int *slot = inlineProperties.value<int>(id))
+        return *slot;
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (!md)
         return 0;
@@ -555,6 +709,9 @@ int QQmlVMEMetaObject::readPropertyAsInt(int id) const
 
 bool QQmlVMEMetaObject::readPropertyAsBool(int id) const
 {
+    if (const bool *slot = inlineProperties.value<bool>(id))
+        return *slot;
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (!md)
         return false;
@@ -568,6 +725,9 @@ bool QQmlVMEMetaObject::readPropertyAsBool(int id) const
 
 double QQmlVMEMetaObject::readPropertyAsDouble(int id) const
 {
+    if (const double *slot = inlineProperties.value<double>(id))
+        return *slot;
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (!md)
         return 0.0;
@@ -581,6 +741,9 @@ double QQmlVMEMetaObject::readPropertyAsDouble(int id) const
 
 QString QQmlVMEMetaObject::readPropertyAsString(int id) const
 {
+    if (const QString *slot = inlineProperties.value<QString>(id))
+        return *slot;
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (!md)
         return QString();
@@ -594,6 +757,9 @@ QString QQmlVMEMetaObject::readPropertyAsString(int id) const
 
 QUrl QQmlVMEMetaObject::readPropertyAsUrl(int id) const
 {
+    if (const QUrl *slot = inlineProperties.value<QUrl>(id))
+        return *slot;
+
     QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
     if (!md)
         return QUrl();
@@ -742,6 +908,8 @@ int QQmlVMEMetaObject::metaCall(QObject *o, QMetaObject::Call c, int _id, void *
 
     int id = _id;
 
+    if (Q_UNLIKELY(bindingsParked))
+        flushParkedBinding(object, c, _id);
     if (intercept(c, _id, a))
         return -1;
 
@@ -865,7 +1033,11 @@ int QQmlVMEMetaObject::metaCall(QObject *o, QMetaObject::Call c, int _id, void *
                             }
                             break;
                         case QV4::CompiledData::CommonType::Invalid:
-                            if (QV4::MemberData *md = propertyAndMethodStorageAsMemberData()) {
+                            if (const void *slot = inlineProperties.slot(id)) {
+                                const QMetaType propType = propertyData->propType();
+                                propType.destruct(a[0]);
+                                propType.construct(a[0], slot);
+                            } else if (QV4::MemberData *md = propertyAndMethodStorageAsMemberData()) {
                                 QV4::Scope scope(engine);
                                 QV4::ScopedValue sv(scope, *(md->data() + id));
 
@@ -1004,7 +1176,14 @@ int QQmlVMEMetaObject::metaCall(QObject *o, QMetaObject::Call c, int _id, void *
                                 writeKnownVarProperty(id, *reinterpret_cast<QVariant *>(a[0]));
                             break;
                         case QV4::CompiledData::CommonType::Invalid:
-                            if (QV4::MemberData *md = propertyAndMethodStorageAsMemberData()) {
+                            if (void *slot = inlineProperties.slot(id)) {
+                                const QMetaType propType = propertyData->propType();
+                                if (!propType.equals(slot, a[0])) {
+                                    needActivate = true;
+                                    propType.destruct(slot);
+                                    propType.construct(slot, a[0]);
+                                }
+                            } else if (QV4::MemberData *md = propertyAndMethodStorageAsMemberData()) {
                                 QV4::Scope scope(engine);
                                 QV4::ScopedValue sv(scope, *(md->data() + id));
 
@@ -82,6 +82,38 @@ private:
     quintptr m_id = 0;
 };
 
+// Typed storage for declared properties of simple value types. Such properties
+// don't need to live in the JavaScript heap, and reading or writing them from
+// C++ should not require boxing the value into a QV4::Value.
+class QQmlVMEInlinePropertyStorage
+{
+    Q_DISABLE_COPY_MOVE(QQmlVMEInlinePropertyStorage)
+
+public:
+    QQmlVMEInlinePropertyStorage() = default;
+    ~QQmlVMEInlinePropertyStorage() { Q_ASSERT(!m_block); }
+
+    static bool isInlineType(QMetaType metaType);
+
+    int allocate(const QQmlPropertyCache *cache, int propOffset, int propCount);
+    void release(const QQmlPropertyCache *cache, int propOffset);
+
+    void *slot(int id) const
+    {
+        if (!m_block || id >= m_count)
+            return nullptr;
+        const quint16 offset = reinterpret_cast<const quint16 *>(m_block)[id];
+        return offset ? m_block + offset : nullptr;
+    }
+
+    template<typename T>
+    T *value(int id) const { return static_cast<T *>(slot(id)); }
+
+private:
+    char *m_block = nullptr;
+    int m_count = 0;
+};
+
 class QQmlVMEVariantQObjectPtr : public QQmlGuard<QObject>
 {
 public:
@@ -129,6 +161,8 @@ public:
 
     void invalidate() { metaObject.setTag(MetaObjectInvalid); }
 
+    static void setBindingsParked(QObject *obj, const QQmlPropertyCache::ConstPtr &cache, bool parked);
+
     QObject *object = nullptr;
     QQmlPropertyCache::ConstPtr cache;
 
@@ -158,9 +192,14 @@ protected:
     enum MetaObjectValidity { MetaObjectValid, MetaObjectInvalid };
     QTaggedPointer<const QMetaObject, MetaObjectValidity> metaObject;
 
+    // Set while the object's bindings are parked, so that reads evaluate them first.
+    bool bindingsParked = false;
+
 private:
     bool doIntercept(QMetaObject::Call c, int id, void **a);
     QQmlPropertyValueInterceptor *interceptors = nullptr;
+    // Set when this meta-object was only installed for parked bindings.
+    bool installedForParking = false;
 };
 
 inline QQmlInterceptorMetaObject *QQmlInterceptorMetaObject::get(QObject *obj)
@@ -251,6 +290,11 @@ public:
     template<typename VariantCompatible>
     void writeProperty(int id, const VariantCompatible &v)
     {
+        if (VariantCompatible *slot = inlineProperties.value<VariantCompatible>(id)) {
+            *slot = v;
+            return;
+        }
+
         QV4::MemberData *md = propertyAndMethodStorageAsMemberData();
         if (md) {
             QV4::Scope scope(engine);
@@ -291,6 +335,8 @@ private:
     int qmlObjectId = -1;
     int numAliases = 0;
 
+    QQmlVMEInlinePropertyStorage inlineProperties;
+
     const QV4::CompiledData::Object *findCompiledObject() const {
         // If the executable CU has been stripped of its engine, it has an empty base CU
         if (!compilationUnit || !compilationUnit->engine)
@@ -3,6 +3,7 @@
 
 #include "qqmladaptormodel_p.h"
 
+#include <private/qqmldelegatemodelsortfilter_p.h>
 #include <private/qqmldmabstractitemmodeldata_p.h>
 #include <private/qqmldmlistaccessordata_p.h>
 #include <private/qqmldmobjectdata_p.h>
@@ -80,6 +81,8 @@ int QQmlAdaptorModel::count() const
 
 int QQmlAdaptorModel::rowCount() const
 {
+    if (sortFilter && isValid())
+        return sortFilter->count();
     return qMax(0, accessors->rowCount(*this));
 }
 
@@ -90,18 +93,24 @@ int QQmlAdaptorModel::columnCount() const
 
 int QQmlAdaptorModel::rowAt(int index) const
 {
+    if (sortFilter && isValid())
+        return sortFilter->sourceRow(index);
     int count = rowCount();
     return count <= 0 ? -1 : index % count;
 }
 
 int QQmlAdaptorModel::columnAt(int index) const
 {
+    if (sortFilter && isValid())
+        return sortFilter->sourceRow(index) == -1 ? -1 : 0;
     int count = rowCount();
     return count <= 0 ? -1 : index / count;
 }
 
 int QQmlAdaptorModel::indexAt(int row, int column) const
 {
+    if (sortFilter && isValid())
+        return column == 0 ? sortFilter->proxyIndex(row) : -1;
     return column * rowCount() + row;
 }
 
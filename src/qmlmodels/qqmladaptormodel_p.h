@@ -33,6 +33,7 @@ class QQmlEngine;
 
 class QQmlDelegateModelItem;
 class QQmlDelegateModelItemMetaType;
+class QQmlDelegateModelSortFilter;
 
 class Q_QMLMODELS_EXPORT QQmlAdaptorModel : public QQmlGuard<QObject>
 {
@@ -70,6 +71,7 @@ public:
             return QVariant(); }
         virtual bool canFetchMore(const QQmlAdaptorModel &) const { return false; }
         virtual void fetchMore(QQmlAdaptorModel &) const {}
+        virtual void prefetch(QQmlAdaptorModel &, int, int) const {}
 
         QScopedPointer<QMetaObject, QScopedPointerPodDeleter> metaObject;
         QQmlPropertyCache::ConstPtr propertyCache;
@@ -83,6 +85,9 @@ public:
     // as that causes issues with singletons
     QV4::PersistentValue modelStrongReference;
 
+    // If set, indexes refer to the sorted and filtered rows of the model
+    const QQmlDelegateModelSortFilter *sortFilter = nullptr;
+
     QTypeRevision modelItemRevision = QTypeRevision::zero();
     QQmlDelegateModel::DelegateModelAccess delegateModelAccess = QQmlDelegateModel::Qt5ReadWrite;
 
@@ -134,6 +139,7 @@ public:
     inline QVariant parentModelIndex() const { return accessors->parentModelIndex(*this); }
     inline bool canFetchMore() const { return accessors->canFetchMore(*this); }
     inline void fetchMore() { return accessors->fetchMore(*this); }
+    inline void prefetch(int index, int count) { accessors->prefetch(*this, index, count); }
 
 private:
     static void objectDestroyedImpl(QQmlGuardImpl *);
@@ -173,6 +173,8 @@ QQmlDelegateModelPrivate::QQmlDelegateModelPrivate(QQmlContext *ctxt)
     , m_transaction(false)
     , m_incubatorCleanupScheduled(false)
     , m_waitingToFetchMore(false)
+    , m_coalesceChanges(false)
+    , m_changesPending(false)
     , m_cacheItems(nullptr)
     , m_items(nullptr)
     , m_persistedItems(nullptr)
@@ -313,6 +315,7 @@ void QQmlDelegateModel::componentComplete()
         static_cast<QQmlPartsModel *>(d->m_pendingParts.first())->updateFilterGroup();
 
     QVector<Compositor::Insert> inserts;
+    d->updateSortFilter();
     d->m_count = d->adaptorModelCount();
     d->m_compositor.append(
             &d->m_adaptorModel,
@@ -404,6 +407,7 @@ void QQmlDelegateModel::setModel(const QVariant &model)
     }
 
     if (d->m_complete) {
+        d->updateSortFilter();
         _q_itemsInserted(0, d->adaptorModelCount());
         d->requestMoreIfNecessary();
     }
@@ -522,6 +526,7 @@ void QQmlDelegateModel::setRootIndex(const QVariant &root)
         if (d->m_adaptorModel.canFetchMore())
             d->m_adaptorModel.fetchMore();
         if (d->m_complete) {
+            d->updateSortFilter();
             const int newCount = d->adaptorModelCount();
             if (oldCount)
                 _q_itemsRemoved(0, oldCount);
@@ -569,6 +574,278 @@ void QQmlDelegateModel::setDelegateModelAccess(
     emit delegateModelAccessChanged();
 }
 
+/*!
+    \qmlproperty string QtQml.Models::DelegateModel::sortRole
+    \since 6.10
+
+    This property holds the name of the model role by which the items of the
+    \l model are sorted.
+
+    Items are ordered by comparing the values of this role, and items with
+    equal values keep the order they have in the model. When rows are inserted,
+    removed or changed in the model, only the affected items are placed again,
+    using a binary search, so that views receive minimal change notifications.
+
+    Sorting and filtering are only supported for models derived from
+    QAbstractItemModel, including \l ListModel. Inside a delegate, \c index
+    refers to the sorted position of the item and \c row to its row in the
+    model.
+
+    By default this property is empty, and the items are not sorted.
+
+    \sa sortOrder, sortComparator, filterRole
+*/
+QString QQmlDelegateModel::sortRole() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortFilter.sortRole;
+}
+
+void QQmlDelegateModel::setSortRole(const QString &role)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortFilter.sortRole == role || !d->canChangeSortFilter())
+        return;
+    d->m_sortFilter.sortRole = role;
+    resetSortFilter();
+    emit sortRoleChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::DelegateModel::sortOrder
+    \since 6.10
+
+    This property holds the order in which items are sorted by \l sortRole.
+
+    \value Qt.AscendingOrder    Items with smaller values come first. This is the default.
+    \value Qt.DescendingOrder   Items with larger values come first.
+*/
+Qt::SortOrder QQmlDelegateModel::sortOrder() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortFilter.sortOrder;
+}
+
+void QQmlDelegateModel::setSortOrder(Qt::SortOrder order)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortFilter.sortOrder == order || !d->canChangeSortFilter())
+        return;
+    d->m_sortFilter.sortOrder = order;
+    if (d->m_sortFilter.isSorted())
+        resetSortFilter();
+    emit sortOrderChanged();
+}
+
+/*!
+    \qmlproperty function QtQml.Models::DelegateModel::sortComparator
+    \since 6.10
+
+    This property holds an optional function comparing two values of the
+    \l sortRole. Like the comparator passed to \c Array.prototype.sort(), it
+    returns a negative number if the first value sorts before the second, a
+    positive number if it sorts after it, and zero if they are equal.
+
+    If no function is set, values are compared by their type; strings are
+    compared case-sensitively.
+
+    \code
+    DelegateModel {
+        model: contacts
+        sortRole: "name"
+        sortComparator: (a, b) => a.localeCompare(b)
+    }
+    \endcode
+
+    The function has to be consistent. If its result depends on anything but
+    its arguments, call invalidateSortFilter() whenever that changes.
+*/
+QJSValue QQmlDelegateModel::sortComparator() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortFilter.sortComparator;
+}
+
+void QQmlDelegateModel::setSortComparator(const QJSValue &comparator)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortFilter.sortComparator.strictlyEquals(comparator) || !d->canChangeSortFilter())
+        return;
+    d->m_sortFilter.sortComparator = comparator;
+    if (d->m_sortFilter.isSorted())
+        resetSortFilter();
+    emit sortComparatorChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::DelegateModel::filterRole
+    \since 6.10
+
+    This property holds the name of the model role by which the items of the
+    \l model are filtered. Items are only shown if the value of this role
+    converts to \c true, or if \l filterPredicate returns \c true for it.
+
+    Like sorting, filtering is maintained incrementally as the model changes.
+
+    By default this property is empty, and all items are shown.
+
+    \sa filterPredicate, sortRole
+*/
+QString QQmlDelegateModel::filterRole() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortFilter.filterRole;
+}
+
+void QQmlDelegateModel::setFilterRole(const QString &role)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortFilter.filterRole == role || !d->canChangeSortFilter())
+        return;
+    d->m_sortFilter.filterRole = role;
+    resetSortFilter();
+    emit filterRoleChanged();
+}
+
+/*!
+    \qmlproperty function QtQml.Models::DelegateModel::filterPredicate
+    \since 6.10
+
+    This property holds an optional function that is called with the value
+    of the \l filterRole of an item, and returns whether the item is shown.
+
+    \code
+    DelegateModel {
+        model: tasks
+        filterRole: "priority"
+        filterPredicate: priority => priority > 2
+    }
+    \endcode
+
+    The function has to be consistent. If its result depends on anything but
+    its argument, call invalidateSortFilter() whenever that changes.
+*/
+QJSValue QQmlDelegateModel::filterPredicate() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortFilter.filterPredicate;
+}
+
+void QQmlDelegateModel::setFilterPredicate(const QJSValue &predicate)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortFilter.filterPredicate.strictlyEquals(predicate) || !d->canChangeSortFilter())
+        return;
+    d->m_sortFilter.filterPredicate = predicate;
+    if (d->m_sortFilter.isFiltered())
+        resetSortFilter();
+    emit filterPredicateChanged();
+}
+
+/*!
+    \qmlproperty bool QtQml.Models::DelegateModel::coalesceChanges
+    \since 6.10
+
+    This property holds whether the changes reported by the model are
+    collected and passed on to the view together, instead of one by one.
+
+    By default, each row that the model inserts, removes, moves or changes
+    is immediately reported to the view, and to the \l count and the
+    \l{DelegateModelGroup::changed}{changed} signal handlers. A model that
+    streams many small changes within one turn of the event loop thereby
+    makes the view lay out its items again, and the bindings evaluate again,
+    for each of them.
+
+    When this property is \c true, the changes are merged, and reported when
+    the view is polished before the next frame, or as soon as the view needs
+    to create an item. If the DelegateModel isn't used by a view, or the
+    window of the view isn't shown, they are reported once the event loop is
+    returned to. Until then, the view is not aware of the changes, and
+    neither \c countChanged nor \l{DelegateModelGroup::changed}{changed}
+    have been emitted for them.
+
+    The default value is \c false.
+*/
+bool QQmlDelegateModel::coalesceChanges() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_coalesceChanges;
+}
+
+void QQmlDelegateModel::setCoalesceChanges(bool coalesce)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_coalesceChanges == coalesce)
+        return;
+    d->m_coalesceChanges = coalesce;
+    if (!coalesce)
+        flushChanges();
+    emit coalesceChangesChanged();
+}
+
+/*!
+    \internal
+
+    Reports the changes that were collected because of coalesceChanges.
+*/
+void QQmlDelegateModel::flushChanges()
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_changesPending)
+        d->emitChanges();
+}
+
+/*!
+    \qmlmethod void QtQml.Models::DelegateModel::invalidateSortFilter()
+    \since 6.10
+
+    Sorts and filters all items again. Call this if the result of
+    \l sortComparator or \l filterPredicate changed for reasons other than a
+    change in the model.
+*/
+void QQmlDelegateModel::invalidateSortFilter()
+{
+    Q_D(QQmlDelegateModel);
+    if (d->canChangeSortFilter())
+        resetSortFilter();
+}
+
+bool QQmlDelegateModelPrivate::canChangeSortFilter()
+{
+    if (!m_transaction)
+        return true;
+    qmlWarning(q_func()) << QQmlDelegateModel::tr(
+            "The sorting and filtering of a DelegateModel cannot be changed within onUpdated.");
+    return false;
+}
+
+void QQmlDelegateModelPrivate::updateSortFilter()
+{
+    Q_Q(QQmlDelegateModel);
+    QJSEngine *engine = m_context ? m_context->engine() : nullptr;
+    const bool active = m_sortFilter.activate(&m_adaptorModel, engine);
+    m_adaptorModel.sortFilter = active ? &m_sortFilter : nullptr;
+
+    if (!active && m_adaptorModel.isValid()
+            && (m_sortFilter.isSorted() || m_sortFilter.isFiltered())) {
+        qmlWarning(q) << QQmlDelegateModel::tr(
+                "Sorting and filtering is only supported for QAbstractItemModel based models.");
+    }
+}
+
+void QQmlDelegateModelPrivate::updateSortFilterRows()
+{
+    const QList<QQmlDelegateModelItem *> cache = m_cache;
+    for (QQmlDelegateModelItem *item : cache) {
+        const int index = item->modelIndex();
+        if (index == -1)
+            continue;
+        const int row = m_sortFilter.sourceRow(index);
+        if (row != item->modelRow())
+            item->setModelIndex(index, row, 0);
+    }
+}
+
 /*!
     \qmlmethod QModelIndex QtQml.Models::DelegateModel::modelIndex(int index)
 
@@ -1087,7 +1364,7 @@ void QQmlDelegateModelPrivate::reuseItem(QQmlDelegateModelItem *item, int newMod
     // as the index, and the column is always 0. We set alwaysEmit to true, to
     // force all bindings to be reevaluated, even if the index didn't change.
     const bool alwaysEmit = true;
-    item->setModelIndex(newModelIndex, newModelIndex, 0, alwaysEmit);
+    item->setModelIndex(newModelIndex, sourceRow(newModelIndex), 0, alwaysEmit);
 
     // Notify the application that all 'dynamic'/role-based context data has
     // changed as well (their getter function will use the updated index).
@@ -1124,6 +1401,33 @@ int QQmlDelegateModel::poolSize()
     return d_func()->m_reusableItemsPool.size();
 }
 
+/*!
+    \internal
+
+    Warms the model data of the \a count items from \a index that are about
+    to be requested by the view. Items that are already created, or being
+    created, are skipped. If the range goes past the end of the model, more
+    rows are fetched from the model, if it can provide them.
+*/
+void QQmlDelegateModel::prefetch(int index, int count)
+{
+    Q_D(QQmlDelegateModel);
+    if (!d->m_delegate || index < 0 || count <= 0)
+        return;
+
+    const int groupCount = d->m_compositor.count(d->m_compositorGroup);
+    if (index + count > groupCount)
+        d->requestMoreIfNecessary();
+
+    for (int i = index, end = qMin(index + count, groupCount); i < end; ++i) {
+        Compositor::iterator it = d->m_compositor.find(d->m_compositorGroup, i);
+        if (it->inCache())
+            continue;
+        if (QQmlAdaptorModel *model = it.list<QQmlAdaptorModel>())
+            model->prefetch(it.modelIndex(), 1);
+    }
+}
+
 QQmlComponent *QQmlDelegateModelPrivate::resolveDelegate(int index)
 {
     if (!m_delegateChooser)
@@ -1133,7 +1437,7 @@ QQmlComponent *QQmlDelegateModelPrivate::resolveDelegate(int index)
     QQmlAbstractDelegateComponent *chooser = m_delegateChooser;
 
     do {
-        delegate = chooser->delegate(&m_adaptorModel, index);
+        delegate = chooser->delegate(&m_adaptorModel, sourceRow(index));
         chooser = qobject_cast<QQmlAbstractDelegateComponent *>(delegate);
     } while (chooser);
 
@@ -1362,6 +1666,8 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
 QObject *QQmlDelegateModel::object(int index, QQmlIncubator::IncubationMode incubationMode)
 {
     Q_D(QQmlDelegateModel);
+    // The view has to know about all the changes before it can create items by index
+    flushChanges();
     if (!d->m_delegate || index < 0 || index >= d->m_compositor.count(d->m_compositorGroup)) {
         qWarning() << "DelegateModel::item: index out range" << index << d->m_compositor.count(d->m_compositorGroup);
         return nullptr;
@@ -1479,6 +1785,8 @@ bool QQmlDelegateModel::event(QEvent *e)
         d->m_incubatorCleanupScheduled = false;
         qDeleteAll(d->m_finishedIncubating);
         d->m_finishedIncubating.clear();
+    } else if (e->type() == QEvent::UpdateLater) {
+        flushChanges();
     }
     return QQmlInstanceModel::event(e);
 }
@@ -1512,7 +1820,7 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
         QVector<Compositor::Change> changes;
         d->m_compositor.listItemsChanged(&d->m_adaptorModel, index, count, &changes);
         d->itemsChanged(changes);
-        d->emitChanges();
+        d->emitModelChanges();
     }
     const bool needToCheckDelegateChoiceInvalidation = d->m_delegateChooser && !roles.isEmpty();
     if (!needToCheckDelegateChoiceInvalidation)
@@ -1557,7 +1865,7 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
         item->releaseObject();
     d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
     d->itemsMoved(removes, inserts);
-    d->emitChanges();
+    d->emitModelChanges();
 }
 
 static void incrementIndexes(QQmlDelegateModelItem *cacheItem, int count, const int *deltas)
@@ -1662,7 +1970,7 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
 
         if (item->modelIndex() >= index) {
             const int newIndex = item->modelIndex() + count;
-            const int row = newIndex;
+            const int row = d->rowForIndex(item, newIndex);
             const int column = 0;
             item->setModelIndex(newIndex, row, column);
         }
@@ -1671,7 +1979,7 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
     d->itemsInserted(inserts);
-    d->emitChanges();
+    d->emitModelChanges();
 }
 
 //### This method should be split in two. It will remove delegates, and it will re-render the list.
@@ -1813,7 +2121,7 @@ void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
 
         if (item->modelIndex() >= index + count) {
             const int newIndex = item->modelIndex() - count;
-            const int row = newIndex;
+            const int row = d->rowForIndex(item, newIndex);
             const int column = 0;
             item->setModelIndex(newIndex, row, column);
         } else if (item->modelIndex() >= index) {
@@ -1828,7 +2136,7 @@ void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
     d->m_compositor.listItemsRemoved(&d->m_adaptorModel, index, count, &removes);
     d->itemsRemoved(removes);
 
-    d->emitChanges();
+    d->emitModelChanges();
 }
 
 void QQmlDelegateModelPrivate::itemsMoved(
@@ -1873,12 +2181,12 @@ void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
 
         if (item->modelIndex() >= from && item->modelIndex() < from + count) {
             const int newIndex = item->modelIndex() - from + to;
-            const int row = newIndex;
+            const int row = d->rowForIndex(item, newIndex);
             const int column = 0;
             item->setModelIndex(newIndex, row, column);
         } else if (item->modelIndex() >= minimum && item->modelIndex() < maximum) {
             const int newIndex = item->modelIndex() + difference;
-            const int row = newIndex;
+            const int row = d->rowForIndex(item, newIndex);
             const int column = 0;
             item->setModelIndex(newIndex, row, column);
         }
@@ -1888,7 +2196,7 @@ void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsMoved(&d->m_adaptorModel, from, to, count, &removes, &inserts);
     d->itemsMoved(removes, inserts);
-    d->emitChanges();
+    d->emitModelChanges();
 }
 
 void QQmlDelegateModelPrivate::emitModelUpdated(const QQmlChangeSet &changeSet, bool reset)
@@ -1925,11 +2233,48 @@ void QQmlDelegateModelPrivate::delegateChanged(bool add, bool remove)
     emitChanges();
 }
 
+void QQmlDelegateModelPrivate::emitModelChanges()
+{
+    // Called once the changes reported by the source model have been applied
+    // to the compositor. With coalesceChanges, the change sets of the groups
+    // keep collecting them until a view flushes them in its next polish, or
+    // asks for an item. Without a view, they are flushed when the event loop
+    // is returned to.
+    Q_Q(QQmlDelegateModel);
+    if (!m_coalesceChanges) {
+        emitChanges();
+        return;
+    }
+
+    if (m_changesPending)
+        return;
+    m_changesPending = true;
+
+    static const QMetaMethod changesPendingSignal
+            = QMetaMethod::fromSignal(&QQmlInstanceModel::changesPending);
+    if (q->isSignalConnected(changesPendingSignal))
+        emit q->changesPending();
+    else
+        QCoreApplication::postEvent(q, new QEvent(QEvent::UpdateLater));
+}
+
 void QQmlDelegateModelPrivate::emitChanges()
 {
-    if (m_transaction || !m_complete || !m_context || !m_context->isValid())
+    if (m_transaction) {
+        // The changes can't be emitted from within onUpdated. Try again once
+        // it has returned, as nothing else may ask for them.
+        if (m_changesPending)
+            QCoreApplication::postEvent(q_func(), new QEvent(QEvent::UpdateLater));
+        return;
+    }
+    if (!m_complete || !m_context || !m_context->isValid()) {
+        // componentComplete() emits what was collected until then. Let the
+        // next change schedule a flush again.
+        m_changesPending = false;
         return;
+    }
 
+    m_changesPending = false;
     m_transaction = true;
     QV4::ExecutionEngine *engine = m_context->engine()->handle();
     for (int i = 1; i < m_groupCount; ++i)
@@ -1989,6 +2334,7 @@ void QQmlDelegateModel::handleModelReset()
     d->m_adaptorModel.rootIndex = QModelIndex();
 
     if (d->m_complete) {
+        d->updateSortFilter();
         d->m_count = d->adaptorModelCount();
 
         const QList<QQmlDelegateModelItem *> cache = d->m_cache;
@@ -2028,7 +2374,11 @@ void QQmlDelegateModel::handleModelReset()
 void QQmlDelegateModel::_q_rowsInserted(const QModelIndex &parent, int begin, int end)
 {
     Q_D(QQmlDelegateModel);
-    if (parent == d->m_adaptorModel.rootIndex)
+    if (parent != d->m_adaptorModel.rootIndex)
+        return;
+    if (d->m_sortFilter.isActive())
+        sortFilterRowsInserted(begin, end - begin + 1);
+    else
         _q_itemsInserted(begin, end - begin + 1);
 }
 
@@ -2043,6 +2393,7 @@ void QQmlDelegateModel::_q_rowsAboutToBeRemoved(const QModelIndex &parent, int b
         d->m_count = 0;
         d->disconnectFromAbstractItemModel();
         d->m_adaptorModel.invalidateModel();
+        d->updateSortFilter();
 
         if (d->m_complete && oldCount > 0) {
             QVector<Compositor::Remove> removes;
@@ -2056,7 +2407,11 @@ void QQmlDelegateModel::_q_rowsAboutToBeRemoved(const QModelIndex &parent, int b
 void QQmlDelegateModel::_q_rowsRemoved(const QModelIndex &parent, int begin, int end)
 {
     Q_D(QQmlDelegateModel);
-    if (parent == d->m_adaptorModel.rootIndex)
+    if (parent != d->m_adaptorModel.rootIndex)
+        return;
+    if (d->m_sortFilter.isActive())
+        sortFilterRowsRemoved(begin, end - begin + 1);
+    else
         _q_itemsRemoved(begin, end - begin + 1);
 }
 
@@ -2066,12 +2421,23 @@ void QQmlDelegateModel::_q_rowsMoved(
 {
    Q_D(QQmlDelegateModel);
     const int count = sourceEnd - sourceStart + 1;
+    const bool sortFilter = d->m_sortFilter.isActive();
     if (destinationParent == d->m_adaptorModel.rootIndex && sourceParent == d->m_adaptorModel.rootIndex) {
-        _q_itemsMoved(sourceStart, sourceStart > destinationRow ? destinationRow : destinationRow - count, count);
+        const int to = sourceStart > destinationRow ? destinationRow : destinationRow - count;
+        if (sortFilter)
+            sortFilterRowsMoved(sourceStart, to, count);
+        else
+            _q_itemsMoved(sourceStart, to, count);
     } else if (sourceParent == d->m_adaptorModel.rootIndex) {
-        _q_itemsRemoved(sourceStart, count);
+        if (sortFilter)
+            sortFilterRowsRemoved(sourceStart, count);
+        else
+            _q_itemsRemoved(sourceStart, count);
     } else if (destinationParent == d->m_adaptorModel.rootIndex) {
-        _q_itemsInserted(destinationRow, count);
+        if (sortFilter)
+            sortFilterRowsInserted(destinationRow, count);
+        else
+            _q_itemsInserted(destinationRow, count);
     }
 }
 
@@ -2110,10 +2476,235 @@ void QQmlDelegateModel::_q_columnsMoved(const QModelIndex &parent, int start, in
 void QQmlDelegateModel::_q_dataChanged(const QModelIndex &begin, const QModelIndex &end, const QVector<int> &roles)
 {
     Q_D(QQmlDelegateModel);
-    if (begin.parent() == d->m_adaptorModel.rootIndex)
+    if (begin.parent() != d->m_adaptorModel.rootIndex)
+        return;
+    if (d->m_sortFilter.isActive())
+        sortFilterRowsChanged(begin.row(), end.row() - begin.row() + 1, roles);
+    else
         _q_itemsChanged(begin.row(), end.row() - begin.row() + 1, roles);
 }
 
+// Above this many items, moving items one by one to their sorted positions is
+// more expensive than removing and inserting them again.
+static constexpr qsizetype MaximumSortFilterMoves = 32;
+
+/*
+    The sortFilterRows functions translate changes of the source rows into
+    changes of the sorted and filtered rows, and pass them on to the
+    _q_items functions. The changes are collected in one transaction, so that
+    views receive a single, minimal change set.
+*/
+
+void QQmlDelegateModel::resetSortFilter()
+{
+    Q_D(QQmlDelegateModel);
+    if (!d->m_complete)
+        return;
+
+    _q_itemsRemoved(0, d->m_count);
+    d->updateSortFilter();
+    _q_itemsInserted(0, d->adaptorModelCount());
+    d->requestMoreIfNecessary();
+}
+
+void QQmlDelegateModel::insertSortFilterRows(const QList<int> &rows)
+{
+    Q_D(QQmlDelegateModel);
+    const QList<int> indexes = d->m_sortFilter.insertRows(rows);
+
+    // Each index is final once all items before it are inserted.
+    for (qsizetype begin = 0, count = indexes.size(); begin < count;) {
+        qsizetype end = begin + 1;
+        while (end < count && indexes.at(end) == indexes.at(end - 1) + 1)
+            ++end;
+        _q_itemsInserted(indexes.at(begin), int(end - begin));
+        begin = end;
+    }
+}
+
+void QQmlDelegateModel::removeSortFilterRows(const QList<int> &rows)
+{
+    Q_D(QQmlDelegateModel);
+    const QList<int> indexes = d->m_sortFilter.removeRows(rows);
+
+    // Remove from the back, so that the remaining indexes stay valid.
+    for (qsizetype end = indexes.size(); end > 0;) {
+        qsizetype begin = end - 1;
+        while (begin > 0 && indexes.at(begin - 1) == indexes.at(begin) - 1)
+            --begin;
+        _q_itemsRemoved(indexes.at(begin), int(end - begin));
+        end = begin;
+    }
+}
+
+void QQmlDelegateModel::moveSortFilterRows(const QList<int> &rows)
+{
+    Q_D(QQmlDelegateModel);
+    if (rows.isEmpty())
+        return;
+
+    if (rows.size() > MaximumSortFilterMoves) {
+        removeSortFilterRows(rows);
+        insertSortFilterRows(rows);
+        return;
+    }
+
+    QList<int> current = d->m_sortFilter.rows();
+    d->m_sortFilter.removeRows(rows);
+    const QList<int> indexes = d->m_sortFilter.insertRows(rows);
+    const QList<int> &sorted = d->m_sortFilter.rows();
+
+    // Move each item behind the one preceding it in the sorted order. Going by
+    // ascending index, that item is already in place when it's needed.
+    for (int index : indexes) {
+        const int from = int(current.indexOf(sorted.at(index)));
+        int to = index == 0 ? 0 : int(current.indexOf(sorted.at(index - 1))) + 1;
+        if (from < to)
+            --to;
+        if (from != to) {
+            current.move(from, to);
+            _q_itemsMoved(from, to, 1);
+        }
+    }
+    Q_ASSERT(current == sorted);
+}
+
+void QQmlDelegateModel::sortFilterRowsInserted(int begin, int count)
+{
+    Q_D(QQmlDelegateModel);
+    if (count <= 0 || !d->m_complete)
+        return;
+
+    QQmlDelegateModelSortFilter &sortFilter = d->m_sortFilter;
+    if (sortFilter.resolveRoles()) {
+        // ListModel only creates its roles with the first rows inserted.
+        resetSortFilter();
+        return;
+    }
+
+    const bool transaction = d->m_transaction;
+    d->m_transaction = true;
+
+    sortFilter.sourceRowsInserted(begin, count);
+    QList<int> rows;
+    for (int row = begin; row < begin + count; ++row) {
+        if (sortFilter.filterAcceptsRow(row))
+            rows.append(row);
+    }
+    insertSortFilterRows(rows);
+    d->updateSortFilterRows();
+
+    d->m_transaction = transaction;
+    d->emitModelChanges();
+}
+
+void QQmlDelegateModel::sortFilterRowsRemoved(int begin, int count)
+{
+    Q_D(QQmlDelegateModel);
+    if (count <= 0 || !d->m_complete)
+        return;
+
+    const bool transaction = d->m_transaction;
+    d->m_transaction = true;
+
+    QQmlDelegateModelSortFilter &sortFilter = d->m_sortFilter;
+    QList<int> rows;
+    for (int row = begin; row < begin + count; ++row) {
+        if (sortFilter.proxyIndex(row) != -1)
+            rows.append(row);
+    }
+    removeSortFilterRows(rows);
+    sortFilter.sourceRowsRemoved(begin, count);
+    d->updateSortFilterRows();
+
+    d->m_transaction = transaction;
+    d->emitModelChanges();
+}
+
+void QQmlDelegateModel::sortFilterRowsMoved(int from, int to, int count)
+{
+    Q_D(QQmlDelegateModel);
+    if (count <= 0 || !d->m_complete)
+        return;
+
+    const bool transaction = d->m_transaction;
+    d->m_transaction = true;
+
+    // Moving source rows only changes the order of items with equal sort keys.
+    QQmlDelegateModelSortFilter &sortFilter = d->m_sortFilter;
+    sortFilter.sourceRowsMoved(from, to, count);
+    QList<int> rows;
+    for (int row = to; row < to + count; ++row) {
+        if (sortFilter.proxyIndex(row) != -1)
+            rows.append(row);
+    }
+    moveSortFilterRows(rows);
+    d->updateSortFilterRows();
+
+    d->m_transaction = transaction;
+    d->emitModelChanges();
+}
+
+void QQmlDelegateModel::sortFilterRowsChanged(int begin, int count, const QVector<int> &roles)
+{
+    Q_D(QQmlDelegateModel);
+    if (count <= 0 || !d->m_complete)
+        return;
+
+    QQmlDelegateModelSortFilter &sortFilter = d->m_sortFilter;
+    if (sortFilter.resolveRoles()) {
+        // A role was only added to the model now.
+        resetSortFilter();
+        return;
+    }
+
+    const bool transaction = d->m_transaction;
+    d->m_transaction = true;
+
+    const bool sortKeyChanged = sortFilter.isSorted()
+            && (roles.isEmpty() || roles.contains(sortFilter.sortRoleId()));
+    const bool filterChanged = sortFilter.isFiltered()
+            && (roles.isEmpty() || roles.contains(sortFilter.filterRoleId()));
+
+    QList<int> inserted;
+    QList<int> removed;
+    QList<int> moved;
+    for (int row = begin; row < begin + count; ++row) {
+        const bool keyChanged = sortKeyChanged && sortFilter.updateSortKey(row);
+        const bool wasAccepted = sortFilter.proxyIndex(row) != -1;
+        const bool accepted = filterChanged ? sortFilter.filterAcceptsRow(row) : wasAccepted;
+        if (wasAccepted && !accepted)
+            removed.append(row);
+        else if (!wasAccepted && accepted)
+            inserted.append(row);
+        else if (accepted && keyChanged)
+            moved.append(row);
+    }
+
+    removeSortFilterRows(removed);
+    moveSortFilterRows(moved);
+    insertSortFilterRows(inserted);
+
+    QList<int> changed;
+    for (int row = begin; row < begin + count; ++row) {
+        const int index = sortFilter.proxyIndex(row);
+        if (index != -1 && !std::binary_search(inserted.cbegin(), inserted.cend(), row))
+            changed.append(index);
+    }
+    std::sort(changed.begin(), changed.end());
+    for (qsizetype first = 0, size = changed.size(); first < size;) {
+        qsizetype last = first + 1;
+        while (last < size && changed.at(last) == changed.at(last - 1) + 1)
+            ++last;
+        _q_itemsChanged(changed.at(first), int(last - first), roles);
+        first = last;
+    }
+    d->updateSortFilterRows();
+
+    d->m_transaction = transaction;
+    d->emitModelChanges();
+}
+
 bool QQmlDelegateModel::isDescendantOf(const QPersistentModelIndex& desc, const QList< QPersistentModelIndex >& parents) const
 {
     for (int i = 0, c = parents.size(); i < c; ++i) {
@@ -2137,8 +2728,13 @@ void QQmlDelegateModel::_q_layoutChanged(const QList<QPersistentModelIndex> &par
             return;
         }
 
-        // mark all items as changed
-        _q_itemsChanged(0, d->m_count, QVector<int>());
+        if (d->m_sortFilter.isActive()) {
+            // The source rows were reordered, so the mapping has to be built again
+            resetSortFilter();
+        } else {
+            // mark all items as changed
+            _q_itemsChanged(0, d->m_count, QVector<int>());
+        }
 
     } else if (hint == QAbstractItemModel::HorizontalSortHint) {
         // Ignored
@@ -3762,6 +4358,7 @@ bool QQmlPartsModel::isValid() const
 QObject *QQmlPartsModel::object(int index, QQmlIncubator::IncubationMode incubationMode)
 {
     QQmlDelegateModelPrivate *model = QQmlDelegateModelPrivate::get(m_model);
+    m_model->flushChanges();
 
     if (!model->m_delegate || index < 0 || index >= model->m_compositor.count(m_compositorGroup)) {
         qWarning() << "DelegateModel::item: index out range" << index << model->m_compositor.count(m_compositorGroup);
@@ -20,6 +20,8 @@
 #include <private/qqmlobjectmodel_p.h>
 #include <private/qqmlincubator_p.h>
 
+#include <QtQml/qjsvalue.h>
+
 #include <QtCore/qabstractitemmodel.h>
 #include <QtCore/qstringlist.h>
 
@@ -49,6 +51,18 @@ class Q_QMLMODELS_EXPORT QQmlDelegateModel : public QQmlInstanceModel, public QQ
     Q_PROPERTY(QVariant rootIndex READ rootIndex WRITE setRootIndex NOTIFY rootIndexChanged)
     Q_PROPERTY(DelegateModelAccess delegateModelAccess READ delegateModelAccess
             WRITE setDelegateModelAccess NOTIFY delegateModelAccessChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(QString sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged
+            REVISION(6, 10) FINAL)
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged
+            REVISION(6, 10) FINAL)
+    Q_PROPERTY(QJSValue sortComparator READ sortComparator WRITE setSortComparator
+            NOTIFY sortComparatorChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(QString filterRole READ filterRole WRITE setFilterRole NOTIFY filterRoleChanged
+            REVISION(6, 10) FINAL)
+    Q_PROPERTY(QJSValue filterPredicate READ filterPredicate WRITE setFilterPredicate
+            NOTIFY filterPredicateChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(bool coalesceChanges READ coalesceChanges WRITE setCoalesceChanges
+            NOTIFY coalesceChangesChanged REVISION(6, 10) FINAL)
     Q_CLASSINFO("DefaultProperty", "delegate")
     QML_NAMED_ELEMENT(DelegateModel)
     QML_ADDED_IN_VERSION(2, 1)
@@ -82,8 +96,27 @@ public:
     DelegateModelAccess delegateModelAccess() const;
     void setDelegateModelAccess(DelegateModelAccess delegateModelAccess);
 
+    QString sortRole() const;
+    void setSortRole(const QString &role);
+
+    Qt::SortOrder sortOrder() const;
+    void setSortOrder(Qt::SortOrder order);
+
+    QJSValue sortComparator() const;
+    void setSortComparator(const QJSValue &comparator);
+
+    QString filterRole() const;
+    void setFilterRole(const QString &role);
+
+    QJSValue filterPredicate() const;
+    void setFilterPredicate(const QJSValue &predicate);
+
+    bool coalesceChanges() const;
+    void setCoalesceChanges(bool coalesce);
+
     Q_INVOKABLE QVariant modelIndex(int idx) const;
     Q_INVOKABLE QVariant parentModelIndex() const;
+    Q_REVISION(6, 10) Q_INVOKABLE void invalidateSortFilter();
 
     int count() const override;
     bool isValid() const override { return delegate() != nullptr; }
@@ -96,6 +129,8 @@ public:
 
     void drainReusableItemsPool(int maxPoolTime) override;
     int poolSize() override;
+    void prefetch(int index, int count) override;
+    void flushChanges() override;
 
     int indexOf(QObject *object, QObject *objectContext) const override;
 
@@ -154,6 +189,12 @@ Q_SIGNALS:
     void rootIndexChanged();
     void delegateChanged();
     Q_REVISION(6, 10) void delegateModelAccessChanged();
+    Q_REVISION(6, 10) void sortRoleChanged();
+    Q_REVISION(6, 10) void sortOrderChanged();
+    Q_REVISION(6, 10) void sortComparatorChanged();
+    Q_REVISION(6, 10) void filterRoleChanged();
+    Q_REVISION(6, 10) void filterPredicateChanged();
+    Q_REVISION(6, 10) void coalesceChangesChanged();
 
 private Q_SLOTS:
     void _q_itemsChanged(int index, int count, const QVector<int> &roles);
@@ -173,6 +214,14 @@ private Q_SLOTS:
 
 private:
     void handleModelReset();
+    void sortFilterRowsInserted(int begin, int count);
+    void sortFilterRowsRemoved(int begin, int count);
+    void sortFilterRowsMoved(int from, int to, int count);
+    void sortFilterRowsChanged(int begin, int count, const QVector<int> &roles);
+    void insertSortFilterRows(const QList<int> &rows);
+    void removeSortFilterRows(const QList<int> &rows);
+    void moveSortFilterRows(const QList<int> &rows);
+    void resetSortFilter();
     bool isDescendantOf(const QPersistentModelIndex &desc, const QList<QPersistentModelIndex> &parents) const;
 
     Q_DISABLE_COPY(QQmlDelegateModel)
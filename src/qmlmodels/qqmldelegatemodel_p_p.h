@@ -11,6 +11,7 @@
 #include <QtQml/qqmlincubator.h>
 
 #include <private/qqmladaptormodel_p.h>
+#include <private/qqmldelegatemodelsortfilter_p.h>
 #include <private/qqmlopenmetaobject_p.h>
 
 #include <QtCore/qloggingcategory.h>
@@ -330,6 +331,7 @@ public:
             const QVector<Compositor::Remove> &removes, const QVector<Compositor::Insert> &inserts);
     void itemsChanged(const QVector<Compositor::Change> &changes);
     void emitChanges();
+    void emitModelChanges();
     void emitModelUpdated(const QQmlChangeSet &changeSet, bool reset) override;
     void delegateChanged(bool add = true, bool remove = true);
 
@@ -342,6 +344,19 @@ public:
 
     int adaptorModelCount() const;
 
+    bool canChangeSortFilter();
+    void updateSortFilter();
+    void updateSortFilterRows();
+    int sourceRow(int index) const
+    {
+        return m_sortFilter.isActive() ? m_sortFilter.sourceRow(index) : index;
+    }
+    // The source row of an item doesn't change when sorting or filtering moves it
+    int rowForIndex(const QQmlDelegateModelItem *item, int index) const
+    {
+        return m_sortFilter.isActive() ? item->modelRow() : index;
+    }
+
     static void group_append(QQmlListProperty<QQmlDelegateModelGroup> *property, QQmlDelegateModelGroup *group);
     static qsizetype group_count(QQmlListProperty<QQmlDelegateModelGroup> *property);
     static QQmlDelegateModelGroup *group_at(QQmlListProperty<QQmlDelegateModelGroup> *property, qsizetype index);
@@ -352,6 +367,7 @@ public:
 
     QQmlAdaptorModel m_adaptorModel;
     QQmlListCompositor m_compositor;
+    QQmlDelegateModelSortFilter m_sortFilter;
     QQmlStrongJSQObjectReference<QQmlComponent> m_delegate;
     QQmlAbstractDelegateComponent *m_delegateChooser;
     QMetaObject::Connection m_delegateChooserChanged;
@@ -377,6 +393,8 @@ public:
     bool m_transaction : 1;
     bool m_incubatorCleanupScheduled : 1;
     bool m_waitingToFetchMore : 1;
+    bool m_coalesceChanges : 1;
+    bool m_changesPending : 1;
 
     union {
         struct {
@@ -410,6 +428,7 @@ public:
     QList<QByteArray> watchedRoles() const { return m_watchedRoles; }
     void setWatchedRoles(const QList<QByteArray> &roles) override;
     QQmlIncubator::Status incubationStatus(int index) override;
+    void flushChanges() override { m_model->flushChanges(); }
 
     int indexOf(QObject *item, QObject *objectContext) const override;
 
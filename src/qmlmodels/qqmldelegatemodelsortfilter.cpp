@@ -0,0 +1,336 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qqmldelegatemodelsortfilter_p.h"
+
+#include <private/qqmladaptormodel_p.h>
+
+#include <QtQml/qjsengine.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+
+    Activates the mapping for \a model if a sort or filter role is set and
+    the model is a QAbstractItemModel, and sorts it. Otherwise the mapping is
+    cleared. Returns whether the mapping is active.
+
+    \a engine is used to call the sortComparator and filterPredicate functions.
+*/
+bool QQmlDelegateModelSortFilter::activate(const QQmlAdaptorModel *model, QJSEngine *engine)
+{
+    m_model = model;
+    m_engine = engine;
+    m_active = model && model->isValid() && model->adaptsAim() && (isSorted() || isFiltered());
+
+    m_sortRoleId = -1;
+    m_filterRoleId = -1;
+    if (m_active) {
+        resolveRoles();
+        sort();
+    } else {
+        m_rows.clear();
+        m_indexes.clear();
+        m_keys.clear();
+        m_dirtyFrom = std::numeric_limits<qsizetype>::max();
+    }
+    return m_active;
+}
+
+/*!
+    \internal
+
+    Looks up the ids of the sort and filter roles. Models such as ListModel
+    only create their roles when the first rows are added, so this is retried
+    while a role is unresolved. Returns \c true if any role id changed, in
+    which case the mapping has to be sorted again.
+*/
+bool QQmlDelegateModelSortFilter::resolveRoles()
+{
+    if ((!isSorted() || m_sortRoleId != -1) && (!isFiltered() || m_filterRoleId != -1))
+        return false;
+
+    const QHash<int, QByteArray> roleNames = m_model->aim()->roleNames();
+    const auto roleId = [&roleNames](const QString &role) {
+        return role.isEmpty() ? -1 : roleNames.key(role.toUtf8(), -1);
+    };
+
+    const int sortRoleId = roleId(sortRole);
+    const int filterRoleId = roleId(filterRole);
+    if (sortRoleId == m_sortRoleId && filterRoleId == m_filterRoleId)
+        return false;
+
+    m_sortRoleId = sortRoleId;
+    m_filterRoleId = filterRoleId;
+    return true;
+}
+
+/*!
+    \internal
+
+    Rebuilds the mapping from scratch.
+*/
+void QQmlDelegateModelSortFilter::sort()
+{
+    const QAbstractItemModel *aim = m_model->aim();
+    const int count = aim->rowCount(m_model->rootIndex);
+
+    m_keys.clear();
+    if (isSorted()) {
+        m_keys.reserve(count);
+        for (int row = 0; row < count; ++row)
+            m_keys.append(data(row, m_sortRoleId));
+    }
+
+    m_rows.clear();
+    m_rows.reserve(count);
+    for (int row = 0; row < count; ++row) {
+        if (filterAcceptsRow(row))
+            m_rows.append(row);
+    }
+
+    // A comparator function may not be consistent, which std::sort doesn't tolerate.
+    if (isSorted()) {
+        std::stable_sort(m_rows.begin(), m_rows.end(), [this](int lhs, int rhs) {
+            return lessThan(lhs, rhs);
+        });
+    }
+
+    m_indexes.fill(-1, count);
+    m_dirtyFrom = 0;
+}
+
+QVariant QQmlDelegateModelSortFilter::data(int sourceRow, int role) const
+{
+    if (role == -1)
+        return QVariant();
+    const QAbstractItemModel *aim = m_model->aim();
+    return aim->data(aim->index(sourceRow, 0, m_model->rootIndex), role);
+}
+
+/*!
+    \internal
+
+    Returns whether the filter accepts \a sourceRow. Without a filterPredicate
+    a row is accepted if the value of its filter role converts to \c true.
+*/
+bool QQmlDelegateModelSortFilter::filterAcceptsRow(int sourceRow)
+{
+    if (!isFiltered())
+        return true;
+
+    const QVariant value = data(sourceRow, m_filterRoleId);
+    if (!filterPredicate.isCallable() || !m_engine)
+        return value.toBool();
+    return filterPredicate.call({ m_engine->toScriptValue(value) }).toBool();
+}
+
+/*!
+    \internal
+
+    Fetches the sort key of \a sourceRow again and returns whether it changed.
+*/
+bool QQmlDelegateModelSortFilter::updateSortKey(int sourceRow)
+{
+    if (!isSorted())
+        return false;
+
+    QVariant key = data(sourceRow, m_sortRoleId);
+    if (key == m_keys.at(sourceRow))
+        return false;
+    m_keys[sourceRow] = std::move(key);
+    return true;
+}
+
+int QQmlDelegateModelSortFilter::compare(const QVariant &lhs, const QVariant &rhs)
+{
+    if (sortComparator.isCallable() && m_engine) {
+        const double result = sortComparator.call({
+                m_engine->toScriptValue(lhs), m_engine->toScriptValue(rhs) }).toNumber();
+        return result < 0 ? -1 : (result > 0 ? 1 : 0);
+    }
+
+    if (lhs.isValid() != rhs.isValid())
+        return lhs.isValid() ? 1 : -1;
+
+    const QPartialOrdering order = QVariant::compare(lhs, rhs);
+    if (order == QPartialOrdering::Less)
+        return -1;
+    if (order == QPartialOrdering::Greater)
+        return 1;
+    return 0;
+}
+
+/*!
+    \internal
+
+    Returns whether \a lhsRow is placed before \a rhsRow. Rows with equal keys
+    keep their source order, independently of the sortOrder.
+*/
+bool QQmlDelegateModelSortFilter::lessThan(int lhsRow, int rhsRow)
+{
+    if (isSorted()) {
+        int result = compare(m_keys.at(lhsRow), m_keys.at(rhsRow));
+        if (sortOrder == Qt::DescendingOrder)
+            result = -result;
+        if (result != 0)
+            return result < 0;
+    }
+    return lhsRow < rhsRow;
+}
+
+void QQmlDelegateModelSortFilter::updateIndexes() const
+{
+    for (qsizetype i = m_dirtyFrom, count = m_rows.size(); i < count; ++i)
+        m_indexes[m_rows.at(i)] = int(i);
+    m_dirtyFrom = std::numeric_limits<qsizetype>::max();
+}
+
+/*!
+    \internal
+
+    Adds the accepted \a sourceRows, which must not be mapped yet, to the
+    mapping. Each row is placed by a binary search in the rows that follow the
+    previously placed one. Returns the new indexes of the rows in ascending
+    order.
+*/
+QList<int> QQmlDelegateModelSortFilter::insertRows(QList<int> sourceRows)
+{
+    if (sourceRows.isEmpty())
+        return QList<int>();
+
+    const auto less = [this](int lhs, int rhs) { return lessThan(lhs, rhs); };
+    std::stable_sort(sourceRows.begin(), sourceRows.end(), less);
+
+    QList<int> rows;
+    rows.reserve(m_rows.size() + sourceRows.size());
+    QList<int> indexes;
+    indexes.reserve(sourceRows.size());
+
+    auto it = m_rows.cbegin();
+    for (int sourceRow : std::as_const(sourceRows)) {
+        const auto position = std::lower_bound(it, m_rows.cend(), sourceRow, less);
+        std::copy(it, position, std::back_inserter(rows));
+        indexes.append(int(rows.size()));
+        rows.append(sourceRow);
+        it = position;
+    }
+    std::copy(it, m_rows.cend(), std::back_inserter(rows));
+
+    m_rows = std::move(rows);
+    invalidateIndexes(indexes.first());
+    return indexes;
+}
+
+/*!
+    \internal
+
+    Removes the mapped \a sourceRows from the mapping and returns the indexes
+    they had in ascending order.
+*/
+QList<int> QQmlDelegateModelSortFilter::removeRows(const QList<int> &sourceRows)
+{
+    QList<int> indexes;
+    indexes.reserve(sourceRows.size());
+    for (int sourceRow : sourceRows) {
+        const int index = proxyIndex(sourceRow);
+        Q_ASSERT(index != -1);
+        indexes.append(index);
+        m_indexes[sourceRow] = -1;
+    }
+    if (indexes.isEmpty())
+        return indexes;
+
+    std::sort(indexes.begin(), indexes.end());
+
+    qsizetype to = indexes.first();
+    auto removed = indexes.cbegin();
+    for (qsizetype from = to, count = m_rows.size(); from < count; ++from) {
+        if (removed != indexes.cend() && *removed == from)
+            ++removed;
+        else
+            m_rows[to++] = m_rows.at(from);
+    }
+    m_rows.resize(to);
+
+    invalidateIndexes(indexes.first());
+    return indexes;
+}
+
+/*!
+    \internal
+
+    Makes room for \a count new source rows at \a begin. The new rows are not
+    mapped until they are passed to insertRows().
+*/
+void QQmlDelegateModelSortFilter::sourceRowsInserted(int begin, int count)
+{
+    for (int &row : m_rows) {
+        if (row >= begin)
+            row += count;
+    }
+    m_indexes.insert(begin, count, -1);
+
+    if (isSorted()) {
+        m_keys.insert(begin, count, QVariant());
+        for (int row = begin; row < begin + count; ++row)
+            m_keys[row] = data(row, m_sortRoleId);
+    }
+}
+
+/*!
+    \internal
+
+    Drops \a count source rows at \a begin, which must have been removed from
+    the mapping with removeRows() already.
+*/
+void QQmlDelegateModelSortFilter::sourceRowsRemoved(int begin, int count)
+{
+    for (int &row : m_rows) {
+        Q_ASSERT(row < begin || row >= begin + count);
+        if (row >= begin + count)
+            row -= count;
+    }
+    m_indexes.remove(begin, count);
+    if (isSorted())
+        m_keys.remove(begin, count);
+}
+
+/*!
+    \internal
+
+    Renumbers the source rows after \a count rows moved from \a from to \a to,
+    where \a to is the position of the first row after the move. The mapped
+    order is left as it is; the moved rows have to be placed again.
+*/
+void QQmlDelegateModelSortFilter::sourceRowsMoved(int from, int to, int count)
+{
+    if (from == to || count <= 0)
+        return;
+
+    for (int &row : m_rows) {
+        if (row >= from && row < from + count)
+            row += to - from;
+        else if (from < to && row >= from + count && row < to + count)
+            row -= count;
+        else if (from > to && row >= to && row < from)
+            row += count;
+    }
+
+    const auto rotate = [from, to, count](auto &list) {
+        if (from < to)
+            std::rotate(list.begin() + from, list.begin() + from + count, list.begin() + to + count);
+        else
+            std::rotate(list.begin() + to, list.begin() + from, list.begin() + from + count);
+    };
+    rotate(m_indexes);
+    if (isSorted())
+        rotate(m_keys);
+}
+
+QT_END_NAMESPACE
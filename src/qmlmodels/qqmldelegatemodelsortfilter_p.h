@@ -0,0 +1,113 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQMLDELEGATEMODELSORTFILTER_P_H
+#define QQMLDELEGATEMODELSORTFILTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtqmlmodelsglobal_p.h>
+
+#include <QtQml/qjsvalue.h>
+
+#include <QtCore/qlist.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvariant.h>
+
+QT_REQUIRE_CONFIG(qml_delegate_model);
+
+QT_BEGIN_NAMESPACE
+
+class QJSEngine;
+class QQmlAdaptorModel;
+
+/*!
+    \internal
+
+    Maps the rows of a QAbstractItemModel adapted by a QQmlDelegateModel to
+    the sorted and filtered order presented to the compositor.
+
+    Rows are ordered by the value of the sort role, and then by source row,
+    so that the order is total and new rows can be placed by binary search.
+    The mapping is only updated here; QQmlDelegateModel translates each
+    change into the matching compositor operations.
+*/
+class Q_AUTOTEST_EXPORT QQmlDelegateModelSortFilter
+{
+public:
+    bool isActive() const { return m_active; }
+    bool isSorted() const { return !sortRole.isEmpty(); }
+    bool isFiltered() const { return !filterRole.isEmpty(); }
+
+    bool activate(const QQmlAdaptorModel *model, QJSEngine *engine);
+    bool resolveRoles();
+    void sort();
+
+    int sortRoleId() const { return m_sortRoleId; }
+    int filterRoleId() const { return m_filterRoleId; }
+
+    int count() const { return int(m_rows.size()); }
+    const QList<int> &rows() const { return m_rows; }
+
+    int sourceRow(int index) const
+    {
+        return index >= 0 && index < m_rows.size() ? m_rows.at(index) : -1;
+    }
+
+    int proxyIndex(int sourceRow) const
+    {
+        if (sourceRow < 0 || sourceRow >= m_indexes.size())
+            return -1;
+        if (m_dirtyFrom < m_rows.size())
+            updateIndexes();
+        return m_indexes.at(sourceRow);
+    }
+
+    bool filterAcceptsRow(int sourceRow);
+    bool updateSortKey(int sourceRow);
+    bool lessThan(int lhsRow, int rhsRow);
+
+    QList<int> insertRows(QList<int> sourceRows);
+    QList<int> removeRows(const QList<int> &sourceRows);
+
+    void sourceRowsInserted(int begin, int count);
+    void sourceRowsRemoved(int begin, int count);
+    void sourceRowsMoved(int from, int to, int count);
+
+    QString sortRole;
+    QString filterRole;
+    QJSValue sortComparator;
+    QJSValue filterPredicate;
+    Qt::SortOrder sortOrder = Qt::AscendingOrder;
+
+private:
+    QVariant data(int sourceRow, int role) const;
+    int compare(const QVariant &lhs, const QVariant &rhs);
+    void invalidateIndexes(int from) { m_dirtyFrom = qMin(m_dirtyFrom, from); }
+    void updateIndexes() const;
+
+    const QQmlAdaptorModel *m_model = nullptr;
+    QJSEngine *m_engine = nullptr;
+
+    QList<int> m_rows;              // proxy index -> source row
+    mutable QList<int> m_indexes;   // source row -> proxy index, or -1 if filtered out
+    QList<QVariant> m_keys;         // source row -> sort key
+    mutable qsizetype m_dirtyFrom = 0;
+
+    int m_sortRoleId = -1;
+    int m_filterRoleId = -1;
+    bool m_active = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQMLDELEGATEMODELSORTFILTER_P_H
@@ -27,7 +27,7 @@ int QQmlDMAbstractItemModelData::metaCall(QMetaObject::Call call, int id, void *
             if (!m_cachedData.isEmpty())
                 *static_cast<QVariant *>(arguments[0]) = m_cachedData.at(propertyIndex);
         } else  if (*m_type->model) {
-            *static_cast<QVariant *>(arguments[0]) = value(m_type->propertyRoles.at(propertyIndex));
+            *static_cast<QVariant *>(arguments[0]) = value(propertyIndex);
         }
         return -1;
     } else if (call == QMetaObject::WriteProperty && id >= m_type->propertyOffset) {
@@ -109,8 +109,7 @@ QV4::ReturnedValue QQmlDMAbstractItemModelData::get_property(const QV4::Function
         if (!modelData->m_cachedData.isEmpty())
             return scope.engine->fromVariant(modelData->m_cachedData.at(propertyId));
     } else if (*modelData->m_type->model) {
-        return scope.engine->fromVariant(
-                modelData->value(modelData->m_type->propertyRoles.at(propertyId)));
+        return scope.engine->fromVariant(modelData->value(propertyId));
     }
     return QV4::Encode::undefined();
 }
@@ -183,7 +182,7 @@ QVariant QQmlDMAbstractItemModelData::modelData() const
         // If the model has only a single role, the modelData is that role.
         return index == -1
                 ? m_cachedData.isEmpty() ? QVariant() : m_cachedData[0]
-                : value(m_type->propertyRoles[0]);
+                : value(0);
     }
 
     return useStructuredModelData
@@ -221,17 +220,105 @@ bool QQmlDMAbstractItemModelData::hasModelChildren() const
     return false;
 }
 
-QVariant QQmlDMAbstractItemModelData::value(int role) const
+QVariant QQmlDMAbstractItemModelData::value(int propertyId) const
 {
-    if (const QAbstractItemModel *aim = m_type->model->aim())
-        return aim->index(row, column, m_type->model->rootIndex).data(role);
-    return QVariant();
+    const QAbstractItemModel *aim = m_type->model->aim();
+    if (!aim)
+        return QVariant();
+
+    const qsizetype propertyCount = m_type->propertyRoles.size();
+    if (m_fetchedRoles.size() != propertyCount) {
+        m_fetchedRoles.fill(false, propertyCount);
+        m_fetchedData.resize(propertyCount);
+    }
+
+    if (!m_fetchedRoles.testBit(propertyId) && m_fetchedRoles.count(true) == 0) {
+        // The view may have prefetched the row before creating this item.
+        m_type->takePrefetchedRow(aim->index(row, column, m_type->model->rootIndex),
+                                  &m_fetchedData, &m_fetchedRoles);
+    }
+
+    if (!m_fetchedRoles.testBit(propertyId)) {
+        // Delegates of the same type read the same roles, so remember which
+        // ones they need, and fetch them all when the first one is read.
+        m_type->usedRoles.setBit(propertyId);
+        fetchUsedRoles(aim);
+    }
+    return m_fetchedData.at(propertyId);
+}
+
+void QQmlDMAbstractItemModelData::fetchUsedRoles(const QAbstractItemModel *aim) const
+{
+    const QModelIndex modelIndex = aim->index(row, column, m_type->model->rootIndex);
+    if (!modelIndex.isValid()) {
+        m_fetchedData.fill(QVariant());
+        return;
+    }
+
+    QVarLengthArray<QModelRoleData, 16> roleData;
+    QVarLengthArray<int, 16> propertyIds;
+    for (int propertyId = 0, count = m_type->propertyRoles.size(); propertyId < count; ++propertyId) {
+        if (m_type->usedRoles.testBit(propertyId) && !m_fetchedRoles.testBit(propertyId)) {
+            roleData.emplace_back(m_type->propertyRoles.at(propertyId));
+            propertyIds.append(propertyId);
+        }
+    }
+
+    // A single role gains nothing from a span, so it is asked for directly.
+    if (propertyIds.size() == 1) {
+        const int propertyId = propertyIds.first();
+        m_fetchedData[propertyId] = aim->data(modelIndex, m_type->propertyRoles.at(propertyId));
+        m_fetchedRoles.setBit(propertyId);
+        return;
+    }
+
+    aim->multiData(modelIndex, roleData);
+
+    for (qsizetype i = 0; i < propertyIds.size(); ++i) {
+        m_fetchedData[propertyIds.at(i)] = std::move(roleData[i].data());
+        m_fetchedRoles.setBit(propertyIds.at(i));
+    }
+}
+
+/*!
+    \internal
+
+    Drops the fetched values of \a roles, or of all roles if \a roles is
+    empty, so that they are fetched again the next time they are read.
+*/
+void QQmlDMAbstractItemModelData::invalidateFetchedData(const QVector<int> &roles)
+{
+    if (m_fetchedRoles.isEmpty())
+        return;
+
+    if (roles.isEmpty()) {
+        m_fetchedRoles.fill(false);
+        return;
+    }
+
+    for (int role : roles) {
+        const qsizetype propertyId = m_type->propertyRoles.indexOf(role);
+        if (propertyId != -1 && propertyId < m_fetchedRoles.size())
+            m_fetchedRoles.clearBit(propertyId);
+    }
+}
+
+void QQmlDMAbstractItemModelData::setModelIndex(int idx, int newRow, int newColumn, bool alwaysEmit)
+{
+    // A moved or reused item shows another row, whose values have to be
+    // fetched anew.
+    if (newRow != row || newColumn != column)
+        invalidateFetchedData({});
+    QQmlDelegateModelItem::setModelIndex(idx, newRow, newColumn, alwaysEmit);
 }
 
 void QQmlDMAbstractItemModelData::setValue(int role, const QVariant &value)
 {
-    if (QAbstractItemModel *aim = m_type->model->aim())
+    if (QAbstractItemModel *aim = m_type->model->aim()) {
         aim->setData(aim->index(row, column, m_type->model->rootIndex), value, role);
+        // The model may not have accepted the value as it is.
+        invalidateFetchedData({ role });
+    }
 }
 
 QV4::ReturnedValue QQmlDMAbstractItemModelData::get()
@@ -19,6 +19,10 @@
 #include <private/qqmldelegatemodel_p_p.h>
 #include <private/qobject_p.h>
 
+#include <QtCore/qbitarray.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qvarlengtharray.h>
+
 QT_BEGIN_NAMESPACE
 
 class VDMAbstractItemModelDataType;
@@ -61,15 +65,24 @@ public:
 
     const VDMAbstractItemModelDataType *type() const { return m_type; }
 
+    void invalidateFetchedData(const QVector<int> &roles);
+    void setModelIndex(int idx, int newRow, int newColumn, bool alwaysEmit = false) override;
+
 Q_SIGNALS:
     void modelDataChanged();
 
 private:
-    QVariant value(int role) const;
+    QVariant value(int propertyId) const;
     void setValue(int role, const QVariant &value);
+    void fetchUsedRoles(const QAbstractItemModel *aim) const;
 
     VDMAbstractItemModelDataType *m_type;
     QVector<QVariant> m_cachedData;
+
+    // The values of the roles of the model row, once fetched. All roles any
+    // delegate has read so far are fetched together, with one multiData() call.
+    mutable QVector<QVariant> m_fetchedData;
+    mutable QBitArray m_fetchedRoles;
 };
 
 class VDMAbstractItemModelDataType final
@@ -130,6 +143,10 @@ public:
                 signalIndexes.append(propertyId + signalOffset);
         }
 
+        // Prefetched rows are few and short-lived; drop them rather than
+        // finding the ones in the changed range.
+        prefetchedRows.clear();
+
         QVarLengthArray<QQmlGuard<QQmlDMAbstractItemModelData>> guardedItems;
         for (const auto item : items) {
             Q_ASSERT(qobject_cast<QQmlDMAbstractItemModelData *>(item) == item);
@@ -141,8 +158,10 @@ public:
                 continue;
 
             const int idx = item->modelIndex();
-            if (idx >= index && idx < index + count)
+            if (idx >= index && idx < index + count) {
+                item->invalidateFetchedData(roles);
                 notifyItem(item, signalIndexes);
+            }
         }
         return changed;
     }
@@ -172,7 +191,7 @@ public:
         if (o->d()->item->modelIndex() >= 0) {
             if (const QAbstractItemModel *const aim = model->aim())
                 RETURN_RESULT(QV4::Encode(aim->hasChildren(
-                        aim->index(o->d()->item->modelIndex(), 0, model->rootIndex))));
+                        aim->index(o->d()->item->modelRow(), 0, model->rootIndex))));
         }
         RETURN_RESULT(QV4::Encode(false));
     }
@@ -301,6 +320,65 @@ public:
             aim->fetchMore(model.rootIndex);
     }
 
+    void prefetch(QQmlAdaptorModel &model, int index, int count) const override
+    {
+        // The roles are only known once the first delegate has been created.
+        const QAbstractItemModel *aim = model.aim();
+        if (!aim || !metaObject || propertyRoles.isEmpty())
+            return;
+
+        // Ask for the roles the delegates use, or all roles if none were read
+        // yet, in one call, so that models which load their data lazily can
+        // start doing so before the delegate needs it.
+        const bool anyRoleUsed = usedRoles.count(true) > 0;
+        QVarLengthArray<int, 16> propertyIds;
+        for (int propertyId = 0; propertyId < propertyRoles.size(); ++propertyId) {
+            if (!anyRoleUsed || usedRoles.testBit(propertyId))
+                propertyIds.append(propertyId);
+        }
+
+        QVarLengthArray<QModelRoleData, 16> roleData;
+        for (int i = index, end = qMin(index + count, model.count()); i < end; ++i) {
+            const QModelIndex modelIndex
+                    = aim->index(model.rowAt(i), model.columnAt(i), model.rootIndex);
+            if (!modelIndex.isValid())
+                continue;
+            const QPersistentModelIndex key(modelIndex);
+            if (prefetchedRows.contains(key))
+                continue;
+
+            roleData.clear();
+            for (int propertyId : std::as_const(propertyIds))
+                roleData.emplace_back(propertyRoles.at(propertyId));
+            aim->multiData(modelIndex, roleData);
+
+            auto *prefetched = new PrefetchedRow;
+            prefetched->data.resize(propertyRoles.size());
+            prefetched->roles.resize(propertyRoles.size());
+            for (qsizetype j = 0; j < propertyIds.size(); ++j) {
+                prefetched->data[propertyIds.at(j)] = std::move(roleData[j].data());
+                prefetched->roles.setBit(propertyIds.at(j));
+            }
+            prefetchedRows.insert(key, prefetched);
+        }
+    }
+
+    // Hands the role values that were prefetched for the row at modelIndex
+    // over to the item that was created for it.
+    bool takePrefetchedRow(const QModelIndex &modelIndex, QVector<QVariant> *data,
+                           QBitArray *roles) const
+    {
+        if (prefetchedRows.isEmpty() || !modelIndex.isValid())
+            return false;
+        const std::unique_ptr<PrefetchedRow> prefetched(
+                    prefetchedRows.take(QPersistentModelIndex(modelIndex)));
+        if (!prefetched || prefetched->data.size() != propertyRoles.size())
+            return false;
+        *data = std::move(prefetched->data);
+        *roles = std::move(prefetched->roles);
+        return true;
+    }
+
     QQmlDelegateModelItem *createItem(
             QQmlAdaptorModel &model,
             const QQmlRefPointer<QQmlDelegateModelItemMetaType> &metaType,
@@ -328,6 +406,8 @@ public:
                     model.delegateModelAccess != QQmlDelegateModel::ReadOnly);
         }
 
+        usedRoles.resize(propertyRoles.size());
+
         metaObject.reset(builder.toMetaObject());
         *static_cast<QMetaObject *>(this) = *metaObject;
         propertyCache = QQmlPropertyCache::createStandalone(
@@ -336,6 +416,17 @@ public:
 
     QV4::PersistentValue prototype;
     QList<int> propertyRoles;
+    QBitArray usedRoles;    // the properties any delegate has read, by property id
+
+    // The role values of rows that were prefetched before a delegate was
+    // created for them, by model index. The least recently prefetched rows
+    // are dropped once there are more than a few view's worth of them.
+    struct PrefetchedRow
+    {
+        QVector<QVariant> data;
+        QBitArray roles;
+    };
+    mutable QCache<QPersistentModelIndex, PrefetchedRow> prefetchedRows { 256 };
     QList<int> watchedRoleIds;
     QList<QByteArray> watchedRoles;
     QHash<QByteArray, int> roleNames;
@@ -30,8 +30,12 @@
 #include <QtCore/qstack.h>
 #include <QXmlStreamReader>
 #include <QtCore/qdatetime.h>
+#include <QtCore/qurl.h>
 #include <QScopedValueRollback>
 
+#include <algorithm>
+#include <cstring>
+
 Q_DECLARE_METATYPE(const QV4::CompiledData::Binding*);
 
 QT_BEGIN_NAMESPACE
@@ -203,7 +207,7 @@ ListLayout::Role::~Role()
     delete subLayout;
 }
 
-const ListLayout::Role *ListLayout::getRoleOrCreate(const QString &key, const QVariant &data)
+ListLayout::Role::DataType ListLayout::roleType(const QVariant &data)
 {
     Role::DataType type;
 
@@ -234,6 +238,12 @@ const ListLayout::Role *ListLayout::getRoleOrCreate(const QString &key, const QV
         }
     }
 
+    return type;
+}
+
+const ListLayout::Role *ListLayout::getRoleOrCreate(const QString &key, const QVariant &data)
+{
+    const Role::DataType type = roleType(data);
     if (type == Role::Invalid) {
         qmlWarning(nullptr) << "Can't create role for unsupported data type";
         return nullptr;
@@ -315,27 +325,427 @@ void StringOrTranslation::clear()
     binding = nullptr;
 }
 
+static QObject *createModelObject(QQmlListModel *model, int elementIndex)
+{
+    void *memory = operator new(sizeof(QObject) + sizeof(QQmlData));
+    void *ddataMemory = ((char *)memory) + sizeof(QObject);
+    QObject *object = new (memory) QObject;
+
+    const QAbstractDeclarativeData *old = std::exchange(
+        QObjectPrivate::get(object)->declarativeData,
+        new (ddataMemory) QQmlData(QQmlData::DoesNotOwnMemory));
+    Q_ASSERT(!old); // QObject should really not manipulate QQmlData
+
+    (void)new ModelNodeMetaObject(object, model, elementIndex);
+    return object;
+}
+
+static void destroyModelObject(QObject *object)
+{
+    object->~QObject();
+    operator delete(object);
+}
+
+// Strings and URLs share the string pool. Id 0 is the empty string / unset URL.
+// Date-times are biased so that a zero cell stays distinguishable from the epoch.
+static constexpr quint64 DateTimeBias = Q_UINT64_C(1) << 62;
+
+bool ListColumns::supportsType(ListLayout::Role::DataType type)
+{
+    switch (type) {
+    case ListLayout::Role::String:
+    case ListLayout::Role::Number:
+    case ListLayout::Role::Bool:
+    case ListLayout::Role::DateTime:
+    case ListLayout::Role::Url:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ListColumns::insertRows(int index, int count)
+{
+    Q_ASSERT(index >= 0 && index <= m_rowCount && count >= 0);
+    for (QVector<quint64> &column : m_columns)
+        column.insert(index, count, 0);
+    if (!m_objectCaches.isEmpty())
+        m_objectCaches.insert(index, count, nullptr);
+    m_rowCount += count;
+}
+
+QVector<QObject *> ListColumns::removeRows(int index, int count)
+{
+    Q_ASSERT(index >= 0 && count >= 0 && index + count <= m_rowCount);
+    for (qsizetype c = 0; c < m_columns.size(); ++c) {
+        QVector<quint64> &column = m_columns[c];
+        if (m_pooledColumns.at(c) && m_rowCount != count) {
+            for (int i = index; i < index + count; ++i)
+                release(column.at(i));
+        }
+        column.remove(index, count);
+    }
+
+    QVector<QObject *> removedCaches;
+    if (!m_objectCaches.isEmpty()) {
+        for (int i = index; i < index + count; ++i) {
+            if (QObject *object = m_objectCaches.at(i))
+                removedCaches.append(object);
+        }
+        m_objectCaches.remove(index, count);
+    }
+
+    m_rowCount -= count;
+    if (m_rowCount == 0) {
+        // Nothing refers to the pooled strings anymore
+        m_strings.clear();
+        m_stringIds.clear();
+        m_freeStringIds.clear();
+        m_objectCaches.clear();
+    }
+    return removedCaches;
+}
+
+// Only move forwards - flip if backwards moving
+static void normalizeMove(int *from, int *to, int *n)
+{
+    if (*from > *to) {
+        const int tfrom = *from;
+        const int tto = *to;
+        *from = tto;
+        *to = tto + *n;
+        *n = tfrom - tto;
+    }
+}
+
+// Same convention as ListModel::move() after normalization: rows [from, from + n)
+// end up after rows [from + n, to + n).
+template<typename Container>
+static void rotateRows(Container &container, int from, int to, int n)
+{
+    std::rotate(container.begin() + from, container.begin() + from + n, container.begin() + to + n);
+}
+
+void ListColumns::moveRows(int from, int to, int n)
+{
+    Q_ASSERT(from < to && to + n <= m_rowCount);
+    for (QVector<quint64> &column : m_columns)
+        rotateRows(column, from, to, n);
+    if (!m_objectCaches.isEmpty())
+        rotateRows(m_objectCaches, from, to, n);
+}
+
+void ListColumns::copyValues(const ListColumns &other)
+{
+    m_columns = other.m_columns;
+    m_pooledColumns = other.m_pooledColumns;
+    m_strings = other.m_strings;
+    m_stringIds = other.m_stringIds;
+    m_freeStringIds = other.m_freeStringIds;
+    m_rowCount = other.m_rowCount;
+    if (!m_objectCaches.isEmpty())
+        m_objectCaches.resize(m_rowCount, nullptr);
+}
+
+QVector<int> ListColumns::changedColumns(int row, const ListColumns &other, int otherRow) const
+{
+    QVector<int> changed;
+    const qsizetype columnCount = qMax(m_columns.size(), other.m_columns.size());
+    for (qsizetype c = 0; c < columnCount; ++c) {
+        const quint64 cell = c < m_columns.size() ? m_columns.at(c).at(row) : 0;
+        const quint64 otherCell = c < other.m_columns.size() ? other.m_columns.at(c).at(otherRow) : 0;
+        // Both sides have their own string pool, so pooled cells are compared by string
+        const bool pooled = (c < m_pooledColumns.size() && m_pooledColumns.at(c))
+                || (c < other.m_pooledColumns.size() && other.m_pooledColumns.at(c));
+        const bool equal = (pooled && cell && otherCell)
+                ? m_strings.at(cell - 1).string == other.m_strings.at(otherCell - 1).string
+                : cell == otherCell;
+        if (!equal)
+            changed.append(int(c));
+    }
+    return changed;
+}
+
+QVector<int> ListColumns::copyRow(int row, const ListColumns &other, int otherRow)
+{
+    QVector<int> changed;
+    const qsizetype columnCount = qMax(m_columns.size(), other.m_columns.size());
+    for (qsizetype c = 0; c < columnCount; ++c) {
+        const quint64 otherCell = c < other.m_columns.size() ? other.m_columns.at(c).at(otherRow) : 0;
+        const bool pooled = c < other.m_pooledColumns.size()
+                ? other.m_pooledColumns.at(c)
+                : c < m_pooledColumns.size() && m_pooledColumns.at(c);
+        const quint64 cell = pooled && otherCell
+                ? intern(other.m_strings.at(otherCell - 1).string)
+                : otherCell;
+        if (setCell(row, int(c), pooled, cell))
+            changed.append(int(c));
+    }
+    return changed;
+}
+
+QVariant ListColumns::value(int row, const ListLayout::Role &role) const
+{
+    const quint64 cell = role.index < m_columns.size() ? m_columns.at(role.index).at(row) : 0;
+
+    switch (role.type) {
+    case ListLayout::Role::Number: {
+        double d;
+        std::memcpy(&d, &cell, sizeof(d));
+        return d;
+    }
+    case ListLayout::Role::Bool:
+        return cell != 0;
+    case ListLayout::Role::String:
+        if (cell) {
+            // An empty string that was set stays distinguishable from an unset one
+            const QString &string = m_strings.at(cell - 1).string;
+            return string.isEmpty() ? QStringLiteral("") : string;
+        }
+        return QString();
+    case ListLayout::Role::DateTime:
+        if (cell)
+            return QDateTime::fromMSecsSinceEpoch(qint64(cell - DateTimeBias));
+        break;
+    case ListLayout::Role::Url:
+        if (cell)
+            return QUrl(m_strings.at(cell - 1).string);
+        break;
+    default:
+        break;
+    }
+
+    return QVariant();
+}
+
+bool ListColumns::setValue(int row, const ListLayout::Role &role, const QVariant &value)
+{
+    switch (role.type) {
+    case ListLayout::Role::Number: {
+        const double d = value.toDouble();
+        quint64 cell;
+        std::memcpy(&cell, &d, sizeof(cell));
+        return setCell(row, role, cell);
+    }
+    case ListLayout::Role::Bool:
+        return setCell(row, role, value.toBool() ? 1 : 0);
+    case ListLayout::Role::String:
+        return setCell(row, role, value.isValid() ? intern(value.toString()) : 0);
+    case ListLayout::Role::DateTime: {
+        const QDateTime dateTime = value.toDateTime();
+        return setCell(row, role, dateTime.isValid()
+                       ? quint64(dateTime.toMSecsSinceEpoch()) + DateTimeBias : 0);
+    }
+    case ListLayout::Role::Url: {
+        const QUrl url = value.toUrl();
+        return setCell(row, role, url.isEmpty() ? 0 : intern(url.toString()));
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+
+bool ListColumns::clearValue(int row, const ListLayout::Role &role)
+{
+    return setCell(row, role, 0);
+}
+
+void ListColumns::setObjectCache(int row, QObject *object)
+{
+    if (m_objectCaches.isEmpty())
+        m_objectCaches.resize(m_rowCount, nullptr);
+    m_objectCaches[row] = object;
+}
+
+quint32 ListColumns::intern(const QString &string)
+{
+    const auto it = m_stringIds.constFind(string);
+    if (it != m_stringIds.constEnd()) {
+        ++m_strings[*it - 1].refCount;
+        return *it;
+    }
+
+    quint32 id;
+    if (!m_freeStringIds.isEmpty()) {
+        id = m_freeStringIds.takeLast();
+        m_strings[id - 1] = { string, 1 };
+    } else {
+        m_strings.append({ string, 1 });
+        id = quint32(m_strings.size());
+    }
+    m_stringIds.insert(string, id);
+    return id;
+}
+
+void ListColumns::release(quint64 id)
+{
+    if (id == 0)
+        return;
+
+    PooledString &pooled = m_strings[id - 1];
+    Q_ASSERT(pooled.refCount > 0);
+    if (--pooled.refCount == 0) {
+        m_stringIds.remove(pooled.string);
+        pooled.string = QString();
+        m_freeStringIds.append(quint32(id));
+    }
+}
+
+bool ListColumns::setCell(int row, const ListLayout::Role &role, quint64 cell)
+{
+    const bool pooled = role.type == ListLayout::Role::String
+            || role.type == ListLayout::Role::Url;
+    return setCell(row, role.index, pooled, cell);
+}
+
+bool ListColumns::setCell(int row, int column, bool pooled, quint64 cell)
+{
+    Q_ASSERT(row >= 0 && row < m_rowCount);
+    if (column >= m_columns.size()) {
+        if (cell == 0)
+            return false;
+        m_columns.resize(column + 1, QVector<quint64>(m_rowCount, 0));
+        m_pooledColumns.resize(column + 1, false);
+    }
+    m_pooledColumns[column] = pooled;
+
+    quint64 &stored = m_columns[column][row];
+    if (stored == cell) {
+        // The new value already holds a reference through this cell
+        if (pooled)
+            release(cell);
+        return false;
+    }
+    if (pooled)
+        release(stored);
+    stored = cell;
+    return true;
+}
+
+void ListModel::setColumnar(bool columnar)
+{
+    Q_ASSERT(elementCount() == 0);
+    if (columnar && !m_columns)
+        m_columns = std::make_unique<ListColumns>();
+    else if (!columnar)
+        m_columns.reset();
+}
+
+ModelNodeMetaObject *ListModel::objectCache(int elementIndex)
+{
+    if (m_columns) {
+        QObject *object = m_columns->objectCache(elementIndex);
+        return object ? ModelNodeMetaObject::get(object) : nullptr;
+    }
+    return elements.at(elementIndex)->objectCache();
+}
+
 QObject *ListModel::getOrCreateModelObject(QQmlListModel *model, int elementIndex)
 {
+    if (m_columns) {
+        QObject *object = m_columns->objectCache(elementIndex);
+        if (!object) {
+            object = createModelObject(model, elementIndex);
+            m_columns->setObjectCache(elementIndex, object);
+        }
+        return object;
+    }
+
     ListElement *e = elements[elementIndex];
-    if (e->m_objectCache == nullptr) {
-        void *memory = operator new(sizeof(QObject) + sizeof(QQmlData));
-        void *ddataMemory = ((char *)memory) + sizeof(QObject);
-        e->m_objectCache = new (memory) QObject;
+    if (e->m_objectCache == nullptr)
+        e->m_objectCache = createModelObject(model, elementIndex);
+    return e->m_objectCache;
+}
 
-        const QAbstractDeclarativeData *old = std::exchange(
-            QObjectPrivate::get(e->m_objectCache)->declarativeData,
-            new (ddataMemory) QQmlData(QQmlData::DoesNotOwnMemory));
-        Q_ASSERT(!old); // QObject should really not manipulate QQmlData
+bool ListModel::syncColumns(ListModel *src, ListModel *target)
+{
+    // Rows carry no identity in columnar storage. Rows present on both sides are
+    // compared by position, the rest are appended to or removed from the end.
+    QQmlListModel *targetModel = target->m_modelCache;
+    if (!target->m_columns)
+        target->setColumnar(true);
+
+    ListLayout::sync(src->m_layout, target->m_layout);
 
-        (void)new ModelNodeMetaObject(e->m_objectCache, model, elementIndex);
+    const int oldCount = target->m_columns->rowCount();
+    const int newCount = src->m_columns->rowCount();
+    const int commonCount = qMin(oldCount, newCount);
+    QVector<QVector<int>> changedRoles(commonCount);
+    for (int i = 0; i < commonCount; ++i)
+        changedRoles[i] = target->m_columns->changedColumns(i, *src->m_columns, i);
+
+    QVector<QObject *> removedCaches;
+    if (oldCount > newCount) {
+        if (targetModel)
+            targetModel->beginRemoveRows(QModelIndex(), newCount, oldCount - 1);
+        removedCaches = target->m_columns->removeRows(newCount, oldCount - newCount);
+        if (targetModel)
+            targetModel->endRemoveRows();
     }
-    return e->m_objectCache;
+
+    if (newCount > oldCount) {
+        if (targetModel)
+            targetModel->beginInsertRows(QModelIndex(), oldCount, newCount - 1);
+        target->m_columns->copyValues(*src->m_columns);
+        if (targetModel)
+            targetModel->endInsertRows();
+    } else {
+        target->m_columns->copyValues(*src->m_columns);
+    }
+
+    bool hasChanges = oldCount != newCount;
+    for (int i = 0; i < commonCount; ++i) {
+        const QVector<int> &roles = changedRoles.at(i);
+        if (roles.isEmpty())
+            continue;
+        if (ModelNodeMetaObject *mo = target->objectCache(i))
+            mo->updateValues(roles);
+        if (targetModel) {
+            const QModelIndex idx = targetModel->createIndex(i, 0);
+            emit targetModel->dataChanged(idx, idx, roles);
+        }
+        hasChanges = true;
+    }
+
+    for (QObject *object : std::as_const(removedCaches))
+        destroyModelObject(object);
+
+    return hasChanges;
+}
+
+static bool hasListRoles(const ListLayout *layout)
+{
+    for (int i = 0, end = layout->roleCount(); i < end; ++i) {
+        if (layout->getExistingRole(i).type == ListLayout::Role::List)
+            return true;
+    }
+    return false;
 }
 
 bool ListModel::sync(ListModel *src, ListModel *target)
 {
-    // Sanity check
+    // Both sides of a WorkerScript sync keep a journal. As long as the target was
+    // left alone since the last sync, only what the source journal recorded has
+    // to be applied. Nested models are not journaled, so rows holding them are
+    // always compared in full.
+    const bool journaled = src->m_journal && target->m_journal && target->m_journal->isEmpty()
+            && !hasListRoles(src->m_layout);
+    Journal changes;
+    if (src->m_journal)
+        changes = std::exchange(*src->m_journal, Journal());
+    if (target->m_journal)
+        *target->m_journal = Journal();
+
+    if (journaled && changes.isEmpty())
+        return false;
+
+    if (journaled && !changes.overflowed)
+        return syncJournaled(src, target, changes);
+
+    if (src->m_columns)
+        return syncColumns(src, target);
 
     bool hasChanges = false;
 
@@ -472,13 +882,209 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     return hasChanges;
 }
 
+bool ListModel::syncJournaled(ListModel *src, ListModel *target, const Journal &changes)
+{
+    // The source started out equal to the target, so replaying its steps on a
+    // list of row tokens tells where every row ended up. Rows inserted by the
+    // source are numbered in the order they were inserted.
+    enum : int { Kept = -1, Changed = -2 };
+    QVector<int> rows(target->elementCount(), Kept);
+    int insertedCount = 0;
+    for (const Journal::Step &step : changes.steps) {
+        switch (step.operation) {
+        case Journal::Operation::Change:
+            if (rows.at(step.index) == Kept)
+                rows[step.index] = Changed;
+            break;
+        case Journal::Operation::Insert:
+            rows.insert(step.index, step.count, 0);
+            for (int i = 0; i < step.count; ++i)
+                rows[step.index + i] = insertedCount++;
+            break;
+        case Journal::Operation::Remove:
+            rows.remove(step.index, step.count);
+            break;
+        case Journal::Operation::Move: {
+            int from = step.index;
+            int to = step.to;
+            int n = step.count;
+            normalizeMove(&from, &to, &n);
+            rotateRows(rows, from, to, n);
+            break;
+        }
+        }
+    }
+    Q_ASSERT(rows.size() == src->elementCount());
+
+    // Where each inserted row is in the source now, or -1 if it was removed again
+    QVector<int> insertedRows(insertedCount, -1);
+    QVector<int> changedRows;
+    for (int i = 0, end = int(rows.size()); i < end; ++i) {
+        if (rows.at(i) >= 0)
+            insertedRows[rows.at(i)] = i;
+        else if (rows.at(i) == Changed)
+            changedRows.append(i);
+    }
+
+    ListLayout::sync(src->m_layout, target->m_layout);
+
+    // Inserted rows are filled with their final values as they are inserted, so
+    // only rows the target already had can be reported as changed afterwards.
+    QQmlListModel *targetModel = target->m_modelCache;
+    bool hasChanges = false;
+    int inserted = 0;
+    for (const Journal::Step &step : changes.steps) {
+        switch (step.operation) {
+        case Journal::Operation::Change:
+            continue;
+        case Journal::Operation::Insert:
+            if (targetModel)
+                targetModel->beginInsertRows(QModelIndex(), step.index, step.index + step.count - 1);
+            target->insertElements(step.index, step.count);
+            for (int i = 0; i < step.count; ++i) {
+                const int srcIndex = insertedRows.at(inserted++);
+                if (srcIndex != -1)
+                    target->syncElement(step.index + i, src, srcIndex);
+            }
+            if (targetModel)
+                targetModel->endInsertRows();
+            break;
+        case Journal::Operation::Remove: {
+            if (targetModel)
+                targetModel->beginRemoveRows(QModelIndex(), step.index, step.index + step.count - 1);
+            const QVector<std::function<void()>> toDestroy = target->remove(step.index, step.count);
+            if (targetModel)
+                targetModel->endRemoveRows();
+            for (const auto &destroyer : toDestroy)
+                destroyer();
+            break;
+        }
+        case Journal::Operation::Move:
+            if (targetModel) {
+                targetModel->beginMoveRows(QModelIndex(), step.index, step.index + step.count - 1,
+                                           QModelIndex(), step.to > step.index ? step.to + step.count : step.to);
+            }
+            target->move(step.index, step.to, step.count);
+            if (targetModel)
+                targetModel->endMoveRows();
+            break;
+        }
+        hasChanges = true;
+    }
+
+    for (int row : std::as_const(changedRows)) {
+        const QVector<int> changedRoles = target->syncElement(row, src, row);
+        if (changedRoles.isEmpty())
+            continue;
+
+        if (ModelNodeMetaObject *mo = target->objectCache(row))
+            mo->updateValues(changedRoles);
+        if (targetModel) {
+            const QModelIndex idx = targetModel->createIndex(row, 0);
+            emit targetModel->dataChanged(idx, idx, changedRoles);
+        }
+        hasChanges = true;
+    }
+
+    // The replay was journaled on the target as well
+    *target->m_journal = Journal();
+    return hasChanges;
+}
+
+QVector<int> ListModel::syncElement(int elementIndex, const ListModel *src, int srcIndex)
+{
+    Q_ASSERT(isColumnar() == src->isColumnar());
+    if (m_columns)
+        return m_columns->copyRow(elementIndex, *src->m_columns, srcIndex);
+
+    ListElement *srcElement = src->elements.at(srcIndex);
+    ListElement *element = elements.at(elementIndex);
+    element->uid = srcElement->getUid();
+    return ListElement::sync(srcElement, src->m_layout, element, m_layout);
+}
+
 ListModel::ListModel(ListLayout *layout, QQmlListModel *modelCache) : m_layout(layout), m_modelCache(modelCache)
 {
 }
 
+void ListModel::enableJournal()
+{
+    if (!m_journal)
+        m_journal = std::make_unique<Journal>();
+}
+
+void ListModel::recordChange(int elementIndex)
+{
+    if (!m_journal || m_journal->overflowed)
+        return;
+    if (elementIndex < 0 || elementIndex >= elementCount()) {
+        m_journal->steps.clear();
+        m_journal->overflowed = true;
+        return;
+    }
+    recordStep(Journal::Operation::Change, elementIndex, 1);
+}
+
+// Each structural step is replayed on the whole target on sync. Past this many,
+// comparing the models in full is cheaper.
+static constexpr int MaxJournaledStructuralSteps = 16;
+
+void ListModel::recordStep(Journal::Operation operation, int index, int count, int to)
+{
+    if (!m_journal || m_journal->overflowed || count <= 0)
+        return;
+
+    QVector<Journal::Step> &steps = m_journal->steps;
+    if (!steps.isEmpty()) {
+        // Fold the step into the previous one where possible, so that appending
+        // or removing rows in a loop stays a single step.
+        Journal::Step &last = steps.last();
+        switch (operation) {
+        case Journal::Operation::Change:
+            // Inserted rows are copied with their final values anyway
+            if ((last.operation == Journal::Operation::Change && last.index == index)
+                    || (last.operation == Journal::Operation::Insert
+                        && index >= last.index && index < last.index + last.count)) {
+                return;
+            }
+            break;
+        case Journal::Operation::Insert:
+            if (last.operation == operation
+                    && index >= last.index && index <= last.index + last.count) {
+                last.count += count;
+                return;
+            }
+            break;
+        case Journal::Operation::Remove:
+            if (last.operation == operation && index == last.index) {
+                last.count += count;
+                return;
+            }
+            if (last.operation == operation && index + count == last.index) {
+                last.index = index;
+                last.count += count;
+                return;
+            }
+            break;
+        case Journal::Operation::Move:
+            break;
+        }
+    }
+
+    if ((operation != Journal::Operation::Change
+         && ++m_journal->structuralSteps > MaxJournaledStructuralSteps)
+            || steps.size() > elementCount() + MaxJournaledStructuralSteps) {
+        m_journal->steps.clear();
+        m_journal->overflowed = true;
+        return;
+    }
+
+    steps.append({ operation, index, count, to });
+}
+
 void ListModel::destroy()
 {
-    for (const auto &destroyer : remove(0, elements.count()))
+    for (const auto &destroyer : remove(0, elementCount()))
         destroyer();
 
     m_layout = nullptr;
@@ -489,7 +1095,7 @@ void ListModel::destroy()
 
 int ListModel::appendElement()
 {
-    int elementIndex = elements.count();
+    int elementIndex = elementCount();
     newElement(elementIndex);
     return elementIndex;
 }
@@ -500,15 +1106,28 @@ void ListModel::insertElement(int index)
     updateCacheIndices(index);
 }
 
+void ListModel::insertElements(int index, int count)
+{
+    recordStep(Journal::Operation::Insert, index, count);
+    if (m_columns) {
+        m_columns->insertRows(index, count);
+    } else {
+        elements.insertBlank(index, count);
+        for (int i = index; i < index + count; ++i)
+            elements[i] = new ListElement;
+    }
+    updateCacheIndices(index + count);
+}
+
 void ListModel::move(int from, int to, int n)
 {
-    if (from > to) {
-        // Only move forwards - flip if backwards moving
-        int tfrom = from;
-        int tto = to;
-        from = tto;
-        to = tto+n;
-        n = tfrom-tto;
+    recordStep(Journal::Operation::Move, from, n, to);
+    normalizeMove(&from, &to, &n);
+
+    if (m_columns) {
+        m_columns->moveRows(from, to, n);
+        updateCacheIndices(from, to + n);
+        return;
     }
 
     QPODVector<ListElement *, 4> store;
@@ -524,20 +1143,25 @@ void ListModel::move(int from, int to, int n)
 
 void ListModel::newElement(int index)
 {
+    recordStep(Journal::Operation::Insert, index, 1);
+    if (m_columns) {
+        m_columns->insertRows(index, 1);
+        return;
+    }
+
     ListElement *e = new ListElement;
     elements.insert(index, e);
 }
 
 void ListModel::updateCacheIndices(int start, int end)
 {
-    int count = elements.count();
+    int count = elementCount();
 
     if (end < 0 || end > count)
         end = count;
 
     for (int i = start; i < end; ++i) {
-        ListElement *e = elements.at(i);
-        if (ModelNodeMetaObject *mo = e->objectCache())
+        if (ModelNodeMetaObject *mo = objectCache(i))
             mo->m_elementIndex = i;
     }
 }
@@ -546,30 +1170,155 @@ QVariant ListModel::getProperty(int elementIndex, int roleIndex, const QQmlListM
 {
     if (roleIndex >= m_layout->roleCount())
         return QVariant();
-    ListElement *e = elements[elementIndex];
     const ListLayout::Role &r = m_layout->getExistingRole(roleIndex);
+    if (m_columns)
+        return m_columns->value(elementIndex, r);
+    ListElement *e = elements[elementIndex];
     return e->getProperty(r, owner, eng);
 }
 
 ListModel *ListModel::getListProperty(int elementIndex, const ListLayout::Role &role)
 {
+    if (m_columns)
+        return nullptr;
     ListElement *e = elements[elementIndex];
     return e->getListProperty(role);
 }
 
 void ListModel::updateTranslations()
 {
-    for (int index = 0; index != elements.count(); ++index) {
-        ListElement *e = elements[index];
-        if (ModelNodeMetaObject *cache = e->objectCache()) {
+    for (int index = 0; index != elementCount(); ++index) {
+        if (ModelNodeMetaObject *cache = objectCache(index)) {
             // TODO: more fine grained tracking?
             cache->updateValues();
         }
     }
 }
 
+const ListLayout::Role &ListModel::RoleCache::role(ListLayout *layout, int position,
+                                                   QV4::String *key, ListLayout::Role::DataType type)
+{
+    if (position < m_entries.size()) {
+        const Entry &entry = m_entries.at(position);
+        if (entry.name == key->d() && entry.role->type == type)
+            return *entry.role;
+    } else {
+        m_entries.resize(position + 1);
+    }
+
+    const ListLayout::Role &r = layout->getRoleOrCreate(key, type);
+    m_entries[position] = { key->d(), &r };
+    return r;
+}
+
+const ListLayout::Role *ListModel::RoleCache::role(ListLayout *layout, int position,
+                                                   const QString &key, const QVariant &data)
+{
+    if (position < m_entries.size()) {
+        const Entry &entry = m_entries.at(position);
+        if (entry.role && entry.role->name == key && entry.role->type == ListLayout::roleType(data))
+            return entry.role;
+    } else {
+        m_entries.resize(position + 1);
+    }
+
+    const ListLayout::Role *r = layout->getRoleOrCreate(key, data);
+    m_entries[position] = { nullptr, r };
+    return r;
+}
+
+// Converts a JS value to what columnar storage keeps for it. Returns an invalid
+// QVariant for values that have no column representation.
+static QVariant columnValue(const QV4::Value &value)
+{
+    if (const QV4::String *s = value.as<QV4::String>())
+        return s->toQString();
+    if (value.isNumber())
+        return value.asDouble();
+    if (value.isBoolean())
+        return value.booleanValue();
+    if (const QV4::DateObject *date = value.as<QV4::DateObject>())
+        return date->toQDateTime();
+    if (const QV4::UrlObject *url = value.as<QV4::UrlObject>())
+        return QUrl(url->href());
+    if (value.as<QV4::Object>() && !value.as<QV4::QObjectWrapper>()
+            && !value.as<QV4::ArrayObject>() && !value.as<QV4::FunctionObject>()) {
+        const QVariant maybeUrl = QV4::ExecutionEngine::toVariant(
+                value, QMetaType::fromType<QUrl>(), true);
+        if (maybeUrl.metaType() == QMetaType::fromType<QUrl>())
+            return maybeUrl;
+    }
+    return QVariant();
+}
+
+static void warnAboutUnsetMember(QV4::ExecutionEngine *v4, QV4::String *propertyName,
+                                 const QV4::Value &propertyValue)
+{
+    QQmlError err;
+    auto memberName = propertyName->toString(v4)->toQString();
+    err.setDescription(QString::fromLatin1("%1 is %2. Adding an object with a %2 member does not create a role for it.").arg(memberName, propertyValue.isNull() ? QLatin1String("null") : QLatin1String("undefined")));
+    qmlWarning(nullptr, err);
+}
+
+void ListModel::setColumns(int elementIndex, QV4::Object *object, QVector<int> *roles,
+                           SetElement reason, RoleCache *cache)
+{
+    QV4::ExecutionEngine *v4 = object->engine();
+    QV4::Scope scope(v4);
+
+    QV4::ObjectIterator it(scope, object, QV4::ObjectIterator::EnumerableOnly);
+    QV4::ScopedString propertyName(scope);
+    QV4::ScopedValue propertyValue(scope);
+    for (int position = 0; ; ++position) {
+        propertyName = it.nextPropertyNameAsString(propertyValue);
+        if (!propertyName)
+            break;
+
+        if (propertyValue->isNullOrUndefined()) {
+            if (reason == SetElement::WasJustInserted) {
+                warnAboutUnsetMember(v4, propertyName, propertyValue);
+            } else if (const ListLayout::Role *r = m_layout->getExistingRole(propertyName)) {
+                if (m_columns->clearValue(elementIndex, *r) && roles)
+                    roles->append(r->index);
+            }
+            continue;
+        }
+
+        const QVariant value = columnValue(propertyValue);
+        const ListLayout::Role::DataType type = ListLayout::roleType(value);
+        if (!ListColumns::supportsType(type)) {
+            qmlWarning(nullptr) << QStringLiteral("Can't store role '%1' in a ListModel with columnar storage")
+                                   .arg(propertyName->toQString());
+            continue;
+        }
+
+        const ListLayout::Role &r = cache->role(m_layout, position, propertyName, type);
+        if (r.type == type && m_columns->setValue(elementIndex, r, value) && roles)
+            roles->append(r.index);
+    }
+}
+
+int ListModel::setColumnValue(int elementIndex, const ListLayout::Role &role, const QVariant &value)
+{
+    if (!m_columns->setValue(elementIndex, role, value))
+        return -1;
+    if (ModelNodeMetaObject *cache = objectCache(elementIndex))
+        cache->updateValues(QVector<int>(1, role.index));
+    return role.index;
+}
+
 void ListModel::set(int elementIndex, QV4::Object *object, QVector<int> *roles)
 {
+    recordChange(elementIndex);
+
+    if (m_columns) {
+        RoleCache cache;
+        setColumns(elementIndex, object, roles, SetElement::IsCurrentlyUpdated, &cache);
+        if (ModelNodeMetaObject *mo = objectCache(elementIndex))
+            mo->updateValues(*roles);
+        return;
+    }
+
     ListElement *e = elements[elementIndex];
 
     QV4::ExecutionEngine *v4 = object->engine();
@@ -656,11 +1405,23 @@ void ListModel::set(int elementIndex, QV4::Object *object, QVector<int> *roles)
         mo->updateValues(*roles);
 }
 
-void ListModel::set(int elementIndex, QV4::Object *object, ListModel::SetElement reason)
+void ListModel::set(int elementIndex, QV4::Object *object, ListModel::SetElement reason,
+                    RoleCache *cache)
 {
     if (!object)
         return;
 
+    recordChange(elementIndex);
+
+    RoleCache localCache;
+    if (!cache)
+        cache = &localCache;
+
+    if (m_columns) {
+        setColumns(elementIndex, object, nullptr, reason, cache);
+        return;
+    }
+
     ListElement *e = elements[elementIndex];
 
     QV4::ExecutionEngine *v4 = object->engine();
@@ -670,47 +1431,47 @@ void ListModel::set(int elementIndex, QV4::Object *object, ListModel::SetElement
     QV4::ScopedString propertyName(scope);
     QV4::ScopedValue propertyValue(scope);
     QV4::ScopedObject o(scope);
-    while (1) {
+    for (int position = 0; ; ++position) {
         propertyName = it.nextPropertyNameAsString(propertyValue);
         if (!propertyName)
             break;
 
         // Add the value now
         if (QV4::String *s = propertyValue->stringValue()) {
-            const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::String);
+            const ListLayout::Role &r = cache->role(m_layout, position, propertyName, ListLayout::Role::String);
             if (r.type == ListLayout::Role::String)
                 e->setStringPropertyFast(r, s->toQString());
         } else if (propertyValue->isNumber()) {
-            const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Number);
+            const ListLayout::Role &r = cache->role(m_layout, position, propertyName, ListLayout::Role::Number);
             if (r.type == ListLayout::Role::Number) {
                 e->setDoublePropertyFast(r, propertyValue->asDouble());
             }
         } else if (QV4::ArrayObject *a = propertyValue->as<QV4::ArrayObject>()) {
-            setArrayLike(&o, propertyName, e, a);
+            setArrayLike(&o, cache->role(m_layout, position, propertyName, ListLayout::Role::List), e, a);
         } else if (QV4::Sequence *s = propertyValue->as<QV4::Sequence>()) {
-            setArrayLike(&o, propertyName, e, s);
+            setArrayLike(&o, cache->role(m_layout, position, propertyName, ListLayout::Role::List), e, s);
         } else if (QV4::QmlListWrapper *l = propertyValue->as<QV4::QmlListWrapper>()) {
-            setArrayLike(&o, propertyName, e, l);
+            setArrayLike(&o, cache->role(m_layout, position, propertyName, ListLayout::Role::List), e, l);
         } else if (propertyValue->isBoolean()) {
-            const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Bool);
+            const ListLayout::Role &r = cache->role(m_layout, position, propertyName, ListLayout::Role::Bool);
             if (r.type == ListLayout::Role::Bool) {
                 e->setBoolPropertyFast(r, propertyValue->booleanValue());
             }
         } else if (QV4::DateObject *date = propertyValue->as<QV4::DateObject>()) {
-            const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::DateTime);
+            const ListLayout::Role &r = cache->role(m_layout, position, propertyName, ListLayout::Role::DateTime);
             if (r.type == ListLayout::Role::DateTime) {
                 QDateTime dt = date->toQDateTime();
                 e->setDateTimePropertyFast(r, dt);
             }
         } else if (QV4::UrlObject *url = propertyValue->as<QV4::UrlObject>()){
-            const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Url);
+            const ListLayout::Role &r = cache->role(m_layout, position, propertyName, ListLayout::Role::Url);
             if (r.type == ListLayout::Role::Url) {
                 QUrl qurl = QUrl(url->href()); // does what the private UrlObject->toQUrl would do
                 e->setUrlPropertyFast(r, qurl);
             }
         } else if (QV4::Object *o = propertyValue->as<QV4::Object>()) {
             if (QV4::QObjectWrapper *wrapper = o->as<QV4::QObjectWrapper>()) {
-                const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::QObject);
+                const ListLayout::Role &r = cache->role(m_layout, position, propertyName, ListLayout::Role::QObject);
                 if (r.type == ListLayout::Role::QObject)
                     e->setQObjectPropertyFast(r, wrapper);
             } else {
@@ -720,21 +1481,18 @@ void ListModel::set(int elementIndex, QV4::Object *object, ListModel::SetElement
                             QMetaType::fromType<QUrl>(), true);
                 if (maybeUrl.metaType() == QMetaType::fromType<QUrl>()) {
                     const QUrl qurl = maybeUrl.toUrl();
-                    const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Url);
+                    const ListLayout::Role &r = cache->role(m_layout, position, propertyName, ListLayout::Role::Url);
                     if (r.type == ListLayout::Role::Url)
                         e->setUrlPropertyFast(r, qurl);
                 } else {
-                    const ListLayout::Role &role = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::VariantMap);
+                    const ListLayout::Role &role = cache->role(m_layout, position, propertyName, ListLayout::Role::VariantMap);
                     if (role.type == ListLayout::Role::VariantMap)
                         e->setVariantMapFast(role, o);
                 }
             }
         } else if (propertyValue->isNullOrUndefined()) {
             if (reason == SetElement::WasJustInserted) {
-                QQmlError err;
-                auto memberName = propertyName->toString(v4)->toQString();
-                err.setDescription(QString::fromLatin1("%1 is %2. Adding an object with a %2 member does not create a role for it.").arg(memberName, propertyValue->isNull() ? QLatin1String("null") : QLatin1String("undefined")));
-                qmlWarning(nullptr, err);
+                warnAboutUnsetMember(v4, propertyName, propertyValue);
             } else {
                 const ListLayout::Role *r = m_layout->getExistingRole(propertyName);
                 if (r)
@@ -746,7 +1504,17 @@ void ListModel::set(int elementIndex, QV4::Object *object, ListModel::SetElement
 
 QVector<std::function<void()>> ListModel::remove(int index, int count)
 {
+    recordStep(Journal::Operation::Remove, index, count);
+
     QVector<std::function<void()>> toDestroy;
+    if (m_columns) {
+        const QVector<QObject *> removedCaches = m_columns->removeRows(index, count);
+        for (QObject *object : removedCaches)
+            toDestroy.append([object]() { destroyModelObject(object); });
+        updateCacheIndices(index);
+        return toDestroy;
+    }
+
     auto layout = m_layout;
     for (int i=0 ; i < count ; ++i) {
         auto element = elements[index+i];
@@ -773,14 +1541,71 @@ int ListModel::append(QV4::Object *object)
     return elementIndex;
 }
 
-int ListModel::setOrCreateProperty(int elementIndex, const QString &key, const QVariant &data)
+void ListModel::insertObjects(int elementIndex, QV4::ArrayObject *objects)
+{
+    const int count = objects->getLength();
+    insertElements(elementIndex, count);
+
+    QV4::Scope scope(objects->engine());
+    QV4::ScopedObject object(scope);
+    RoleCache cache;
+    for (int i = 0; i < count; ++i) {
+        object = objects->get(i);
+        set(elementIndex + i, object, SetElement::WasJustInserted, &cache);
+    }
+}
+
+void ListModel::insertMaps(int elementIndex, const QList<QVariantMap> &rows)
+{
+    insertElements(elementIndex, rows.size());
+
+    RoleCache cache;
+    for (int i = 0, end = rows.size(); i < end; ++i) {
+        const QVariantMap &row = rows.at(i);
+        int position = 0;
+        for (auto it = row.cbegin(), rowEnd = row.cend(); it != rowEnd; ++it, ++position)
+            setOrCreateProperty(elementIndex + i, it.key(), it.value(), &cache, position);
+    }
+}
+
+int ListModel::setOrCreateProperty(int elementIndex, const QString &key, const QVariant &data,
+                                   RoleCache *cache, int position)
 {
     int roleIndex = -1;
 
+    recordChange(elementIndex);
+
+    RoleCache localCache;
+    if (!cache)
+        cache = &localCache;
+
+    if (m_columns) {
+        if (elementIndex < 0 || elementIndex >= m_columns->rowCount())
+            return -1;
+
+        QVariant value = data;
+        if (value.metaType() == QMetaType::fromType<const QV4::CompiledData::Binding *>()) {
+            // Translations are resolved once, when the value is stored
+            const auto *binding = value.value<const QV4::CompiledData::Binding *>();
+            value = m_modelCache && m_modelCache->m_compilationUnit
+                    ? m_modelCache->m_compilationUnit->bindingValueAsString(binding)
+                    : QString();
+        }
+
+        const ListLayout::Role::DataType type = ListLayout::roleType(value);
+        if (type != ListLayout::Role::Invalid && !ListColumns::supportsType(type)) {
+            qmlWarning(nullptr) << QStringLiteral("Can't store role '%1' in a ListModel with columnar storage").arg(key);
+            return -1;
+        }
+
+        const ListLayout::Role *r = cache->role(m_layout, position, key, value);
+        return r ? setColumnValue(elementIndex, *r, value) : -1;
+    }
+
     if (elementIndex >= 0 && elementIndex < elements.count()) {
         ListElement *e = elements[elementIndex];
 
-        const ListLayout::Role *r = m_layout->getRoleOrCreate(key, data);
+        const ListLayout::Role *r = cache->role(m_layout, position, key, data);
         if (r) {
             roleIndex = e->setVariantProperty(*r, data);
 
@@ -798,6 +1623,23 @@ int ListModel::setExistingProperty(int elementIndex, const QString &key, const Q
 {
     int roleIndex = -1;
 
+    recordChange(elementIndex);
+
+    if (m_columns) {
+        if (elementIndex < 0 || elementIndex >= m_columns->rowCount())
+            return -1;
+        const ListLayout::Role *r = m_layout->getExistingRole(key);
+        if (!r)
+            return -1;
+        if (data.isNullOrUndefined())
+            return m_columns->clearValue(elementIndex, *r) ? r->index : -1;
+
+        const QVariant value = columnValue(data);
+        if (ListLayout::roleType(value) != r->type)
+            return -1;
+        return m_columns->setValue(elementIndex, *r, value) ? r->index : -1;
+    }
+
     if (elementIndex >= 0 && elementIndex < elements.count()) {
         ListElement *e = elements[elementIndex];
         const ListLayout::Role *r = m_layout->getExistingRole(key);
@@ -2365,6 +3207,8 @@ void QQmlListModel::setDynamicRoles(bool enableDynamicRoles)
         if (enableDynamicRoles) {
             if (m_layout->roleCount())
                 qmlWarning(this) << tr("unable to enable dynamic roles as this model is not empty");
+            else if (m_listModel->isColumnar())
+                qmlWarning(this) << tr("unable to enable dynamic roles as this model uses columnar storage");
             else
                 m_dynamicRoles = true;
         } else {
@@ -2379,6 +3223,60 @@ void QQmlListModel::setDynamicRoles(bool enableDynamicRoles)
     }
 }
 
+/*!
+    \qmlproperty bool ListModel::columnarStorage
+    \since 6.10
+
+    By default, each element of the model is stored as a separate block of
+    memory holding all of its roles. When columnarStorage is enabled, each role
+    is instead stored as one contiguous array over all elements, and equal
+    strings are stored only once. This considerably reduces the memory used by
+    large models of flat records, such as log entries, and makes passes over
+    a single role more cache friendly.
+
+    A model with columnar storage can only hold roles of type string, number,
+    bool, date and url. Values of other types, such as nested lists, objects
+    and functions, are rejected with a warning. Dates are kept with millisecond
+    precision, and translated strings from ListElement declarations are
+    resolved once when the model is populated.
+
+    Like \l dynamicRoles, the columnarStorage property must be set before any
+    data is added to the ListModel, and must be set from the main thread. It
+    cannot be combined with \l dynamicRoles. When the model is populated with
+    ListElement declarations, columnarStorage must be set to the literal value
+    \c true, so that it is known before the elements are added:
+
+    \code
+    ListModel {
+        columnarStorage: true
+        ListElement { name: "Apple"; cost: 2.45 }
+        ListElement { name: "Orange"; cost: 3.25 }
+    }
+    \endcode
+*/
+bool QQmlListModel::columnarStorage() const
+{
+    return m_listModel && m_listModel->isColumnar();
+}
+
+void QQmlListModel::setColumnarStorage(bool enableColumnarStorage)
+{
+    if (!m_mainThread || m_agent) {
+        qmlWarning(this) << tr("columnar storage setting must be made from the main thread, before any worker scripts are created");
+        return;
+    }
+
+    if (enableColumnarStorage == columnarStorage())
+        return;
+
+    if (m_layout->roleCount() || count())
+        qmlWarning(this) << tr("unable to change the storage of this model as it is not empty");
+    else if (m_dynamicRoles)
+        qmlWarning(this) << tr("unable to enable columnar storage as this model uses dynamic roles");
+    else
+        m_listModel->setColumnar(enableColumnarStorage);
+}
+
 /*!
     \qmlproperty int ListModel::count
     The number of data entries in the model.
@@ -2438,6 +3336,18 @@ void QQmlListModel::removeElements(int index, int removeCount)
     if (m_mainThread)
         beginRemoveRows(QModelIndex(), index, index + removeCount - 1);
 
+    const QVector<std::function<void()>> toDestroy = takeElements(index, removeCount);
+
+    if (m_mainThread) {
+        endRemoveRows();
+        emit countChanged();
+    }
+    for (const auto &destroyer : toDestroy)
+        destroyer();
+}
+
+QVector<std::function<void()>> QQmlListModel::takeElements(int index, int removeCount)
+{
     QVector<std::function<void()>> toDestroy;
     if (m_dynamicRoles) {
         for (int i=0 ; i < removeCount ; ++i) {
@@ -2450,10 +3360,52 @@ void QQmlListModel::removeElements(int index, int removeCount)
     } else {
         toDestroy = m_listModel->remove(index, removeCount);
     }
+    return toDestroy;
+}
+
+void QQmlListModel::insertObjects(int index, QV4::ArrayObject *objects)
+{
+    if (!m_dynamicRoles) {
+        m_listModel->insertObjects(index, objects);
+        return;
+    }
+
+    QV4::Scope scope(objects->engine());
+    QV4::ScopedObject object(scope);
+    const int objectCount = objects->getLength();
+    m_modelObjects.insert(index, objectCount, nullptr);
+    for (int i = 0; i < objectCount; ++i) {
+        object = objects->get(i);
+        m_modelObjects[index + i] = DynamicRoleModelNode::create(scope.engine->variantMapFromJS(object), this);
+    }
+}
+
+void QQmlListModel::insertMaps(int index, const QList<QVariantMap> &rows)
+{
+    if (!m_dynamicRoles) {
+        m_listModel->insertMaps(index, rows);
+        return;
+    }
+
+    m_modelObjects.insert(index, rows.size(), nullptr);
+    for (int i = 0, end = rows.size(); i < end; ++i)
+        m_modelObjects[index + i] = DynamicRoleModelNode::create(rows.at(i), this);
+}
+
+void QQmlListModel::replaceElements(const std::function<void()> &insertElements)
+{
+    const int oldCount = count();
+
+    if (m_mainThread)
+        beginResetModel();
+
+    const QVector<std::function<void()>> toDestroy = takeElements(0, oldCount);
+    insertElements();
 
     if (m_mainThread) {
-        endRemoveRows();
-        emit countChanged();
+        endResetModel();
+        if (count() != oldCount)
+            emit countChanged();
     }
     for (const auto &destroyer : toDestroy)
         destroyer();
@@ -2511,20 +3463,12 @@ void QQmlListModel::insert(QQmlV4FunctionPtr args)
         QV4::ScopedObject argObject(scope, (*args)[1]);
         QV4::ScopedArrayObject objectArray(scope, (*args)[1]);
         if (objectArray) {
-            QV4::ScopedObject argObject(scope);
-
             int objectArrayLength = objectArray->getLength();
-            emitItemsAboutToBeInserted(index, objectArrayLength);
-            for (int i=0 ; i < objectArrayLength ; ++i) {
-                argObject = objectArray->get(i);
-
-                if (m_dynamicRoles) {
-                    m_modelObjects.insert(index+i, DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
-                } else {
-                    m_listModel->insert(index+i, argObject);
-                }
+            if (objectArrayLength > 0) {
+                emitItemsAboutToBeInserted(index, objectArrayLength);
+                insertObjects(index, objectArray);
+                emitItemsInserted();
             }
-            emitItemsInserted();
         } else if (argObject) {
             emitItemsAboutToBeInserted(index, 1);
 
@@ -2620,23 +3564,11 @@ void QQmlListModel::append(QQmlV4FunctionPtr args)
         QV4::ScopedArrayObject objectArray(scope, (*args)[0]);
 
         if (objectArray) {
-            QV4::ScopedObject argObject(scope);
-
             int objectArrayLength = objectArray->getLength();
             if (objectArrayLength > 0) {
                 int index = count();
                 emitItemsAboutToBeInserted(index, objectArrayLength);
-
-                for (int i=0 ; i < objectArrayLength ; ++i) {
-                    argObject = objectArray->get(i);
-
-                    if (m_dynamicRoles) {
-                        m_modelObjects.append(DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
-                    } else {
-                        m_listModel->append(argObject);
-                    }
-                }
-
+                insertObjects(index, objectArray);
                 emitItemsInserted();
             }
         } else if (argObject) {
@@ -2661,6 +3593,67 @@ void QQmlListModel::append(QQmlV4FunctionPtr args)
     }
 }
 
+/*!
+    \qmlmethod ListModel::replace(array rows)
+    \since 6.10
+
+    Replaces the whole content of the model with the objects in \a rows.
+
+    \code
+        fruitModel.replace([{"cost": 5.95, "name": "Pizza"},
+                            {"cost": 3.25, "name": "Pear"}])
+    \endcode
+
+    Unlike clear() followed by append(), this notifies views with a single
+    model reset. Roles are resolved once for consecutive objects that have
+    the same properties, which makes refreshing large models from JSON data
+    considerably faster.
+
+    \sa append(), clear()
+*/
+void QQmlListModel::replace(const QJSValue &rows)
+{
+    QV4::Scope scope(engine());
+    QV4::ScopedArrayObject objectArray(scope, QJSValuePrivate::asReturnedValue(&rows));
+    if (!objectArray) {
+        qmlWarning(this) << tr("replace: value is not an array");
+        return;
+    }
+
+    replaceElements([&]() { insertObjects(0, objectArray); });
+}
+
+/*!
+    \internal
+
+    Inserts one element per entry of \a rows at \a index, notifying views
+    with a single rowsInserted() signal.
+*/
+void QQmlListModel::insert(int index, const QList<QVariantMap> &rows)
+{
+    if (index < 0 || index > count()) {
+        qmlWarning(this) << tr("insert: index %1 out of range").arg(index);
+        return;
+    }
+    if (rows.isEmpty())
+        return;
+
+    emitItemsAboutToBeInserted(index, rows.size());
+    insertMaps(index, rows);
+    emitItemsInserted();
+}
+
+/*!
+    \internal
+
+    Replaces the whole content of the model with \a rows, notifying views
+    with a single model reset.
+*/
+void QQmlListModel::replace(const QList<QVariantMap> &rows)
+{
+    replaceElements([&]() { insertMaps(0, rows); });
+}
+
 /*!
     \qmlmethod object ListModel::get(int index)
 
@@ -2886,6 +3879,8 @@ bool QQmlListModelParser::applyProperty(
         ListModel *subModel = nullptr;
         if (outterElementIndex == -1) {
             subModel = model;
+        } else if (model && model->isColumnar()) {
+            qmlWarning(model->m_modelCache) << QQmlListModel::tr("ListElement: nested lists are not supported with columnar storage");
         } else {
             const ListLayout::Role &role = model->getOrCreateListRole(elementName);
             if (role.type == ListLayout::Role::List) {
@@ -2922,6 +3917,8 @@ bool QQmlListModelParser::applyProperty(
         } else if (bindingType == QV4::CompiledData::Binding::Type_Script) {
             QString scriptStr = compilationUnit->bindingValueAsScriptString(binding);
             if (definesEmptyList(scriptStr)) {
+                if (!model || model->isColumnar())
+                    return roleSet;
                 const ListLayout::Role &role = model->getOrCreateListRole(elementName);
                 ListModel *emptyModel = new ListModel(role.subLayout, nullptr);
                 value = QVariant::fromValue(emptyModel);
@@ -2992,6 +3989,11 @@ void QQmlListModelParser::applyBindings(
     rv->m_engine = qmlEngine(rv)->handle();
     rv->m_compilationUnit = compilationUnit;
 
+    // Regular property bindings are only applied after the ListElements have been added,
+    // so pick the storage mode from the declaration.
+    if (!bindings.isEmpty() && columnarStorageDeclared(compilationUnit, bindings.first()))
+        rv->setColumnarStorage(true);
+
     bool setRoles = false;
 
     for (const QV4::CompiledData::Binding *binding : bindings) {
@@ -3004,6 +4006,31 @@ void QQmlListModelParser::applyBindings(
         qmlWarning(obj) << "All ListElement declarations are empty, no roles can be created unless dynamicRoles is set.";
 }
 
+bool QQmlListModelParser::columnarStorageDeclared(
+        const QQmlRefPointer<QV4::ExecutableCompilationUnit> &compilationUnit,
+        const QV4::CompiledData::Binding *customBinding)
+{
+    // Find the ListModel declaration the custom parser bindings belong to.
+    for (int i = 0, end = compilationUnit->objectCount(); i != end; ++i) {
+        const QV4::CompiledData::Object *object = compilationUnit->objectAt(i);
+        const QV4::CompiledData::Binding *first = object->bindingTable();
+        if (customBinding < first || customBinding >= first + object->nBindings)
+            continue;
+
+        for (quint32 j = 0; j < object->nBindings; ++j) {
+            const QV4::CompiledData::Binding *binding = first + j;
+            if (binding->type() == QV4::CompiledData::Binding::Type_Boolean
+                    && binding->valueAsBoolean()
+                    && compilationUnit->stringAt(binding->propertyNameIndex)
+                            == QLatin1String("columnarStorage")) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return false;
+}
+
 bool QQmlListModelParser::definesEmptyList(const QString &s)
 {
     if (s.startsWith(QLatin1Char('[')) && s.endsWith(QLatin1Char(']'))) {
@@ -47,6 +47,7 @@ class Q_QMLMODELS_EXPORT QQmlListModel : public QAbstractListModel
     Q_PROPERTY(int count READ count NOTIFY countChanged)
     Q_PROPERTY(bool dynamicRoles READ dynamicRoles WRITE setDynamicRoles)
     Q_PROPERTY(QObject *agent READ agent CONSTANT REVISION(2, 14))
+    Q_PROPERTY(bool columnarStorage READ columnarStorage WRITE setColumnarStorage REVISION(6, 10))
     QML_NAMED_ELEMENT(ListModel)
     QML_ADDED_IN_VERSION(2, 0)
     QML_CUSTOMPARSER
@@ -73,12 +74,19 @@ public:
     Q_INVOKABLE void setProperty(int index, const QString& property, const QVariant& value);
     Q_INVOKABLE void move(int from, int to, int count);
     Q_INVOKABLE void sync();
+    Q_REVISION(6, 10) Q_INVOKABLE void replace(const QJSValue &rows);
+
+    void insert(int index, const QList<QVariantMap> &rows);
+    void replace(const QList<QVariantMap> &rows);
 
     QQmlListModelWorkerAgent *agent();
 
     bool dynamicRoles() const { return m_dynamicRoles; }
     void setDynamicRoles(bool enableDynamicRoles);
 
+    bool columnarStorage() const;
+    void setColumnarStorage(bool enableColumnarStorage);
+
     ListModel *listModel() const { return m_listModel; }
 
 Q_SIGNALS:
@@ -136,6 +144,10 @@ private:
     void emitItemsInserted();
 
     void removeElements(int index, int removeCount);
+    QVector<std::function<void()>> takeElements(int index, int removeCount);
+    void insertObjects(int index, QV4::ArrayObject *objects);
+    void insertMaps(int index, const QList<QVariantMap> &rows);
+    void replaceElements(const std::function<void()> &insertElements);
 
     void updateTranslations();
 };
@@ -179,6 +191,9 @@ private:
             const QV4::CompiledData::Binding *binding, ListModel *model, int outterElementIndex);
 
     static bool definesEmptyList(const QString &);
+    static bool columnarStorageDeclared(
+            const QQmlRefPointer<QV4::ExecutableCompilationUnit> &compilationUnit,
+            const QV4::CompiledData::Binding *customBinding);
 
     QString listElementTypeName;
 };
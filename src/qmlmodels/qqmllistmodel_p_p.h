@@ -21,6 +21,9 @@
 #include <private/qqmlopenmetaobject_p.h>
 #include <private/qv4qobjectwrapper_p.h>
 #include <qqml.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <memory>
 
 QT_REQUIRE_CONFIG(qml_list_model);
 
@@ -206,6 +209,8 @@ public:
         ListLayout *subLayout;
     };
 
+    static Role::DataType roleType(const QVariant &data);
+
     const Role *getRoleOrCreate(const QString &key, const QVariant &data);
     const Role &getRoleOrCreate(QV4::String *key, Role::DataType type);
     const Role &getRoleOrCreate(const QString &key, Role::DataType type);
@@ -320,6 +325,68 @@ private:
     friend class ListModel;
 };
 
+/*!
+\internal
+
+Column-wise storage used by ListModel when columnar storage is enabled. Each
+role is one contiguous array of 8-byte cells, indexed by row. Numbers are
+stored as doubles, bools as 0/1, date-times as milliseconds since the epoch and
+strings and URLs as ids into a pool of interned, reference counted strings
+shared by all roles of the model. A zero cell is the unset value of every type.
+*/
+class ListColumns
+{
+public:
+    static bool supportsType(ListLayout::Role::DataType type);
+
+    int rowCount() const { return m_rowCount; }
+
+    void insertRows(int index, int count);
+    QVector<QObject *> removeRows(int index, int count);
+    void moveRows(int from, int to, int n);
+    void copyValues(const ListColumns &other);
+    // The indices of the roles whose values differ between row and otherRow of other
+    QVector<int> changedColumns(int row, const ListColumns &other, int otherRow) const;
+    // Copies otherRow of other into row and returns the indices of the roles that changed
+    QVector<int> copyRow(int row, const ListColumns &other, int otherRow);
+
+    QVariant value(int row, const ListLayout::Role &role) const;
+    bool setValue(int row, const ListLayout::Role &role, const QVariant &value);
+    bool clearValue(int row, const ListLayout::Role &role);
+
+    QObject *objectCache(int row) const
+    {
+        return row < m_objectCaches.size() ? m_objectCaches.at(row) : nullptr;
+    }
+    void setObjectCache(int row, QObject *object);
+
+    int pooledStringCount() const { return int(m_stringIds.size()); }
+
+private:
+    struct PooledString
+    {
+        QString string;
+        quint32 refCount = 0;
+    };
+
+    quint32 intern(const QString &string);
+    void release(quint64 id);
+    bool setCell(int row, const ListLayout::Role &role, quint64 cell);
+    bool setCell(int row, int column, bool pooled, quint64 cell);
+
+    QVector<QVector<quint64>> m_columns;
+    // Whether the cells of a column are ids into the string pool
+    QVector<bool> m_pooledColumns;
+    // Every cell holding an id holds a reference to the string. The ids of
+    // strings that are no longer referenced are reused.
+    QVector<PooledString> m_strings;
+    QHash<QString, quint32> m_stringIds;
+    QVector<quint32> m_freeStringIds;
+    // Only allocated once the first model object has been requested
+    QVector<QObject *> m_objectCaches;
+    int m_rowCount = 0;
+};
+
 /*!
 \internal
 */
@@ -331,7 +398,28 @@ public:
 
     void destroy();
 
-    int setOrCreateProperty(int elementIndex, const QString &key, const QVariant &data);
+    // Remembers the roles resolved for the previous element of a bulk insertion.
+    // Elements of the same shape enumerate the same keys in the same order, so
+    // most lookups end at a pointer comparison instead of a role hash lookup.
+    class RoleCache
+    {
+    public:
+        const ListLayout::Role &role(ListLayout *layout, int position, QV4::String *key,
+                                     ListLayout::Role::DataType type);
+        const ListLayout::Role *role(ListLayout *layout, int position, const QString &key,
+                                     const QVariant &data);
+
+    private:
+        struct Entry
+        {
+            const QV4::Heap::String *name = nullptr;
+            const ListLayout::Role *role = nullptr;
+        };
+        QVarLengthArray<Entry, 16> m_entries;
+    };
+
+    int setOrCreateProperty(int elementIndex, const QString &key, const QVariant &data,
+                            RoleCache *cache = nullptr, int position = 0);
     int setExistingProperty(int uid, const QString &key, const QV4::Value &data, QV4::ExecutionEngine *eng);
 
     QVariant getProperty(int elementIndex, int roleIndex, const QQmlListModel *owner, QV4::ExecutionEngine *eng);
@@ -361,34 +449,68 @@ public:
 
     int elementCount() const
     {
-        return elements.count();
+        return m_columns ? m_columns->rowCount() : elements.count();
     }
 
+    bool isColumnar() const { return m_columns != nullptr; }
+    const ListColumns *columns() const { return m_columns.get(); }
+    void setColumnar(bool columnar);
+
     enum class SetElement {WasJustInserted, IsCurrentlyUpdated};
 
     void set(int elementIndex, QV4::Object *object, QVector<int> *roles);
-    void set(int elementIndex, QV4::Object *object, SetElement reason = SetElement::IsCurrentlyUpdated);
+    void set(int elementIndex, QV4::Object *object, SetElement reason = SetElement::IsCurrentlyUpdated,
+             RoleCache *cache = nullptr);
 
     int append(QV4::Object *object);
     void insert(int elementIndex, QV4::Object *object);
+    void insertObjects(int elementIndex, QV4::ArrayObject *objects);
+    void insertMaps(int elementIndex, const QList<QVariantMap> &rows);
 
     Q_REQUIRED_RESULT QVector<std::function<void()>> remove(int index, int count);
 
     int appendElement();
     void insertElement(int index);
+    void insertElements(int index, int count);
 
     void move(int from, int to, int n);
 
     static bool sync(ListModel *src, ListModel *target);
 
+    void enableJournal();
+
     QObject *getOrCreateModelObject(QQmlListModel *model, int elementIndex);
 
 private:
     QPODVector<ListElement *, 4> elements;
+    std::unique_ptr<ListColumns> m_columns;
     ListLayout *m_layout;
 
     QQmlListModel *m_modelCache;
 
+    // Changes made since the last sync with a WorkerScript copy of this model,
+    // in the order they were made
+    struct Journal
+    {
+        enum class Operation { Change, Insert, Remove, Move };
+        struct Step
+        {
+            Operation operation;
+            int index;
+            int count;
+            // The destination of a move, as passed to ListModel::move()
+            int to;
+        };
+
+        QVector<Step> steps;
+        int structuralSteps = 0;
+        // Too many steps were recorded to be worth replaying
+        bool overflowed = false;
+
+        bool isEmpty() const { return steps.isEmpty() && !overflowed; }
+    };
+    std::unique_ptr<Journal> m_journal;
+
     struct ElementSync
     {
         ListElement *src = nullptr;
@@ -402,10 +524,21 @@ private:
 
     void updateCacheIndices(int start = 0, int end = -1);
 
+    void recordChange(int elementIndex);
+    void recordStep(Journal::Operation operation, int index, int count, int to = 0);
+    static bool syncJournaled(ListModel *src, ListModel *target, const Journal &changes);
+    QVector<int> syncElement(int elementIndex, const ListModel *src, int srcIndex);
+
+    ModelNodeMetaObject *objectCache(int elementIndex);
+
+    void setColumns(int elementIndex, QV4::Object *object, QVector<int> *roles, SetElement reason,
+                    RoleCache *cache);
+    int setColumnValue(int elementIndex, const ListLayout::Role &role, const QVariant &value);
+    static bool syncColumns(ListModel *src, ListModel *target);
+
     template<typename ArrayLike>
-    void setArrayLike(QV4::ScopedObject *o, QV4::String *propertyName, ListElement *e, ArrayLike *a)
+    void setArrayLike(QV4::ScopedObject *o, const ListLayout::Role &r, ListElement *e, ArrayLike *a)
     {
-        const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::List);
         if (r.type == ListLayout::Role::List) {
             ListModel *subModel = new ListModel(r.subLayout, nullptr);
 
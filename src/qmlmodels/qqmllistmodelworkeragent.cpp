@@ -21,6 +21,12 @@ QQmlListModelWorkerAgent::Sync::~Sync()
 QQmlListModelWorkerAgent::QQmlListModelWorkerAgent(QQmlListModel *model)
 : m_ref(1), m_orig(model), m_copy(new QQmlListModel(model, this))
 {
+    // Both sides record their changes from here on, so that a sync only has
+    // to apply what the worker changed.
+    if (!model->m_dynamicRoles) {
+        model->m_listModel->enableJournal();
+        m_copy->m_listModel->enableJournal();
+    }
 }
 
 QQmlListModelWorkerAgent::~QQmlListModelWorkerAgent()
@@ -96,6 +102,11 @@ void QQmlListModelWorkerAgent::set(int index, const QJSValue &value)
     m_copy->set(index, value);
 }
 
+void QQmlListModelWorkerAgent::replace(const QJSValue &rows)
+{
+    m_copy->replace(rows);
+}
+
 void QQmlListModelWorkerAgent::setProperty(int index, const QString& property, const QVariant& value)
 {
     m_copy->setProperty(index, property, value);
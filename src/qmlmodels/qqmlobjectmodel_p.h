@@ -57,6 +57,8 @@ public:
 
     virtual void drainReusableItemsPool(int maxPoolTime) { Q_UNUSED(maxPoolTime); }
     virtual int poolSize() { return 0; }
+    virtual void prefetch(int index, int count) { Q_UNUSED(index); Q_UNUSED(count); }
+    virtual void flushChanges() {}
 
     virtual int indexOf(QObject *object, QObject *objectContext) const = 0;
     virtual const QAbstractItemModel *abstractItemModel() const { return nullptr; }
@@ -71,6 +73,7 @@ Q_SIGNALS:
     void destroyingItem(QObject *object);
     Q_REVISION(2, 15) void itemPooled(int index, QObject *object);
     Q_REVISION(2, 15) void itemReused(int index, QObject *object);
+    void changesPending();
 
 protected:
     QQmlInstanceModel(QObjectPrivate &dd, QObject *parent = nullptr)
@@ -253,6 +253,15 @@ void QQmlTableInstanceModel::drainReusableItemsPool(int maxPoolTime)
     });
 }
 
+void QQmlTableInstanceModel::prefetch(int index, int count)
+{
+    // Items that are already created, or being incubated, have their data.
+    for (int i = qMax(index, 0), end = qMin(index + count, this->count()); i < end; ++i) {
+        if (!m_modelItems.contains(i))
+            m_adaptorModel.prefetch(i, 1);
+    }
+}
+
 void QQmlTableInstanceModel::reuseItem(QQmlDelegateModelItem *item, int newModelIndex)
 {
     // Update the context properties index, row and column on
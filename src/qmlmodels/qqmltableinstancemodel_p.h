@@ -90,6 +90,7 @@ public:
 
     void drainReusableItemsPool(int maxPoolTime) override;
     int poolSize() override { return m_reusableItemsPool.size(); }
+    void prefetch(int index, int count) override;
     void reuseItem(QQmlDelegateModelItem *item, int newModelIndex);
 
     QQmlIncubator::Status incubationStatus(int index) override;
@@ -37,15 +37,15 @@ class WorkerDataEvent : public QEvent
 public:
     enum Type { WorkerData = QEvent::User };
 
-    WorkerDataEvent(int workerId, const QByteArray &data);
+    WorkerDataEvent(int workerId, const QV4::Serialize::Message &message);
     virtual ~WorkerDataEvent();
 
     int workerId() const;
-    QByteArray data() const;
+    const QV4::Serialize::Message &message() const;
 
 private:
     int m_id;
-    QByteArray m_data;
+    QV4::Serialize::Message m_message;
 };
 
 class WorkerLoadEvent : public QEvent
@@ -140,7 +140,7 @@ protected:
     bool event(QEvent *) override;
 
 private:
-    void processMessage(int, const QByteArray &);
+    void processMessage(int, const QV4::Serialize::Message &);
     void processLoad(int, const QUrl &);
     void reportScriptException(WorkerScript *, const QQmlError &error);
 };
@@ -153,11 +153,14 @@ QV4::ReturnedValue QQuickWorkerScriptEnginePrivate::method_sendMessage(const QV4
     Q_ASSERT(script);
 
     QV4::ScopedValue v(scope, argc > 0 ? argv[0] : QV4::Value::undefinedValue());
-    QByteArray data = QV4::Serialize::serialize(v, scope.engine);
+    QV4::ScopedValue transfer(scope, argc > 1 ? argv[1] : QV4::Value::undefinedValue());
+    const QV4::Serialize::Message message = QV4::Serialize::serialize(v, transfer, scope.engine);
+    if (scope.hasException())
+        return QV4::Encode::undefined();
 
     QMutexLocker locker(&script->p->m_lock);
     if (script->owner)
-        QCoreApplication::postEvent(script->owner, new WorkerDataEvent(0, data));
+        QCoreApplication::postEvent(script->owner, new WorkerDataEvent(0, message));
 
     return QV4::Encode::undefined();
 }
@@ -166,7 +169,7 @@ bool QQuickWorkerScriptEnginePrivate::event(QEvent *event)
 {
     if (event->type() == (QEvent::Type)WorkerDataEvent::WorkerData) {
         WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
-        processMessage(workerEvent->workerId(), workerEvent->data());
+        processMessage(workerEvent->workerId(), workerEvent->message());
         return true;
     } else if (event->type() == (QEvent::Type)WorkerLoadEvent::WorkerLoad) {
         WorkerLoadEvent *workerEvent = static_cast<WorkerLoadEvent *>(event);
@@ -207,7 +210,7 @@ QV4::ExecutionEngine *QQuickWorkerScriptEnginePrivate::workerEngine(int id)
     return engine;
 }
 
-void QQuickWorkerScriptEnginePrivate::processMessage(int id, const QByteArray &data)
+void QQuickWorkerScriptEnginePrivate::processMessage(int id, const QV4::Serialize::Message &message)
 {
     QV4::ExecutionEngine *engine = workerEngine(id);
     if (!engine)
@@ -223,7 +226,7 @@ void QQuickWorkerScriptEnginePrivate::processMessage(int id, const QByteArray &d
     if (!onmessage)
         return;
 
-    QV4::ScopedValue value(scope, QV4::Serialize::deserialize(data, engine));
+    QV4::ScopedValue value(scope, QV4::Serialize::deserialize(message, engine));
 
     QV4::JSCallArguments jsCallData(scope, 1);
     *jsCallData.thisObject = engine->global();
@@ -285,8 +288,8 @@ void QQuickWorkerScriptEnginePrivate::reportScriptException(WorkerScript *script
         QCoreApplication::postEvent(script->owner, new WorkerErrorEvent(error));
 }
 
-WorkerDataEvent::WorkerDataEvent(int workerId, const QByteArray &data)
-: QEvent((QEvent::Type)WorkerData), m_id(workerId), m_data(data)
+WorkerDataEvent::WorkerDataEvent(int workerId, const QV4::Serialize::Message &message)
+: QEvent((QEvent::Type)WorkerData), m_id(workerId), m_message(message)
 {
 }
 
@@ -299,9 +302,9 @@ int WorkerDataEvent::workerId() const
     return m_id;
 }
 
-QByteArray WorkerDataEvent::data() const
+const QV4::Serialize::Message &WorkerDataEvent::message() const
 {
-    return m_data;
+    return m_message;
 }
 
 WorkerLoadEvent::WorkerLoadEvent(int workerId, const QUrl &url)
@@ -427,9 +430,9 @@ void QQuickWorkerScriptEngine::executeUrl(int id, const QUrl &url)
     QCoreApplication::postEvent(d, new WorkerLoadEvent(id, url));
 }
 
-void QQuickWorkerScriptEngine::sendMessage(int id, const QByteArray &data)
+void QQuickWorkerScriptEngine::sendMessage(int id, const QV4::Serialize::Message &message)
 {
-    QCoreApplication::postEvent(d, new WorkerDataEvent(id, data));
+    QCoreApplication::postEvent(d, new WorkerDataEvent(id, message));
 }
 
 void QQuickWorkerScriptEngine::run()
@@ -555,7 +558,7 @@ bool QQuickWorkerScript::ready() const
 }
 
 /*!
-    \qmlmethod WorkerScript::sendMessage(jsobject message)
+    \qmlmethod WorkerScript::sendMessage(jsobject message, array transfer)
 
     Sends the given \a message to a worker script handler in another
     thread. The other worker script handler can receive this message
@@ -567,12 +570,24 @@ bool QQuickWorkerScript::ready() const
     \list
     \li boolean, number, string
     \li JavaScript objects and arrays
+    \li ArrayBuffer objects
     \li ListModel objects (any other type of QObject* is not allowed)
     \endlist
 
     All objects and arrays are copied to the \c message. With the exception
     of ListModel objects, any modifications by the other thread to an object
     passed in \c message will not be reflected in the original object.
+
+    Since Qt 6.10, the optional \a transfer array can list ArrayBuffer
+    objects whose contents should be moved to the other thread instead of
+    being copied. Transferred buffers are detached on the sending side: their
+    \c byteLength becomes 0. The same applies to \c WorkerScript.sendMessage()
+    called from within the worker script.
+
+    \code
+        var pixels = new ArrayBuffer(4 * width * height);
+        worker.sendMessage({ "pixels": pixels }, [ pixels ]);
+    \endcode
 */
 void QQuickWorkerScript::sendMessage(QQmlV4FunctionPtr args)
 {
@@ -583,10 +598,17 @@ void QQuickWorkerScript::sendMessage(QQmlV4FunctionPtr args)
 
     QV4::Scope scope(args->v4engine());
     QV4::ScopedValue argument(scope, QV4::Value::undefinedValue());
+    QV4::ScopedValue transfer(scope, QV4::Value::undefinedValue());
     if (args->length() != 0)
         argument = (*args)[0];
+    if (args->length() > 1)
+        transfer = (*args)[1];
+
+    const QV4::Serialize::Message message = QV4::Serialize::serialize(argument, transfer, scope.engine);
+    if (scope.hasException())
+        return;
 
-    m_engine->sendMessage(m_scriptId, QV4::Serialize::serialize(argument, scope.engine));
+    m_engine->sendMessage(m_scriptId, message);
 }
 
 void QQuickWorkerScript::classBegin()
@@ -642,7 +664,7 @@ bool QQuickWorkerScript::event(QEvent *event)
             QV4::ExecutionEngine *v4 = engine->handle();
             WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
             emit message(QJSValuePrivate::fromReturnedValue(
-                             QV4::Serialize::deserialize(workerEvent->data(), v4)));
+                             QV4::Serialize::deserialize(workerEvent->message(), v4)));
         }
         return true;
     } else if (event->type() == (QEvent::Type)WorkerErrorEvent::WorkerError) {
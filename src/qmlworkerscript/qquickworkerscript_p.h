@@ -18,6 +18,7 @@
 #include <qqml.h>
 
 #include <QtQmlWorkerScript/private/qtqmlworkerscriptglobal_p.h>
+#include <QtQmlWorkerScript/private/qv4serialize_p.h>
 #include <QtQml/qqmlparserstatus.h>
 #include <QtCore/qthread.h>
 #include <QtQml/qjsvalue.h>
@@ -38,7 +39,7 @@ public:
     int registerWorkerScript(QQuickWorkerScript *);
     void removeWorkerScript(int);
     void executeUrl(int, const QUrl &);
-    void sendMessage(int, const QByteArray &);
+    void sendMessage(int, const QV4::Serialize::Message &);
 
 protected:
     void run() override;
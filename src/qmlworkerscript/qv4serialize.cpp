@@ -3,6 +3,7 @@
 
 #include "qv4serialize_p.h"
 
+#include <private/qv4arraybuffer_p.h>
 #include <private/qv4dateobject_p.h>
 #include <private/qv4objectproto_p.h>
 #include <private/qv4qobjectwrapper_p.h>
@@ -11,6 +12,10 @@
 #include <private/qv4sequenceobject_p.h>
 #include <private/qv4value_p.h>
 
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 using namespace QV4;
@@ -27,6 +32,8 @@ using namespace QV4;
 //    + Number
 //    + Date
 //    + RegExp
+//    + ArrayBuffer (copied, or moved when listed in the transfer list; an
+//      ArrayBuffer referred to more than once arrives as a single object)
 // <quint8 type><quint24 size><data>
 
 enum Type {
@@ -45,7 +52,10 @@ enum Type {
     WorkerRegexp,
     WorkerListModel,
     WorkerUrl,
-    WorkerSequence
+    WorkerSequence,
+    WorkerArrayBuffer,
+    WorkerTransferredArrayBuffer,
+    WorkerArrayBufferReference
 };
 
 static inline quint32 valueheader(Type type, quint32 size = 0)
@@ -124,10 +134,27 @@ static inline void serializeString(QByteArray &data, const QString &str, Type ty
     memcpy(buffer, str.constData(), length*sizeof(QChar));
 }
 
+struct Serialize::Transfer
+{
+    QVarLengthArray<Heap::ArrayBuffer *, 4> buffers;
+    // ArrayBuffers already written to the message, copied or transferred, in order
+    QVarLengthArray<Heap::ArrayBuffer *, 4> serialized;
+
+    qsizetype indexOf(const Heap::ArrayBuffer *buffer) const
+    {
+        return std::find(buffers.cbegin(), buffers.cend(), buffer) - buffers.cbegin();
+    }
+    bool contains(const Heap::ArrayBuffer *buffer) const
+    {
+        return indexOf(buffer) != buffers.size();
+    }
+};
+
 // XXX TODO: Check that worker script is exception safe in the case of
 // serialization/deserialization failures
 
-void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine *engine)
+void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine *engine,
+                          Transfer *transfer)
 {
     QV4::Scope scope(engine);
 
@@ -155,7 +182,7 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         push(data, valueheader(WorkerArray, length));
         ScopedValue val(scope);
         for (uint ii = 0; ii < length; ++ii)
-            serialize(data, (val = array->get(ii)), engine);
+            serialize(data, (val = array->get(ii)), engine, transfer);
     } else if (v.isInteger()) {
         reserve(data, 2 * sizeof(quint32));
         push(data, valueheader(WorkerInt32));
@@ -191,6 +218,34 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         char *buffer = data.data() + offset;
 
         memcpy(buffer, pattern.constData(), length*sizeof(QChar));
+    } else if (const ArrayBuffer *buffer = v.as<ArrayBuffer>()) {
+        const auto serialized = std::find(transfer->serialized.cbegin(), transfer->serialized.cend(),
+                                          buffer->d());
+        if (serialized != transfer->serialized.cend()) {
+            push(data, valueheader(WorkerArrayBufferReference,
+                                   quint32(serialized - transfer->serialized.cbegin())));
+            return;
+        }
+        if (transfer->contains(buffer->d())) {
+            transfer->serialized.append(buffer->d());
+            push(data, valueheader(WorkerTransferredArrayBuffer, quint32(transfer->indexOf(buffer->d()))));
+            return;
+        }
+        if (buffer->hasDetachedArrayData()) {
+            push(data, valueheader(WorkerUndefined));
+            return;
+        }
+        transfer->serialized.append(buffer->d());
+        const quint32 length = buffer->arrayDataLength();
+        const int size = ALIGN(length);
+
+        reserve(data, 2 * sizeof(quint32) + size);
+        push(data, valueheader(WorkerArrayBuffer));
+        push(data, length);
+
+        int offset = data.size();
+        data.resize(data.size() + size);
+        memcpy(data.data() + offset, buffer->constArrayData(), length);
     } else if (const QObjectWrapper *qobjectWrapper = v.as<QV4::QObjectWrapper>()) {
         // XXX TODO: Generalize passing objects between the main thread and worker scripts so
         // that others can trivially plug in their elements.
@@ -218,11 +273,11 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
 
         // sequence type
         serialize(data, QV4::Value::fromInt32(
-                                QV4::SequencePrototype::metaTypeForSequence(s).id()), engine);
+                                QV4::SequencePrototype::metaTypeForSequence(s).id()), engine, transfer);
 
         ScopedValue val(scope);
         for (uint ii = 0; ii < seqLength; ++ii)
-            serialize(data, (val = s->get(ii)), engine); // sequence elements
+            serialize(data, (val = s->get(ii)), engine, transfer); // sequence elements
 
         return;
     } else if (const Object *o = v.as<Object>()) {
@@ -246,14 +301,14 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         QV4::ScopedValue s(scope);
         for (quint32 ii = 0; ii < length; ++ii) {
             s = properties->get(ii);
-            serialize(data, s, engine);
+            serialize(data, s, engine, transfer);
 
             QV4::String *str = s->as<String>();
             val = o->get(str);
             if (scope.hasException())
                 scope.engine->catchException();
 
-            serialize(data, val, engine);
+            serialize(data, val, engine, transfer);
         }
         return;
     } else {
@@ -296,7 +351,14 @@ Q_DECLARE_METATYPE(VariantRef)
 Q_DECLARE_METATYPE(QV4::ExecutionEngine *)
 QT_BEGIN_NAMESPACE
 
-ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
+struct Serialize::Received
+{
+    const QList<QByteArray> *buffers = nullptr;
+    // The ArrayBuffers created so far, in the order they were serialized
+    ArrayObject *deserialized = nullptr;
+};
+
+ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine, Received *received)
 {
     quint32 header = popUint32(data);
     Type type = headertype(header);
@@ -331,7 +393,7 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         ScopedArrayObject a(scope, engine->newArrayObject());
         ScopedValue v(scope);
         for (quint32 ii = 0; ii < size; ++ii) {
-            v = deserialize(data, engine);
+            v = deserialize(data, engine, received);
             a->put(ii, v);
         }
         return a.asReturnedValue();
@@ -344,8 +406,8 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         ScopedString n(scope);
         ScopedValue value(scope);
         for (quint32 ii = 0; ii < size; ++ii) {
-            name = deserialize(data, engine);
-            value = deserialize(data, engine);
+            name = deserialize(data, engine, received);
+            value = deserialize(data, engine, received);
             n = name->asReturnedValue();
             o->put(n, value);
         }
@@ -387,18 +449,38 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         ScopedValue value(scope);
         quint32 length = headersize(header);
         quint32 seqLength = length - 1;
-        value = deserialize(data, engine);
+        value = deserialize(data, engine, received);
         int sequenceType = value->integerValue();
         ScopedArrayObject array(scope, engine->newArrayObject());
         array->arrayReserve(seqLength);
         for (quint32 ii = 0; ii < seqLength; ++ii) {
-            value = deserialize(data, engine);
+            value = deserialize(data, engine, received);
             array->arrayPut(ii, value);
         }
         array->setArrayLengthUnchecked(seqLength);
         QVariant seqVariant = QV4::SequencePrototype::toVariant(array, QMetaType(sequenceType));
         return QV4::SequencePrototype::fromVariant(engine, seqVariant);
     }
+    case WorkerArrayBuffer:
+    {
+        quint32 length = popUint32(data);
+        QV4::ScopedValue buffer(scope, engine->newArrayBuffer(QByteArray(data, length)));
+        data += ALIGN(length);
+        received->deserialized->push_back(buffer);
+        return buffer->asReturnedValue();
+    }
+    case WorkerTransferredArrayBuffer:
+    {
+        // Shares the transferred contents, so no copy is made on this side either
+        quint32 index = headersize(header);
+        QV4::ScopedValue buffer(scope, QV4::Encode::undefined());
+        if (received->buffers && index < quint32(received->buffers->size()))
+            buffer = engine->newArrayBuffer(received->buffers->at(index));
+        received->deserialized->push_back(buffer);
+        return buffer->asReturnedValue();
+    }
+    case WorkerArrayBufferReference:
+        return received->deserialized->get(headersize(header));
     }
     Q_ASSERT(!"Unreachable");
     return QV4::Encode::undefined();
@@ -407,14 +489,64 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
 QByteArray Serialize::serialize(const QV4::Value &value, ExecutionEngine *engine)
 {
     QByteArray rv;
-    serialize(rv, value, engine);
+    Transfer transfer;
+    serialize(rv, value, engine, &transfer);
     return rv;
 }
 
+Serialize::Message Serialize::serialize(const QV4::Value &value, const QV4::Value &transferList,
+                                        ExecutionEngine *engine)
+{
+    Scope scope(engine);
+    Message message;
+    Transfer transfer;
+
+    if (!transferList.isNullOrUndefined()) {
+        ScopedArrayObject list(scope, transferList);
+        if (!list) {
+            engine->throwTypeError(QStringLiteral("sendMessage: the transfer list must be an array"));
+            return message;
+        }
+
+        ScopedValue entry(scope);
+        for (uint ii = 0, length = list->getLength(); ii < length; ++ii) {
+            entry = list->get(ii);
+            const ArrayBuffer *buffer = entry->as<ArrayBuffer>();
+            if (!buffer || buffer->hasDetachedArrayData()) {
+                engine->throwTypeError(QStringLiteral("sendMessage: only ArrayBuffers that are not detached can be transferred"));
+                return message;
+            }
+            if (transfer.contains(buffer->d())) {
+                engine->throwTypeError(QStringLiteral("sendMessage: an ArrayBuffer is listed more than once in the transfer list"));
+                return message;
+            }
+            transfer.buffers.append(buffer->d());
+        }
+    }
+
+    serialize(message.data, value, engine, &transfer);
+
+    // Transferred buffers are detached on the sending side, whether or not the
+    // message refers to them.
+    message.buffers.reserve(transfer.buffers.size());
+    for (Heap::ArrayBuffer *buffer : std::as_const(transfer.buffers))
+        message.buffers.append(buffer->takeArrayData());
+
+    return message;
+}
+
 ReturnedValue Serialize::deserialize(const QByteArray &data, ExecutionEngine *engine)
 {
-    const char *stream = data.constData();
-    return deserialize(stream, engine);
+    return deserialize(Message { data, {} }, engine);
+}
+
+ReturnedValue Serialize::deserialize(const Message &message, ExecutionEngine *engine)
+{
+    Scope scope(engine);
+    ScopedArrayObject deserialized(scope, engine->newArrayObject());
+    Received received { &message.buffers, deserialized.getPointer() };
+    const char *stream = message.data.constData();
+    return deserialize(stream, engine, &received);
 }
 
 QT_END_NAMESPACE
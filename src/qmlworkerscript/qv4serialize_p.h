@@ -16,6 +16,7 @@
 //
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
 #include <private/qv4value_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -24,13 +25,25 @@ namespace QV4 {
 
 class Serialize {
 public:
+    // A serialized value, along with the contents of the ArrayBuffers that were
+    // transferred rather than copied into it.
+    struct Message
+    {
+        QByteArray data;
+        QList<QByteArray> buffers;
+    };
 
     static QByteArray serialize(const Value &, ExecutionEngine *);
+    static Message serialize(const Value &, const Value &transfer, ExecutionEngine *);
     static ReturnedValue deserialize(const QByteArray &, ExecutionEngine *);
+    static ReturnedValue deserialize(const Message &, ExecutionEngine *);
 
 private:
-    static void serialize(QByteArray &, const Value &, ExecutionEngine *);
-    static ReturnedValue deserialize(const char *&, ExecutionEngine *);
+    struct Transfer;
+    struct Received;
+
+    static void serialize(QByteArray &, const Value &, ExecutionEngine *, Transfer *);
+    static ReturnedValue deserialize(const char *&, ExecutionEngine *, Received *);
 };
 
 }
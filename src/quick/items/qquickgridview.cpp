@@ -501,7 +501,7 @@ bool QQuickGridViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
     FxGridItemSG *item = nullptr;
     bool changed = false;
 
-    QQmlIncubator::IncubationMode incubationMode = doBuffer ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
+    const QQmlIncubator::IncubationMode incubationMode = refillIncubationMode(doBuffer);
 
     while (modelIndex < model->count() && rowPos <= fillTo + rowSize()*(columns - colNum)/(columns+1)) {
         qCDebug(lcItemViewDelegateLifecycle) << "refill: append item" << modelIndex << colPos << rowPos;
@@ -1413,6 +1413,59 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
     \sa {Reusing items}, pooled(), reused()
 */
 
+/*!
+    \qmlproperty int QtQuick::GridView::incubationBudget
+    \since 6.10
+
+    This property holds the time in milliseconds per frame that may be spent
+    on creating delegate items while the view is moving.
+
+    By default, delegate items that scroll into view are created
+    synchronously, which can cause dropped frames when delegates are
+    expensive and the view is flicked fast. If the budget is larger than
+    \c 0, such items are instead incubated asynchronously while the view is
+    moving, or when positionViewAtIndex() jumps to another part of the
+    grid, spending at most this much time per frame. Items then appear over the
+    following frames; the item that is jumped to is still created right away.
+
+    When several views in the same window set a budget, the smallest one is
+    used. Once no view in the window sets a budget, the default of a third of
+    a frame is used again.
+
+    The budget only has an effect if the QML engine uses the incubation
+    controller of a QQuickWindow, which is the case for QQuickView and
+    QQmlApplicationEngine.
+
+    This property is \c 0 by default.
+*/
+
+/*!
+    \qmlproperty int QtQuick::GridView::prefetchMargin
+    \since 6.10
+
+    This property holds the number of cells before and after the created
+    delegate items whose model data the grid view requests ahead of time.
+
+    The margin is counted in cells, not in rows or columns. To request the
+    data of whole rows with \l flow set to \c GridView.FlowLeftToRight, or
+    of whole columns with \c GridView.FlowTopToBottom, use a multiple of the
+    number of cells per row or column.
+
+    Unlike \l cacheBuffer, this doesn't create any delegate items. Models
+    that load their data lazily, for example from a database or over the
+    network, can have the data of the cells that are about to scroll into
+    view ready by the time their delegates are created. When the margin
+    reaches past the end of a model that can fetch more rows, more rows are
+    fetched.
+
+    For QAbstractItemModel based models, the roles that the delegates read
+    are requested in one call to QAbstractItemModel::multiData() per cell,
+    and kept until the delegate of the cell is created. Other models are not
+    affected by this property.
+
+    This property is \c 0 by default.
+*/
+
 /*!
     \qmlattachedsignal QtQuick::GridView::pooled()
 
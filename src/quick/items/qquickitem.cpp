@@ -51,6 +51,8 @@
 
 #include <QtCore/qpointer.h>
 
+#include <array>
+#include <atomic>
 #include <algorithm>
 #include <limits>
 
@@ -2828,6 +2830,7 @@ void QQuickItem::setParentItem(QQuickItem *parentItem)
         QQuickWindowPrivate::get(d->window)->parentlessItems.insert(this);
 
     d->setEffectiveVisibleRecur(d->calcEffectiveVisible());
+    d->updateBindingsParked();
     d->setEffectiveEnableRecur(nullptr, d->calcEffectiveEnable());
 
     if (d->parentItem) {
@@ -3142,6 +3145,8 @@ void QQuickItemPrivate::derefWindow()
         c->cleanup(itemNodeInstance);
     if (!parentItem)
         c->parentlessItems.remove(q);
+    if (Q_UNLIKELY(!c->incubationBudgets.isEmpty()))
+        c->incubationBudgets.remove(q);
 
     window = nullptr;
 
@@ -3281,6 +3286,8 @@ QQuickItemPrivate::QQuickItemPrivate()
     , inDestructor(false)
     , focusReason(Qt::OtherFocusReason)
     , focusPolicy(Qt::NoFocus)
+    , parkBindingsWhenHidden(false)
+    , subtreeMayParkBindings(false)
     , dirtyAttributes(0)
     , nextDirtyItem(nullptr)
     , prevDirtyItem(nullptr)
@@ -5406,6 +5413,9 @@ void QQuickItem::componentComplete()
         QQuickWindowPrivate::get(d->window)->dirtyItem(this);
     }
 
+    // Children that completed earlier already know about their own state.
+    d->updateBindingsParked(false);
+
 #if QT_CONFIG(accessibility)
     if (d->isAccessible && d->effectiveVisible) {
         QAccessibleEvent ev(this, QAccessible::ObjectShow);
@@ -6478,7 +6488,10 @@ void QQuickItem::setOpacity(qreal newOpacity)
     if (d->opacity() == o)
         return;
 
+    const bool wasTransparent = d->opacity() == 0.0;
     d->extra.value().opacity = o;
+    if (wasTransparent != (o == 0.0))
+        d->updateBindingsParked();
 
     d->dirty(QQuickItemPrivate::OpacityValue);
 
@@ -6567,6 +6580,7 @@ void QQuickItemPrivate::setVisible(bool visible)
         dirty(QQuickItemPrivate::Visible);
 
     const bool childVisibilityChanged = setEffectiveVisibleRecur(calcEffectiveVisible());
+    updateBindingsParked();
     if (childVisibilityChanged && parentItem)
         emit parentItem->visibleChildrenChanged();   // signal the parent, not this!
 }
@@ -6688,6 +6702,152 @@ bool QQuickItemPrivate::setEffectiveVisibleRecur(bool newEffectiveVisible)
     return true;    // effective visibility DID change
 }
 
+// Set once, but read by items created on loader threads, too.
+static std::atomic<bool> bindingParkingUsed = false;
+
+static bool mayParkItemBinding(QObject *object, int coreIndex)
+{
+    Q_UNUSED(object);
+
+    // Bindings deciding whether the item is hidden must stay live,
+    // or the item could never become visible again. The geometry of hidden
+    // items is still read through C++ getters by anchors, positioners and
+    // layouts, so it must stay live as well.
+    static const auto liveIndexes = []() {
+        const QMetaObject &mo = QQuickItem::staticMetaObject;
+        return std::array<int, 8> {
+            mo.indexOfProperty("visible"), mo.indexOfProperty("opacity"),
+            mo.indexOfProperty("x"), mo.indexOfProperty("y"),
+            mo.indexOfProperty("width"), mo.indexOfProperty("height"),
+            mo.indexOfProperty("implicitWidth"), mo.indexOfProperty("implicitHeight")
+        };
+    }();
+    return std::find(liveIndexes.cbegin(), liveIndexes.cend(), coreIndex) == liveIndexes.cend();
+}
+
+static void enableBindingParking()
+{
+    if (bindingParkingUsed.load(std::memory_order_acquire))
+        return;
+    // The filter is always the same, so concurrent calls are harmless.
+    QQmlData::bindingParkingFilter.store(&mayParkItemBinding, std::memory_order_release);
+    bindingParkingUsed.store(true, std::memory_order_release);
+}
+
+static std::atomic<bool> &parkHiddenBindingsGloballyFlag()
+{
+    static std::atomic<bool> park = []() {
+        const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_PARK_HIDDEN_BINDINGS");
+        if (enabled)
+            enableBindingParking();
+        return enabled;
+    }();
+    return park;
+}
+
+/*!
+    \internal
+    Returns whether bindings on effectively invisible or fully transparent items are
+    parked for all items. This can be enabled by setting the environment variable
+    \c QT_QUICK_PARK_HIDDEN_BINDINGS to \c 1.
+
+    While an item's bindings are parked, change notifications only mark them as
+    pending. They are evaluated when the property is read from QML, or when the
+    item is shown again. Bindings on \c visible and \c opacity are never parked.
+ */
+bool QQuickItemPrivate::parkHiddenBindingsGlobally()
+{
+    return parkHiddenBindingsGloballyFlag().load(std::memory_order_relaxed);
+}
+
+void QQuickItemPrivate::setParkHiddenBindingsGlobally(bool park)
+{
+    if (park)
+        enableBindingParking();
+    parkHiddenBindingsGloballyFlag().store(park, std::memory_order_relaxed);
+}
+
+/*!
+    \internal
+    Enables parking of bindings in this item's subtree while it is hidden,
+    regardless of parkHiddenBindingsGlobally().
+ */
+void QQuickItemPrivate::setParkBindingsWhenHidden(bool park)
+{
+    if (bool(parkBindingsWhenHidden) == park)
+        return;
+
+    if (park)
+        enableBindingParking();
+    parkBindingsWhenHidden = park;
+    updateBindingsParked();
+}
+
+void QQuickItemPrivate::updateBindingsParked(bool recursive)
+{
+    if (!bindingParkingUsed.load(std::memory_order_acquire))
+        return;
+
+    bool parkingEnabled = parkHiddenBindingsGlobally();
+    bool hidden = false;
+    for (QQuickItem *p = parentItem; p; p = QQuickItemPrivate::get(p)->parentItem) {
+        QQuickItemPrivate *pd = QQuickItemPrivate::get(p);
+        parkingEnabled |= bool(pd->parkBindingsWhenHidden);
+        hidden |= pd->opacity() == 0.0;
+    }
+
+    // Nothing in this subtree is parked, or can be.
+    if (!parkingEnabled && !parkBindingsWhenHidden && !subtreeMayParkBindings)
+        return;
+
+    if (!updateBindingsParkedRecur(parkingEnabled, hidden, recursive))
+        return;
+
+    for (QQuickItem *p = parentItem; p; p = QQuickItemPrivate::get(p)->parentItem) {
+        QQuickItemPrivate *pd = QQuickItemPrivate::get(p);
+        if (pd->subtreeMayParkBindings)
+            break;
+        pd->subtreeMayParkBindings = true;
+    }
+}
+
+/*!
+    \internal
+    Parks or unparks the bindings of this item and, if \a recursive is set,
+    of the items below it. Only children that may have parked bindings, or
+    that opted into parking themselves, are visited unless this item's
+    bindings are parked. Returns whether anything in the subtree may be
+    parked.
+*/
+bool QQuickItemPrivate::updateBindingsParkedRecur(bool parkingEnabled, bool hidden, bool recursive)
+{
+    Q_Q(QQuickItem);
+
+    // Bindings are enabled in one go at the end of object creation.
+    if (!componentComplete)
+        return subtreeMayParkBindings;
+
+    parkingEnabled |= bool(parkBindingsWhenHidden);
+    hidden |= !effectiveVisible || opacity() == 0.0;
+    const bool park = parkingEnabled && hidden;
+
+    QQmlData::setBindingsParked(q, park);
+
+    bool mayPark = park || parkBindingsWhenHidden;
+    if (recursive) {
+        for (QQuickItem *child : std::as_const(childItems)) {
+            QQuickItemPrivate *childPrivate = QQuickItemPrivate::get(child);
+            if (park || childPrivate->subtreeMayParkBindings || childPrivate->parkBindingsWhenHidden)
+                mayPark |= childPrivate->updateBindingsParkedRecur(parkingEnabled, hidden, true);
+        }
+    } else {
+        mayPark |= bool(subtreeMayParkBindings);
+    }
+
+    subtreeMayParkBindings = mayPark;
+    return mayPark;
+}
+
 bool QQuickItemPrivate::calcEffectiveEnable() const
 {
     // XXX todo - Should the effective enable of an element with no parent just be the current
@@ -555,7 +555,11 @@ public:
     quint32 inDestructor:1; // has entered ~QQuickItem
     quint32 focusReason:4;
     quint32 focusPolicy:4;
-    // Bit 53
+    // set true when bindings in this item's subtree should be parked while it is hidden
+    quint32 parkBindingsWhenHidden:1;
+    // set true when this item or one below it has parked bindings or parkBindingsWhenHidden
+    quint32 subtreeMayParkBindings:1;
+    // Bit 55
 
     enum DirtyType {
         TransformOrigin         = 0x00000001,
@@ -725,6 +729,12 @@ public:
 
     bool calcEffectiveVisible() const;
     bool setEffectiveVisibleRecur(bool);
+
+    static bool parkHiddenBindingsGlobally();
+    static void setParkHiddenBindingsGlobally(bool park);
+    void setParkBindingsWhenHidden(bool park);
+    void updateBindingsParked(bool recursive = true);
+    bool updateBindingsParkedRecur(bool parkingEnabled, bool hidden, bool recursive);
     bool calcEffectiveEnable() const;
     void setEffectiveEnableRecur(QQuickItem *scope, bool);
 
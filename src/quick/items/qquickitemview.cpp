@@ -5,7 +5,9 @@
 #include <QtQml/qqmlcomponent.h>
 #include "qquickitemviewfxitem_p_p.h"
 #include <QtQuick/private/qquicktransition_p.h>
+#include <QtQuick/private/qquickwindow_p.h>
 #include <QtQml/QQmlInfo>
+#include <QtCore/qscopedvaluerollback.h>
 #include "qplatformdefs.h"
 
 QT_BEGIN_NAMESPACE
@@ -126,6 +128,8 @@ QQuickItemView::QQuickItemView(QQuickFlickablePrivate &dd, QQuickItem *parent)
 QQuickItemView::~QQuickItemView()
 {
     Q_D(QQuickItemView);
+    if (d->incubationBudget > 0)
+        QQuickWindowPrivate::setIncubationBudget(this, 0);
     d->clear(true);
     if (d->ownModel)
         delete d->model;
@@ -178,6 +182,8 @@ void QQuickItemView::setModel(const QVariant &m)
                     delegateModel, &QQmlDelegateModel::delegateModelAccessChanged,
                     d, &QQuickItemViewPrivate::applyDelegateModelAccessChange);
         }
+        QObjectPrivate::disconnect(instanceModel, &QQmlInstanceModel::changesPending,
+                                   d, &QQuickItemViewPrivate::scheduleModelChanges);
     }
 
     d->clear();
@@ -278,6 +284,8 @@ void QQuickItemView::setModel(const QVariant &m)
 
         connect(instanceModel, &QQmlInstanceModel::modelUpdated,
                 this, &QQuickItemView::modelUpdated);
+        QObjectPrivate::connect(instanceModel, &QQmlInstanceModel::changesPending,
+                                d, &QQuickItemViewPrivate::scheduleModelChanges);
         if (QQmlDelegateModel *dataModel = newModel.delegateModel()) {
             QObjectPrivate::connect(
                     dataModel, &QQmlDelegateModel::delegateChanged,
@@ -768,6 +776,44 @@ void QQuickItemView::setReuseItems(bool reuse)
     emit reuseItemsChanged();
 }
 
+int QQuickItemView::incubationBudget() const
+{
+    Q_D(const QQuickItemView);
+    return d->incubationBudget;
+}
+
+void QQuickItemView::setIncubationBudget(int msecs)
+{
+    Q_D(QQuickItemView);
+    msecs = qMax(0, msecs);
+    if (d->incubationBudget == msecs)
+        return;
+
+    d->incubationBudget = msecs;
+    QQuickWindowPrivate::setIncubationBudget(this, msecs);
+    emit incubationBudgetChanged();
+}
+
+int QQuickItemView::prefetchMargin() const
+{
+    Q_D(const QQuickItemView);
+    return d->prefetchMargin;
+}
+
+void QQuickItemView::setPrefetchMargin(int count)
+{
+    Q_D(QQuickItemView);
+    count = qMax(0, count);
+    if (d->prefetchMargin == count)
+        return;
+
+    d->prefetchMargin = count;
+    d->resetPrefetch();
+    if (isComponentComplete())
+        d->prefetchItems();
+    emit prefetchMarginChanged();
+}
+
 #if QT_CONFIG(quick_viewtransitions)
 QQuickTransition *QQuickItemView::populateTransition() const
 {
@@ -911,6 +957,8 @@ void QQuickItemViewPrivate::positionViewAtIndex(int index, int mode)
     const int modelCount = model->count();
     int idx = qMax(qMin(index, modelCount - 1), 0);
 
+    const QScopedValueRollback<int> jumpTargetRollback(jumpTargetIndex, idx);
+
     const auto viewSize = size();
     qreal pos = isContentFlowReversed() ? -position() - viewSize : position();
     FxViewItem *item = visibleItem(idx);
@@ -1037,6 +1085,8 @@ QQuickItem *QQuickItemView::itemAtIndex(int index) const
 void QQuickItemView::forceLayout()
 {
     Q_D(QQuickItemView);
+    if (d->model)
+        d->model->flushChanges();
     if (isComponentComplete() && (d->currentChanges.hasPendingChanges() || d->forceLayout))
         d->layout();
 }
@@ -1165,6 +1215,22 @@ qreal QQuickItemViewPrivate::calculatedMaxExtent() const
     return maxExtent;
 }
 
+/*
+  Called when a model that coalesces its changes has collected some. They
+  are flushed by layout(), so that all the changes made until the next frame
+  are applied at once. A window that doesn't render polishes nothing, so the
+  model then flushes them when the event loop is returned to.
+*/
+void QQuickItemViewPrivate::scheduleModelChanges()
+{
+    Q_Q(QQuickItemView);
+    QQuickWindow *window = q->window();
+    if (window && window->isExposed() && q->isComponentComplete())
+        q->polish();
+    else if (model)
+        QCoreApplication::postEvent(model, new QEvent(QEvent::UpdateLater));
+}
+
 void QQuickItemViewPrivate::applyDelegateChange()
 {
     Q_Q(QQuickItemView);
@@ -1446,6 +1512,15 @@ void QQuickItemView::geometryChange(const QRectF &newGeometry, const QRectF &old
     QQuickFlickable::geometryChange(newGeometry, oldGeometry);
 }
 
+void QQuickItemView::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    Q_D(QQuickItemView);
+    // The budget applies to the window the view is in
+    if (change == ItemSceneChange && value.window && d->incubationBudget > 0)
+        QQuickWindowPrivate::setIncubationBudget(this, d->incubationBudget);
+    QQuickFlickable::itemChange(change, value);
+}
+
 qreal QQuickItemView::minYExtent() const
 {
     Q_D(const QQuickItemView);
@@ -1826,6 +1901,7 @@ void QQuickItemViewPrivate::clear(bool onDestruction)
 
     markExtentsDirty();
     itemCount = 0;
+    resetPrefetch();
 }
 
 
@@ -1913,6 +1989,7 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
             emitCountChanged();
     } while (currentChanges.hasPendingChanges() || bufferedChanges.hasPendingChanges());
     storeFirstVisibleItemPosition();
+    prefetchItems();
 }
 
 void QQuickItemViewPrivate::regenerate(bool orientationChanged)
@@ -1952,6 +2029,9 @@ void QQuickItemViewPrivate::layout()
     if (inLayout)
         return;
 
+    if (model)
+        model->flushChanges();
+
     inLayout = true;
 
     // viewBounds contains bounds before any add/remove/move operation to the view
@@ -2101,6 +2181,7 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
     }
 
     updateUnrequestedIndexes();
+    resetPrefetch();
 
     FxViewItem *prevVisibleItemsFirst = visibleItems.size() ? *visibleItems.constBegin() : nullptr;
     int prevItemCount = itemCount;
@@ -2129,6 +2210,7 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
     int removedCount = 0;
     for (const QQmlChangeSet::Change &r : removals) {
         itemCount -= r.count;
+        modelItemsRemoved(r);
         if (applyRemovalChange(r, &removalResult, &removedCount))
             visibleAffected = true;
         if (!visibleAffected && needsRefillForAddedOrRemovedIndex(r.index))
@@ -2188,6 +2270,7 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
             storeFirstVisibleItemPosition();
         }
         itemCount += insertions[i].count;
+        modelItemsInserted(insertions[i]);
     }
     for (FxViewItem *item : std::as_const(newItems)) {
         if (item->attached)
@@ -2448,6 +2531,54 @@ void QQuickItemViewPrivate::viewItemTransitionFinished(QQuickItemViewTransitiona
 }
 #endif
 
+/*
+  Items in the buffer are always incubated asynchronously. Visible items are
+  only incubated asynchronously while the view moves or jumps to an index,
+  and if an incubation budget is set. They then fill in over the following
+  frames, instead of blocking the frame in which they scroll into view. The
+  item that is jumped to is still created synchronously by createItem().
+*/
+QQmlIncubator::IncubationMode QQuickItemViewPrivate::refillIncubationMode(bool doBuffer) const
+{
+    Q_Q(const QQuickItemView);
+    if (doBuffer || (incubationBudget > 0 && (q->isMoving() || jumpTargetIndex != -1)))
+        return QQmlIncubator::Asynchronous;
+    return QQmlIncubator::AsynchronousIfNested;
+}
+
+/*
+  Asks the model for the data of the prefetchMargin items after the created
+  ones, and before them, in the directions the view moves in. Only the items
+  that were not part of the previous request are passed on, so that moving
+  by one item costs one item's worth of model data.
+*/
+void QQuickItemViewPrivate::prefetchItems()
+{
+    if (prefetchMargin <= 0 || !model || visibleItems.isEmpty())
+        return;
+    const int lastIndex = findLastVisibleIndex();
+    if (lastIndex < 0)
+        return;
+
+    int from = visibleIndex;
+    int to = lastIndex + 1;
+    if (bufferMode & BufferBefore)
+        from = qMax(0, from - prefetchMargin);
+    if (bufferMode & BufferAfter)
+        to += prefetchMargin;
+
+    if (to <= prefetchedFrom || from >= prefetchedTo) {
+        model->prefetch(from, to - from);
+    } else {
+        if (from < prefetchedFrom)
+            model->prefetch(from, prefetchedFrom - from);
+        if (to > prefetchedTo)
+            model->prefetch(prefetchedTo, to - prefetchedTo);
+    }
+    prefetchedFrom = from;
+    prefetchedTo = to;
+}
+
 /*
   This may return 0 if the item is being created asynchronously.
   When the item becomes available, refill() will be called and the item
@@ -2457,6 +2588,10 @@ FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::Inc
 {
     Q_Q(QQuickItemView);
 
+    // The view is positioned relative to the item that it jumps to
+    if (modelIndex == jumpTargetIndex)
+        incubationMode = QQmlIncubator::AsynchronousIfNested;
+
     if (requestedIndex == modelIndex && incubationMode == QQmlIncubator::Asynchronous)
         return nullptr;
 
@@ -2520,10 +2655,7 @@ void QQuickItemView::createdItem(int index, QObject* object)
     if (!d->inRequest) {
         d->unrequestedItems.insert(item, index);
         d->requestedIndex = -1;
-        if (d->hasPendingChanges())
-            d->layout();
-        else
-            d->refill();
+        d->refillOrLayout();
         if (d->unrequestedItems.contains(item))
             d->repositionPackageItemAt(item, index);
         else if (index == d->currentIndex)
@@ -83,6 +83,10 @@ class Q_QUICK_EXPORT QQuickItemView : public QQuickFlickable
     Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged REVISION(2, 15))
     Q_PROPERTY(QQmlDelegateModel::DelegateModelAccess delegateModelAccess READ delegateModelAccess
             WRITE setDelegateModelAccess NOTIFY delegateModelAccessChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(int incubationBudget READ incubationBudget WRITE setIncubationBudget
+            NOTIFY incubationBudgetChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(int prefetchMargin READ prefetchMargin WRITE setPrefetchMargin
+            NOTIFY prefetchMarginChanged REVISION(6, 10) FINAL)
 
     QML_NAMED_ELEMENT(ItemView)
     QML_UNCREATABLE("ItemView is an abstract base class.")
@@ -205,6 +209,12 @@ public:
     bool reuseItems() const;
     void setReuseItems(bool reuse);
 
+    int incubationBudget() const;
+    void setIncubationBudget(int msecs);
+
+    int prefetchMargin() const;
+    void setPrefetchMargin(int count);
+
     enum PositionMode { Beginning, Center, End, Visible, Contain, SnapPosition };
     Q_ENUM(PositionMode)
 
@@ -267,11 +277,14 @@ Q_SIGNALS:
 
     Q_REVISION(2, 15) void reuseItemsChanged();
     Q_REVISION(6, 10) void delegateModelAccessChanged();
+    Q_REVISION(6, 10) void incubationBudgetChanged();
+    Q_REVISION(6, 10) void prefetchMarginChanged();
 
 protected:
     void updatePolish() override;
     void componentComplete() override;
     void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
     qreal minYExtent() const override;
     qreal maxYExtent() const override;
     qreal minXExtent() const override;
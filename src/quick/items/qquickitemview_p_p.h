@@ -145,6 +145,9 @@ public:
     void mirrorChange() override;
 
     FxViewItem *createItem(int modelIndex,QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested);
+    QQmlIncubator::IncubationMode refillIncubationMode(bool doBuffer) const;
+    void prefetchItems();
+    void resetPrefetch() { prefetchedFrom = prefetchedTo = 0; }
     bool releaseCurrentItem(QQmlInstanceModel::ReusableFlag reusableFlag)
     {
         auto oldCurrentItem = std::exchange(currentItem, nullptr);
@@ -169,6 +172,7 @@ public:
     qreal calculatedMaxExtent() const;
 
     void applyDelegateChange();
+    void scheduleModelChanges();
     void applyDelegateModelAccessChange()
     {
         QQmlDelegateModel::applyDelegateModelAccessChangeOnView(q_func(), this);
@@ -212,6 +216,9 @@ public:
     }
 
     void refillOrLayout() {
+        // A model that coalesces its changes might not have reported them yet
+        if (model)
+            model->flushChanges();
         if (hasPendingChanges())
             layout();
         else
@@ -281,6 +288,18 @@ public:
     // item when it's created and not when it's reused, which will break legacy applications.
     QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable;
 
+    // Milliseconds per frame spent on incubating delegates while the view moves.
+    // 0 means that visible delegates are created synchronously.
+    int incubationBudget = 0;
+    // The index that positionViewAtIndex() jumps to, while it does so
+    int jumpTargetIndex = -1;
+
+    // Number of items beyond the created ones whose model data is requested
+    // ahead of time, and the range of items that was last requested.
+    int prefetchMargin = 0;
+    int prefetchedFrom = 0;
+    int prefetchedTo = 0;
+
     struct MovedItem {
         FxViewItem *item;
         QQmlChangeSet::MoveKey moveKey;
@@ -360,6 +379,8 @@ protected:
                 QList<FxViewItem *> *newItems, QList<MovedItem> *movingIntoView) = 0;
 
     virtual bool needsRefillForAddedOrRemovedIndex(int) const { return false; }
+    virtual void modelItemsInserted(const QQmlChangeSet::Change &) {}
+    virtual void modelItemsRemoved(const QQmlChangeSet::Change &) {}
 #if QT_CONFIG(quick_viewtransitions)
     virtual void translateAndTransitionItemsAfter(int afterIndex, const ChangeResult &insertionResult, const ChangeResult &removalResult) = 0;
 #endif
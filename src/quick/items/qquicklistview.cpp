@@ -4,6 +4,7 @@
 #include "qquicklistview_p.h"
 #include "qquickitemview_p_p.h"
 #include "qquickflickablebehavior_p.h"
+#include "qquicklistviewsizecache_p.h"
 
 #include <private/qqmlobjectmodel_p.h>
 #include <QtQml/qqmlexpression.h>
@@ -102,6 +103,13 @@ public:
     void initializeCurrentItem() override;
 
     void updateAverage();
+    void measureVisibleItems();
+    QQuickListViewSizeCache *itemSizeCache();
+    const QQuickListViewSizeCache *itemSizeCache() const;
+    qreal estimatedSize(int from, int to) const;
+
+    void modelItemsInserted(const QQmlChangeSet::Change &insert) override;
+    void modelItemsRemoved(const QQmlChangeSet::Change &removal) override;
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &oldGeometry) override;
     void fixupPosition() override;
@@ -125,6 +133,10 @@ public:
     QQuickListView::HeaderPositioning headerPositioning;
     QQuickListView::FooterPositioning footerPositioning;
 
+    std::unique_ptr<QQuickListViewSizeCache> sizeCache;
+    // The measured sizes of moved items, from their removal to their insertion
+    QHash<QQmlChangeSet::MoveKey, qreal> movedItemSizes;
+
     std::unique_ptr<QSmoothedAnimation> highlightPosAnimator;
     std::unique_ptr<QSmoothedAnimation> highlightWidthAnimator;
     std::unique_ptr<QSmoothedAnimation> highlightHeightAnimator;
@@ -490,7 +502,7 @@ qreal QQuickListViewPrivate::originPosition() const
     if (!visibleItems.isEmpty()) {
         pos = (*visibleItems.constBegin())->position();
         if (visibleIndex > 0)
-            pos -= visibleIndex * (averageSize + spacing);
+            pos -= estimatedSize(0, visibleIndex);
     }
     return pos;
 }
@@ -517,9 +529,9 @@ qreal QQuickListViewPrivate::lastPosition() const
         }
         pos = (*(visibleItems.constEnd() - 1))->endPosition();
         if (invisibleCount > 0)
-            pos += invisibleCount * (averageSize + spacing);
+            pos += estimatedSize(model->count() - invisibleCount, model->count());
     } else if (model && model->count()) {
-        pos = (model->count() * averageSize + (model->count()-1) * spacing);
+        pos = estimatedSize(0, model->count()) - spacing;
     }
     return pos;
 }
@@ -531,16 +543,17 @@ qreal QQuickListViewPrivate::positionAt(int modelIndex) const
     }
     if (!visibleItems.isEmpty()) {
         if (modelIndex < visibleIndex) {
-            int count = visibleIndex - modelIndex;
+            int from = modelIndex;
             qreal cs = 0;
             if (modelIndex == currentIndex && currentItem) {
                 cs = currentItem->size() + spacing;
-                --count;
+                ++from;
             }
-            return (*visibleItems.constBegin())->position() - count * (averageSize + spacing) - cs;
+            return (*visibleItems.constBegin())->position() - estimatedSize(from, visibleIndex) - cs;
         } else {
-            int count = modelIndex - findLastVisibleIndex(visibleIndex) - 1;
-            return (*(visibleItems.constEnd() - 1))->endPosition() + spacing + count * (averageSize + spacing);
+            const int lastVisibleIndex = findLastVisibleIndex(visibleIndex);
+            return (*(visibleItems.constEnd() - 1))->endPosition() + spacing
+                    + estimatedSize(lastVisibleIndex + 1, modelIndex);
         }
     }
     return 0;
@@ -552,11 +565,11 @@ qreal QQuickListViewPrivate::endPositionAt(int modelIndex) const
         return item->endPosition();
     if (!visibleItems.isEmpty()) {
         if (modelIndex < visibleIndex) {
-            int count = visibleIndex - modelIndex;
-            return (*visibleItems.constBegin())->position() - (count - 1) * (averageSize + spacing) - spacing;
+            return (*visibleItems.constBegin())->position() - estimatedSize(modelIndex + 1, visibleIndex) - spacing;
         } else {
-            int count = modelIndex - findLastVisibleIndex(visibleIndex) - 1;
-            return (*(visibleItems.constEnd() - 1))->endPosition() + count * (averageSize + spacing);
+            const int lastVisibleIndex = findLastVisibleIndex(visibleIndex);
+            return (*(visibleItems.constEnd() - 1))->endPosition()
+                    + estimatedSize(lastVisibleIndex + 1, modelIndex);
         }
     }
     return 0;
@@ -650,6 +663,9 @@ void QQuickListViewPrivate::clear(bool onDestruction)
     releaseSectionItem(nextSectionItem);
     nextSectionItem = nullptr;
     lastVisibleSection = QString();
+    if (sizeCache)
+        sizeCache->reset(0);
+    movedItemSizes.clear();
     QQuickItemViewPrivate::clear(onDestruction);
 }
 
@@ -740,19 +756,29 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         || bufferTo < visiblePos - averageSize - spacing)) {
         // We've jumped more than a page.  Estimate which items are now
         // visible and fill from there.
-        int count = (fillFrom - itemEnd) / (averageSize + spacing);
-        int newModelIdx = qBound(0, modelIndex + count, model->count());
-        count = newModelIdx - modelIndex;
-        if (count) {
+        int newModelIdx;
+        if (QQuickListViewSizeCache *cache = itemSizeCache()) {
+            // The measured sizes tell where the item at fillFrom starts.
+            const qreal origin = itemEnd - estimatedSize(0, modelIndex);
+            newModelIdx = cache->indexAt(fillFrom - origin, averageSize, spacing);
+        } else {
+            int count = (fillFrom - itemEnd) / (averageSize + spacing);
+            newModelIdx = modelIndex + count;
+        }
+        newModelIdx = qBound(0, newModelIdx, model->count());
+        if (newModelIdx != modelIndex) {
             releaseVisibleItems(reusableFlag);
+            if (newModelIdx > modelIndex)
+                visiblePos = itemEnd + estimatedSize(modelIndex, newModelIdx);
+            else
+                visiblePos = itemEnd - estimatedSize(newModelIdx, modelIndex);
             modelIndex = newModelIdx;
             visibleIndex = modelIndex;
-            visiblePos = itemEnd + count * (averageSize + spacing);
             itemEnd = visiblePos;
         }
     }
 
-    QQmlIncubator::IncubationMode incubationMode = doBuffer ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
+    const QQmlIncubator::IncubationMode incubationMode = refillIncubationMode(doBuffer);
 
     bool changed = false;
     FxListItemSG *item = nullptr;
@@ -906,6 +932,7 @@ void QQuickListViewPrivate::layoutVisibleItems(int fromModelIndex)
             fixedCurrent = fixedCurrent || (currentItem && item->item == currentItem->item);
         }
         averageSize = qRound(sum / visibleItems.size());
+        measureVisibleItems();
 
         // move current item if it is not a visible item.
         if (currentIndex >= 0 && currentItem && !fixedCurrent)
@@ -1434,6 +1461,108 @@ void QQuickListViewPrivate::updateAverage()
     for (FxViewItem *item : std::as_const(visibleItems))
         sum += item->size();
     averageSize = qRound(sum / visibleItems.size());
+    measureVisibleItems();
+}
+
+/*!
+    \internal
+
+    Records the sizes of the visible items in the size cache, if
+    cacheItemSizes is enabled, and estimates the size of the items that were
+    never measured from all of the sizes measured so far.
+*/
+void QQuickListViewPrivate::measureVisibleItems()
+{
+    // While model changes are applied, the visible items already have their
+    // new indexes, but the cache only catches up change by change.
+    if (currentChanges.active)
+        return;
+    QQuickListViewSizeCache *cache = itemSizeCache();
+    if (!cache)
+        return;
+    for (FxViewItem *item : std::as_const(visibleItems)) {
+        if (item->index >= 0 && item->index < cache->count())
+            cache->setSize(item->index, item->size());
+    }
+    if (cache->knownCount())
+        averageSize = qRound(cache->averageSize());
+}
+
+QQuickListViewSizeCache *QQuickListViewPrivate::itemSizeCache()
+{
+    if (!sizeCache)
+        return nullptr;
+    // The cache follows the model changes; anything else, such as a new
+    // model, starts it over.
+    if (sizeCache->count() != itemCount)
+        sizeCache->reset(itemCount);
+    return sizeCache.get();
+}
+
+/*!
+    \internal
+
+    Returns the size cache only if it is in step with the model, so that
+    estimates never use sizes that belong to other items.
+*/
+const QQuickListViewSizeCache *QQuickListViewPrivate::itemSizeCache() const
+{
+    if (!sizeCache || sizeCache->count() != itemCount)
+        return nullptr;
+    return sizeCache.get();
+}
+
+/*!
+    \internal
+
+    Returns the estimated extent of the items \a from up to, but not
+    including, \a to, with the spacing after each of them. Measured sizes are
+    used where they are known, and averageSize otherwise.
+*/
+qreal QQuickListViewPrivate::estimatedSize(int from, int to) const
+{
+    if (to <= from)
+        return 0;
+    const QQuickListViewSizeCache *cache = itemSizeCache();
+    if (!cache)
+        return (to - from) * (averageSize + spacing);
+
+    const int first = qBound(0, from, cache->count());
+    const int last = qBound(first, to, cache->count());
+    return cache->sizeOf(first, last, averageSize)
+            + ((to - from) - (last - first)) * averageSize
+            + (to - from) * spacing;
+}
+
+void QQuickListViewPrivate::modelItemsInserted(const QQmlChangeSet::Change &insert)
+{
+    if (!sizeCache || sizeCache->count() + insert.count != itemCount)
+        return;
+    sizeCache->insert(insert.index, insert.count);
+
+    // Moved items keep the size they were measured with
+    if (insert.isMove() && !movedItemSizes.isEmpty()) {
+        for (int i = insert.index; i < insert.end(); ++i) {
+            const auto it = movedItemSizes.constFind(insert.moveKey(i));
+            if (it != movedItemSizes.cend()) {
+                sizeCache->setSize(i, *it);
+                movedItemSizes.erase(it);
+            }
+        }
+    }
+}
+
+void QQuickListViewPrivate::modelItemsRemoved(const QQmlChangeSet::Change &removal)
+{
+    if (!sizeCache || sizeCache->count() - removal.count != itemCount)
+        return;
+    if (removal.isMove()) {
+        for (int i = removal.index; i < removal.end(); ++i) {
+            if (sizeCache->isKnown(i))
+                movedItemSizes.insert(removal.moveKey(i), sizeCache->size(i, 0));
+        }
+    }
+    sizeCache->remove(removal.index, removal.count);
 }
 
 qreal QQuickListViewPrivate::headerSize() const
@@ -2510,6 +2639,57 @@ QQuickListView::~QQuickListView()
     \sa {Reusing items}, pooled(), reused()
 */
 
+/*!
+    \qmlproperty int QtQuick::ListView::incubationBudget
+    \since 6.10
+
+    This property holds the time in milliseconds per frame that may be spent
+    on creating delegate items while the view is moving.
+
+    By default, delegate items that scroll into view are created
+    synchronously, which can cause dropped frames when delegates are
+    expensive and the view is flicked fast. If the budget is larger than
+    \c 0, such items are instead incubated asynchronously while the view is
+    moving, or when positionViewAtIndex() jumps to another part of the
+    list, spending at most this much time per frame. Items then appear over the
+    following frames; the item that is jumped to is still created right away.
+
+    When several views in the same window set a budget, the smallest one is
+    used. Once no view in the window sets a budget, the default of a third of
+    a frame is used again.
+
+    The budget only has an effect if the QML engine uses the incubation
+    controller of a QQuickWindow, which is the case for QQuickView and
+    QQmlApplicationEngine.
+
+    This property is \c 0 by default.
+*/
+
+/*!
+    \qmlproperty int QtQuick::ListView::prefetchMargin
+    \since 6.10
+
+    This property holds the number of items before and after the created
+    delegate items whose model data the list view requests ahead of time.
+
+    Unlike \l cacheBuffer, which creates whole delegate items outside the
+    visible area, this only asks the model for the data of the next items in
+    the direction the list is moving in, as given by \l orientation and
+    \l layoutDirection or \l verticalLayoutDirection. Models that load their
+    data lazily, for example from a database or over the network, can then
+    have it ready by the time the delegates are created. When the margin
+    reaches past the end of a model that can fetch more rows, more rows are
+    fetched.
+
+    For QAbstractItemModel based models, the roles that the delegates read
+    are requested in one call to QAbstractItemModel::multiData(), and the
+    values are handed to the delegate once it is created for that item.
+    Items whose delegates are already created are not requested again. Other
+    models are not affected by this property.
+
+    This property is \c 0 by default.
+*/
+
 /*!
     \qmlattachedsignal QtQuick::ListView::pooled()
 
@@ -3181,6 +3361,47 @@ void QQuickListView::setFooterPositioning(QQuickListView::FooterPositioning posi
     }
 }
 
+/*!
+    \qmlproperty bool QtQuick::ListView::cacheItemSizes
+    \since 6.10
+
+    This property holds whether the view remembers the size of each delegate
+    item it has created.
+
+    ListView only creates the items in and around the visible area, and
+    estimates the size of all other items from the average size of the items
+    created so far. When the delegates have very different sizes, the
+    estimates can be far off, so that the scroll bar jumps, or
+    positionViewAtIndex() lands on the wrong content.
+
+    When this property is \c true, the size of every item the view has laid
+    out is kept after the item is destroyed, and the position of an item, and
+    the item at a position, are computed from the known sizes, using the
+    average of all known sizes for the remaining items. The sizes are kept
+    in step with insertions and removals, and dropped when the model is
+    reset. The cost is a few bytes per model row.
+
+    The default value is \c false.
+*/
+bool QQuickListView::cacheItemSizes() const
+{
+    Q_D(const QQuickListView);
+    return bool(d->sizeCache);
+}
+
+void QQuickListView::setCacheItemSizes(bool cache)
+{
+    Q_D(QQuickListView);
+    if (bool(d->sizeCache) == cache)
+        return;
+    if (cache)
+        d->sizeCache = std::make_unique<QQuickListViewSizeCache>();
+    else
+        d->sizeCache.reset();
+    d->forceLayoutPolish();
+    emit cacheItemSizesChanged();
+}
+
 /*!
     \qmlproperty Transition QtQuick::ListView::populate
 
@@ -96,6 +96,8 @@ class Q_QUICK_EXPORT QQuickListView : public QQuickItemView
 
     Q_PROPERTY(HeaderPositioning headerPositioning READ headerPositioning WRITE setHeaderPositioning NOTIFY headerPositioningChanged REVISION(2, 4))
     Q_PROPERTY(FooterPositioning footerPositioning READ footerPositioning WRITE setFooterPositioning NOTIFY footerPositioningChanged REVISION(2, 4))
+    Q_PROPERTY(bool cacheItemSizes READ cacheItemSizes WRITE setCacheItemSizes
+            NOTIFY cacheItemSizesChanged REVISION(6, 10) FINAL)
 
     Q_CLASSINFO("DefaultProperty", "data")
     QML_NAMED_ELEMENT(ListView)
@@ -145,6 +147,9 @@ public:
     FooterPositioning footerPositioning() const;
     void setFooterPositioning(FooterPositioning positioning);
 
+    bool cacheItemSizes() const;
+    void setCacheItemSizes(bool cache);
+
     static QQuickListViewAttached *qmlAttachedProperties(QObject *);
 
 public Q_SLOTS:
@@ -161,6 +166,7 @@ Q_SIGNALS:
     void snapModeChanged();
     Q_REVISION(2, 4) void headerPositioningChanged();
     Q_REVISION(2, 4) void footerPositioningChanged();
+    Q_REVISION(6, 10) void cacheItemSizesChanged();
 
 protected:
     void viewportMoved(Qt::Orientations orient) override;
@@ -0,0 +1,291 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquicklistviewsizecache_p.h"
+
+#include <QtCore/qvarlengtharray.h>
+
+QT_BEGIN_NAMESPACE
+
+void QQuickListViewSizeCache::reset(int count)
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_root = count > 0 ? newNode(count) : -1;
+}
+
+void QQuickListViewSizeCache::insert(int index, int count)
+{
+    Q_ASSERT(index >= 0 && index <= this->count());
+    if (count <= 0)
+        return;
+    int left;
+    int right;
+    split(m_root, index, &left, &right);
+    const int inserted = newNode(count);
+    m_root = merge(merge(left, inserted), right);
+}
+
+void QQuickListViewSizeCache::remove(int index, int count)
+{
+    Q_ASSERT(index >= 0 && index + count <= this->count());
+    if (count <= 0)
+        return;
+    int left;
+    int rest;
+    int removed;
+    int right;
+    split(m_root, index, &left, &rest);
+    split(rest, count, &removed, &right);
+    freeNodes(removed);
+    m_root = merge(left, right);
+}
+
+void QQuickListViewSizeCache::setSize(int index, qreal size)
+{
+    Q_ASSERT(index >= 0 && index < count());
+
+    // An item that was measured before only changes the sums above it
+    QVarLengthArray<int, 64> path;
+    int node = m_root;
+    for (int i = index; ; ) {
+        const Node &n = m_nodes.at(node);
+        const int leftItems = items(n.left);
+        if (i < leftItems) {
+            path.append(node);
+            node = n.left;
+        } else if (i < leftItems + n.count) {
+            break;
+        } else {
+            path.append(node);
+            i -= leftItems + n.count;
+            node = n.right;
+        }
+    }
+    if (m_nodes.at(node).known) {
+        const qreal delta = size - m_nodes.at(node).size;
+        if (qFuzzyIsNull(delta))
+            return;
+        m_nodes[node].size = size;
+        m_nodes[node].knownSum += delta;
+        for (int parent : std::as_const(path))
+            m_nodes[parent].knownSum += delta;
+        return;
+    }
+
+    // Otherwise the item is cut out of its run
+    int left;
+    int rest;
+    int item;
+    int right;
+    split(m_root, index, &left, &rest);
+    split(rest, 1, &item, &right);
+    m_nodes[item].known = true;
+    m_nodes[item].size = size;
+    update(item);
+    m_root = merge(merge(left, item), right);
+}
+
+/*!
+    \internal
+
+    Returns the offset of the item at \a index from the start of the first
+    item, using \a estimate for the items without known size, and adding
+    \a spacing after each item.
+*/
+qreal QQuickListViewSizeCache::offset(int index, qreal estimate, qreal spacing) const
+{
+    Q_ASSERT(index >= 0 && index <= count());
+    qreal knownSum = 0;
+    int knownItems = 0;
+    for (int node = m_root, i = index; node >= 0 && i > 0; ) {
+        const Node &n = m_nodes.at(node);
+        const int leftItems = items(n.left);
+        if (i < leftItems) {
+            node = n.left;
+            continue;
+        }
+        if (n.left >= 0) {
+            knownSum += m_nodes.at(n.left).knownSum;
+            knownItems += m_nodes.at(n.left).knownItems;
+        }
+        i -= leftItems;
+        if (i < n.count)
+            break;
+        if (n.known) {
+            knownSum += n.size;
+            ++knownItems;
+        }
+        i -= n.count;
+        node = n.right;
+    }
+    return knownSum + (index - knownItems) * estimate + index * spacing;
+}
+
+/*!
+    \internal
+
+    Returns the index of the item at \a offset from the start of the first
+    item. This is the inverse of offset(), clamped to the valid indexes.
+*/
+int QQuickListViewSizeCache::indexAt(qreal offset, qreal estimate, qreal spacing) const
+{
+    const int count = this->count();
+    if (count == 0)
+        return -1;
+
+    // Descend the tree, skipping whole subtrees that end before the offset
+    int index = 0;
+    for (int node = m_root; node >= 0; ) {
+        const Node &n = m_nodes.at(node);
+        if (n.left >= 0) {
+            const Node &left = m_nodes.at(n.left);
+            const qreal leftSize = left.knownSum + (left.items - left.knownItems) * estimate
+                    + left.items * spacing;
+            if (offset < leftSize) {
+                node = n.left;
+                continue;
+            }
+            offset -= leftSize;
+            index += left.items;
+        }
+
+        const qreal itemSize = (n.known ? n.size : estimate) + spacing;
+        const qreal size = n.count * itemSize;
+        if (offset < size) {
+            if (n.known || itemSize <= 0)
+                return index;
+            return index + qBound(0, int(offset / itemSize), n.count - 1);
+        }
+        offset -= size;
+        index += n.count;
+        node = n.right;
+    }
+    return qMin(index, count - 1);
+}
+
+int QQuickListViewSizeCache::find(int index) const
+{
+    Q_ASSERT(index >= 0 && index < count());
+    int node = m_root;
+    for (int i = index; ; ) {
+        const Node &n = m_nodes.at(node);
+        const int leftItems = items(n.left);
+        if (i < leftItems) {
+            node = n.left;
+        } else if (i < leftItems + n.count) {
+            return node;
+        } else {
+            i -= leftItems + n.count;
+            node = n.right;
+        }
+    }
+}
+
+int QQuickListViewSizeCache::newNode(int count)
+{
+    // A fixed sequence of priorities keeps the tree balanced on average, and
+    // the layout reproducible.
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+
+    Node node;
+    node.priority = m_seed;
+    node.count = count;
+    node.items = count;
+
+    if (!m_freeNodes.isEmpty()) {
+        const int index = m_freeNodes.takeLast();
+        m_nodes[index] = node;
+        return index;
+    }
+    m_nodes.append(node);
+    return int(m_nodes.size()) - 1;
+}
+
+void QQuickListViewSizeCache::freeNodes(int node)
+{
+    if (node < 0)
+        return;
+    freeNodes(m_nodes.at(node).left);
+    freeNodes(m_nodes.at(node).right);
+    m_freeNodes.append(node);
+}
+
+void QQuickListViewSizeCache::update(int node)
+{
+    Node &n = m_nodes[node];
+    n.items = n.count;
+    n.knownItems = n.known ? 1 : 0;
+    n.knownSum = n.known ? n.size : 0;
+    for (int child : { n.left, n.right }) {
+        if (child >= 0) {
+            const Node &c = m_nodes.at(child);
+            n.items += c.items;
+            n.knownItems += c.knownItems;
+            n.knownSum += c.knownSum;
+        }
+    }
+}
+
+// Splits the subtree of node into the first index items and the rest. A run
+// that straddles the split is cut in two.
+void QQuickListViewSizeCache::split(int node, int index, int *left, int *right)
+{
+    if (node < 0) {
+        *left = -1;
+        *right = -1;
+        return;
+    }
+
+    const int leftItems = items(m_nodes.at(node).left);
+    const int count = m_nodes.at(node).count;
+    int first;
+    int second;
+    if (index <= leftItems) {
+        split(m_nodes.at(node).left, index, &first, &second);
+        m_nodes[node].left = second;
+        update(node);
+        *left = first;
+        *right = node;
+    } else if (index >= leftItems + count) {
+        split(m_nodes.at(node).right, index - leftItems - count, &first, &second);
+        m_nodes[node].right = first;
+        update(node);
+        *left = node;
+        *right = second;
+    } else {
+        Q_ASSERT(!m_nodes.at(node).known);
+        const int tail = newNode(leftItems + count - index);
+        // The tail takes the place of the run, so it must not rise above it
+        m_nodes[tail].priority = qMin(m_nodes.at(tail).priority, m_nodes.at(node).priority);
+        const int nodeRight = m_nodes.at(node).right;
+        m_nodes[node].count = index - leftItems;
+        m_nodes[node].right = -1;
+        update(node);
+        *left = node;
+        *right = merge(tail, nodeRight);
+    }
+}
+
+int QQuickListViewSizeCache::merge(int left, int right)
+{
+    if (left < 0)
+        return right;
+    if (right < 0)
+        return left;
+
+    if (m_nodes.at(left).priority > m_nodes.at(right).priority) {
+        const int merged = merge(m_nodes.at(left).right, right);
+        m_nodes[left].right = merged;
+        update(left);
+        return left;
+    }
+    const int merged = merge(left, m_nodes.at(right).left);
+    m_nodes[right].left = merged;
+    update(right);
+    return right;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,101 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKLISTVIEWSIZECACHE_P_H
+#define QQUICKLISTVIEWSIZECACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtquickglobal_p.h>
+
+QT_REQUIRE_CONFIG(quick_listview);
+
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+
+    Remembers the measured sizes of the items of a ListView, and estimates
+    the sizes of the items that were never measured.
+
+    The items are kept in a balanced tree, ordered by index, of nodes that
+    hold either one item of known size or a run of items of unknown size.
+    Each node also holds the number of items, the number of known sizes and
+    their sum for its subtree. The offset of an item, the item at an offset,
+    and inserting or removing items take O(log n), for any estimate of the
+    unknown sizes.
+*/
+class Q_AUTOTEST_EXPORT QQuickListViewSizeCache
+{
+public:
+    int count() const { return items(m_root); }
+    int knownCount() const { return m_root < 0 ? 0 : m_nodes.at(m_root).knownItems; }
+    qreal averageSize() const
+    {
+        const int known = knownCount();
+        return known ? m_nodes.at(m_root).knownSum / known : 0;
+    }
+
+    void reset(int count);
+    void insert(int index, int count);
+    void remove(int index, int count);
+
+    bool isKnown(int index) const { return m_nodes.at(find(index)).known; }
+    qreal size(int index, qreal estimate) const
+    {
+        const Node &node = m_nodes.at(find(index));
+        return node.known ? node.size : estimate;
+    }
+    void setSize(int index, qreal size);
+
+    qreal sizeOf(int from, int to, qreal estimate) const
+    {
+        return offset(to, estimate, 0) - offset(from, estimate, 0);
+    }
+    qreal offset(int index, qreal estimate, qreal spacing) const;
+    int indexAt(qreal offset, qreal estimate, qreal spacing) const;
+
+private:
+    struct Node
+    {
+        int left = -1;
+        int right = -1;
+        quint32 priority = 0;
+        // A run of count items of unknown size, or one item of known size
+        int count = 0;
+        bool known = false;
+        qreal size = 0;
+        // Totals of the subtree
+        int items = 0;
+        int knownItems = 0;
+        qreal knownSum = 0;
+    };
+
+    int items(int node) const { return node < 0 ? 0 : m_nodes.at(node).items; }
+    int find(int index) const;
+    int newNode(int count);
+    void freeNodes(int node);
+    void update(int node);
+    void split(int node, int index, int *left, int *right);
+    int merge(int left, int right);
+
+    QList<Node> m_nodes;
+    QList<int> m_freeNodes;
+    int m_root = -1;
+    quint32 m_seed = 0x9e3779b9;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKLISTVIEWSIZECACHE_P_H
@@ -633,6 +633,36 @@ QRhiCommandBuffer *QQuickRenderControl::commandBuffer() const
     return d->cb;
 }
 
+/*!
+    \return the area of the render target that the last call to render()
+    changed, in pixels with a top-left origin.
+
+    Unless damage tracking is enabled, this is always the entire render
+    target. When the environment variable \c QSG_RENDERER_DAMAGE_TRACKING is
+    set to \c 1, the default renderer computes the damage from the parts of the
+    scene that changed since the previous frame. Applications can then pass the
+    region on, for example to a compositor, to limit the area that is updated
+    on screen. If the render target is a QRhiTextureRenderTarget with the
+    \l{QRhiTextureRenderTarget::}{PreserveColorContents} flag, only the
+    bounding rectangle of the region is rendered and the rest of the render
+    target keeps the contents of the previous frame.
+
+    The region is empty when nothing changed. It always covers the entire
+    render target with the \c software adaptation of Qt Quick.
+
+    \since 6.10
+
+    \sa render(), QQuickRenderTarget
+ */
+QRegion QQuickRenderControl::damageRegion() const
+{
+    Q_D(const QQuickRenderControl);
+    if (!d->window)
+        return QRegion();
+    QQuickWindowPrivate *cd = QQuickWindowPrivate::get(d->window);
+    return cd->renderer ? cd->renderer->damageRegion() : QRegion();
+}
+
 /*!
     Specifies the start of a graphics frame. Calls to sync() or render() must
     be enclosed by calls to beginFrame() and endFrame().
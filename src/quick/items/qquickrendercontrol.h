@@ -7,6 +7,7 @@
 #include <QtCore/qobject.h>
 #include <QtQuick/qtquickglobal.h>
 #include <QtGui/qimage.h>
+#include <QtGui/qregion.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -49,6 +50,8 @@ public:
     QRhi *rhi() const;
     QRhiCommandBuffer *commandBuffer() const;
 
+    QRegion damageRegion() const;
+
 protected:
     explicit QQuickRenderControl(QQuickRenderControlPrivate &dd, QObject *parent = nullptr);
 
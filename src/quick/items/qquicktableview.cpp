@@ -17,6 +17,7 @@
 #include <QtQuick/private/qquickflickable_p_p.h>
 #include <QtQuick/private/qquickitemviewfxitem_p_p.h>
 #include <QtQuick/private/qquicktaphandler_p.h>
+#include <QtQuick/private/qquickwindow_p.h>
 
 /*!
     \qmltype TableView
@@ -193,6 +194,27 @@
 
     \snippet qml/tableview/tableviewwithprovider.qml 0
 
+    When TableView estimates the size of the rows and columns that are not
+    loaded, such as when calculating the \l contentWidth, or which column
+    to show after a large flick, it takes the widths set with \l setColumnWidth()
+    into account, and assumes the average width of the loaded columns for the
+    rest. This only requires memory for the columns that have an explicit width,
+    also when the model has millions of columns. The same applies to row heights.
+
+    \section2 Very large tables
+
+    When a rebuild, such as a call to \l positionViewAtCell() or a fast flick
+    with a scroll bar, places the loaded cells further than 4194304 pixels from
+    the beginning of the content view, TableView moves the loaded cells, the
+    viewport, and the \l {Flickable::originX}{origin} back towards zero by the
+    same amount. This keeps the positions of the delegate items within the
+    precision of the scene graph. The \c contentX, \c contentY, \c originX,
+    \c originY, \c contentWidth and \c contentHeight properties change
+    accordingly, while the \l {Flickable::visibleArea}{visibleArea}, and
+    therefore any attached scroll bars, stay unaffected. This does not happen
+    when the content size is set explicitly, or when the table is part of a
+    \l syncView group.
+
     \section1 Editing cells
 
     You can let the user edit table cells by providing an edit delegate. The
@@ -545,6 +567,55 @@
     \sa {Reusing items}, TableView::pooled, TableView::reused
 */
 
+/*!
+    \qmlproperty int QtQuick::TableView::incubationBudget
+    \since 6.10
+
+    This property holds the time in milliseconds per frame that may be spent
+    on creating delegate items for rows and columns that are flicked into view.
+
+    By default, TableView loads a new row or column in the same frame as it
+    becomes visible, which can cause dropped frames when the delegates are
+    expensive and the view is flicked fast. If the budget is larger than
+    \c 0, the delegate items are instead incubated asynchronously, spending
+    at most this much time per frame. Until a delegate item is ready, its cell
+    is filled with an empty placeholder item that has the average size of the
+    loaded rows and columns. If the implicit size of the delegate item turns
+    out to be different, and the size of its row or column is not set
+    explicitly, the table is laid out again once in the next polish.
+
+    \l itemAtCell() returns the placeholder item for a cell that is not ready.
+
+    The budget only has an effect if the QML engine uses the incubation
+    controller of a QQuickWindow, which is the case for QQuickView and
+    QQmlApplicationEngine. When several views in the same window set a
+    budget, the smallest one is used. Once no view in the window sets a
+    budget, the default of a third of a frame is used again.
+
+    This property is \c 0 by default.
+*/
+
+/*!
+    \qmlproperty int QtQuick::TableView::prefetchMargin
+    \since 6.10
+
+    This property holds the number of rows and columns around the loaded
+    part of the table whose model data TableView requests ahead of time.
+
+    Unlike a larger buffer around the viewport, this doesn't create any
+    delegate items. It only asks the model for the data of the cells that
+    are about to be loaded, so that models which load their data lazily, for
+    example from a database or over the network, can have it ready by the
+    time the delegate items are created.
+
+    For QAbstractItemModel based models, the roles that the delegates read
+    are requested in one call to QAbstractItemModel::multiData() per cell,
+    and kept until the delegate item of the cell is created. Cells that
+    already have a delegate item are skipped.
+
+    This property is \c 0 by default.
+*/
+
 /*!
     \qmlproperty real QtQuick::TableView::contentWidth
 
@@ -2416,10 +2487,8 @@ void QQuickTableViewPrivate::updateContentWidth()
     }
 
     const int nextColumn = nextVisibleEdgeIndexAroundLoadedTable(Qt::RightEdge);
-    const int columnsRemaining = nextColumn == kEdgeIndexAtEnd ? 0 : tableSize.width() - nextColumn;
-    const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
-    const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
-    const qreal estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+    const qreal estimatedRemainingWidth = nextColumn == kEdgeIndexAtEnd
+            ? 0 : estimatedColumnsWidth(nextColumn, tableSize.width());
     const qreal estimatedWidth = loadedTableOuterRect.right() + estimatedRemainingWidth;
 
     QScopedValueRollback fixupGuard(inUpdateContentSize, true);
@@ -2452,10 +2521,8 @@ void QQuickTableViewPrivate::updateContentHeight()
     }
 
     const int nextRow = nextVisibleEdgeIndexAroundLoadedTable(Qt::BottomEdge);
-    const int rowsRemaining = nextRow == kEdgeIndexAtEnd ? 0 : tableSize.height() - nextRow;
-    const qreal remainingRowHeights = rowsRemaining * averageEdgeSize.height();
-    const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
-    const qreal estimatedRemainingHeight = remainingRowHeights + remainingSpacing;
+    const qreal estimatedRemainingHeight = nextRow == kEdgeIndexAtEnd
+            ? 0 : estimatedRowsHeight(nextRow, tableSize.height());
     const qreal estimatedHeight = loadedTableOuterRect.bottom() + estimatedRemainingHeight;
 
     QScopedValueRollback fixupGuard(inUpdateContentSize, true);
@@ -2512,10 +2579,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The table rect is at the origin, or outside, but we still have more
         // visible columns to the left. So we try to guesstimate how much space
         // the rest of the columns will occupy, and move the origin accordingly.
-        const int columnsRemaining = nextLeftColumn + 1;
-        const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
-        const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
-        const qreal estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+        const qreal estimatedRemainingWidth = estimatedColumnsWidth(0, nextLeftColumn + 1);
         origin.rx() = loadedTableOuterRect.left() - estimatedRemainingWidth;
     } else if (nextRightColumn == kEdgeIndexAtEnd) {
         // There are no more columns to load on the right side of the table.
@@ -2538,10 +2602,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The right-most column is outside the end of the content view, and we
         // still have more visible columns in the model. This can happen if the application
         // has set a fixed content width.
-        const int columnsRemaining = tableSize.width() - nextRightColumn;
-        const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
-        const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
-        const qreal estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+        const qreal estimatedRemainingWidth = estimatedColumnsWidth(nextRightColumn, tableSize.width());
         const qreal pixelsOutsideContentWidth = loadedTableOuterRect.right() - q->contentWidth();
         endExtent.rwidth() = pixelsOutsideContentWidth + estimatedRemainingWidth;
     }
@@ -2570,10 +2631,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The table rect is at the origin, or outside, but we still have more
         // visible rows at the top. So we try to guesstimate how much space
         // the rest of the rows will occupy, and move the origin accordingly.
-        const int rowsRemaining = nextTopRow + 1;
-        const qreal remainingRowHeights = rowsRemaining * averageEdgeSize.height();
-        const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
-        const qreal estimatedRemainingHeight = remainingRowHeights + remainingSpacing;
+        const qreal estimatedRemainingHeight = estimatedRowsHeight(0, nextTopRow + 1);
         origin.ry() = loadedTableOuterRect.top() - estimatedRemainingHeight;
     } else if (nextBottomRow == kEdgeIndexAtEnd) {
         // There are no more rows to load on the bottom side of the table.
@@ -2596,10 +2654,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The bottom-most row is outside the end of the content view, and we
         // still have more visible rows in the model. This can happen if the application
         // has set a fixed content height.
-        const int rowsRemaining = tableSize.height() - nextBottomRow;
-        const qreal remainingRowHeigts = rowsRemaining * averageEdgeSize.height();
-        const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
-        const qreal estimatedRemainingHeight = remainingRowHeigts + remainingSpacing;
+        const qreal estimatedRemainingHeight = estimatedRowsHeight(nextBottomRow, tableSize.height());
         const qreal pixelsOutsideContentHeight = loadedTableOuterRect.bottom() - q->contentHeight();
         endExtent.rheight() = pixelsOutsideContentHeight + estimatedRemainingHeight;
     }
@@ -2642,6 +2697,113 @@ void QQuickTableViewPrivate::updateExtents()
     }
 }
 
+const QQuickTableViewSizeModel &QQuickTableViewPrivate::columnSizeModel() const
+{
+    // The explicit column widths are stored by logical column, and are not respected
+    // when a columnWidthProvider is set. In those cases we estimate that all the
+    // columns have the average width, which is what an empty size model returns.
+    static const QQuickTableViewSizeModel averageWidthOnly;
+    if (syncView || !logicalIndices[0].isEmpty() || !columnWidthProvider.isUndefined())
+        return averageWidthOnly;
+    return explicitColumnWidths;
+}
+
+const QQuickTableViewSizeModel &QQuickTableViewPrivate::rowSizeModel() const
+{
+    static const QQuickTableViewSizeModel averageHeightOnly;
+    if (syncView || !logicalIndices[1].isEmpty() || !rowHeightProvider.isUndefined())
+        return averageHeightOnly;
+    return explicitRowHeights;
+}
+
+qreal QQuickTableViewPrivate::estimatedColumnsWidth(int from, int to) const
+{
+    // Return the estimated width of the columns in the range [from, to),
+    // together with the spacing that follows each of them.
+    // Columns that have an explicit width count with that width, and the rest
+    // count with the average width of the loaded columns.
+    const int count = qMax(0, to - from);
+    return columnSizeModel().sizeOf(from, to, averageEdgeSize.width()) + count * cellSpacing.width();
+}
+
+qreal QQuickTableViewPrivate::estimatedRowsHeight(int from, int to) const
+{
+    const int count = qMax(0, to - from);
+    return rowSizeModel().sizeOf(from, to, averageEdgeSize.height()) + count * cellSpacing.height();
+}
+
+qreal QQuickTableViewPrivate::estimatedColumnPosition(int column) const
+{
+    return estimatedColumnsWidth(0, column) - rebaseOffset.x();
+}
+
+qreal QQuickTableViewPrivate::estimatedRowPosition(int row) const
+{
+    return estimatedRowsHeight(0, row) - rebaseOffset.y();
+}
+
+int QQuickTableViewPrivate::estimatedColumnAt(qreal x) const
+{
+    return columnSizeModel().indexAt(x + rebaseOffset.x(), averageEdgeSize.width(),
+                                     cellSpacing.width(), tableSize.width());
+}
+
+int QQuickTableViewPrivate::estimatedRowAt(qreal y) const
+{
+    return rowSizeModel().indexAt(y + rebaseOffset.y(), averageEdgeSize.height(),
+                                  cellSpacing.height(), tableSize.height());
+}
+
+void QQuickTableViewPrivate::rebaseContentPosition()
+{
+    // The scene graph transforms items with single precision floats, which can
+    // only represent whole pixels up to 2^24. With a large model, the estimated
+    // position of the loaded table can be far beyond that after a rebuild (e.g
+    // after dragging a scrollbar, or calling positionViewAtCell()), which makes
+    // the delegate items jitter and misalign. To avoid that, we move the loaded
+    // table, the viewport and the extents back to the beginning of the content
+    // view, and remember the offset in rebaseOffset, so that the rest of the table
+    // can still be estimated relative to the first row and column. Since the
+    // viewport and the extents move by the same amount, the visibleArea, and
+    // therefore any attached scrollbars, stay where they are.
+    Q_Q(QQuickTableView);
+
+    if (loadedItems.isEmpty() || syncView || !syncChildren.isEmpty() || q->isMoving())
+        return;
+
+    QPointF delta;
+    if (!explicitContentWidth.isValid() && qAbs(loadedTableOuterRect.left()) > kRebaseDistance)
+        delta.rx() = loadedTableOuterRect.left();
+    if (!explicitContentHeight.isValid() && qAbs(loadedTableOuterRect.top()) > kRebaseDistance)
+        delta.ry() = loadedTableOuterRect.top();
+    if (delta.isNull())
+        return;
+
+    qCDebug(lcTableViewDelegateLifecycle()) << "rebase content position by:" << delta;
+
+    rebaseOffset += delta;
+    origin -= delta;
+    loadedTableOuterRect.translate(-delta);
+    loadedTableInnerRect.translate(-delta);
+    relayoutTableItems();
+
+    hData.markExtentsDirty();
+    vData.markExtentsDirty();
+    setLocalViewportX(q->contentX() - delta.x());
+    setLocalViewportY(q->contentY() - delta.y());
+
+    {
+        QScopedValueRollback fixupGuard(inUpdateContentSize, true);
+        if (!qFuzzyIsNull(delta.x()))
+            q->QQuickFlickable::setContentWidth(q->contentWidth() - delta.x());
+        if (!qFuzzyIsNull(delta.y()))
+            q->QQuickFlickable::setContentHeight(q->contentHeight() - delta.y());
+    }
+
+    updateBeginningEnd();
+    syncViewportRect();
+}
+
 void QQuickTableViewPrivate::updateAverageColumnWidth()
 {
     if (explicitContentWidth.isValid()) {
@@ -2880,6 +3042,73 @@ FxTableItem *QQuickTableViewPrivate::loadFxTableItem(const QPoint &cell, QQmlInc
     return item;
 }
 
+bool QQuickTableViewPrivate::usePlaceholderItems() const
+{
+    // Placeholders are only used for edges loaded while flicking. During a
+    // rebuild we need the delegate items to know the size of the table.
+    return incubationBudget > 0
+            && rebuildState == RebuildState::Done
+            && loadRequest.incubationMode() == QQmlIncubator::Asynchronous;
+}
+
+FxTableItem *QQuickTableViewPrivate::createPlaceholderItem(const QPoint &cell)
+{
+    Q_Q(QQuickTableView);
+
+    // The placeholder takes the average size of the loaded rows and columns, which
+    // is the best guess we have for the size of the delegate item that replaces it.
+    auto item = new QQuickItem(q->contentItem());
+    item->setImplicitWidth(averageEdgeSize.width() > 0 ? averageEdgeSize.width() : kDefaultColumnWidth);
+    item->setImplicitHeight(averageEdgeSize.height() > 0 ? averageEdgeSize.height() : kDefaultRowHeight);
+
+    FxTableItem *fxTableItem = new FxTableItem(item, q, true);
+    fxTableItem->setVisible(false);
+    fxTableItem->cell = cell;
+    fxTableItem->index = modelIndexAtCell(isTransposed ? QPoint(logicalRowIndex(cell.x()), logicalColumnIndex(cell.y())) :
+                                                         QPoint(logicalColumnIndex(cell.x()), logicalRowIndex(cell.y())));
+    fxTableItem->placeholder = true;
+    placeholderItems.insert(fxTableItem->index, fxTableItem);
+    qCDebug(lcTableViewDelegateLifecycle) << cell << "using placeholder";
+    return fxTableItem;
+}
+
+void QQuickTableViewPrivate::replacePlaceholderItem(FxTableItem *placeholder)
+{
+    const QPoint cell = placeholder->cell;
+    FxTableItem *fxTableItem = loadFxTableItem(cell, QQmlIncubator::AsynchronousIfNested);
+    if (!fxTableItem)
+        return;
+
+    qCDebug(lcTableViewDelegateLifecycle) << cell << "replacing placeholder";
+    const QSizeF placeholderSize(placeholder->item->implicitWidth(), placeholder->item->implicitHeight());
+    const QSizeF itemSize(fxTableItem->item->implicitWidth(), fxTableItem->item->implicitHeight());
+
+    loadedItems.insert(modelIndexAtCell(cell), fxTableItem);
+    fxTableItem->setGeometry(placeholder->geometry());
+    fxTableItem->setVisible(true);
+    releaseItem(placeholder, reusableFlag);
+
+    // The row and column were laid out using the size of the placeholder. Only
+    // their implicit sizes can change, and only once per batch of replacements.
+    const bool widthChanged = itemSize.width() != placeholderSize.width()
+            && getColumnWidth(cell.x()) < 0;
+    const bool heightChanged = itemSize.height() != placeholderSize.height()
+            && getRowHeight(cell.y()) < 0;
+    if (!widthChanged && !heightChanged)
+        return;
+
+    RebuildOptions options = RebuildOption::LayoutOnly;
+    if (widthChanged)
+        options |= RebuildOption::CalculateNewContentWidth;
+    if (heightChanged)
+        options |= RebuildOption::CalculateNewContentHeight;
+    if ((scheduledRebuildOptions & options) == options)
+        return;
+
+    clearEdgeSizeCache();
+    scheduleRebuildTable(options);
+}
+
 void QQuickTableViewPrivate::releaseLoadedItems(QQmlTableInstanceModel::ReusableFlag reusableFlag) {
     // Make a copy and clear the list of items first to avoid destroyed
     // items being accessed during the loop (QTBUG-61294)
@@ -2892,6 +3121,9 @@ void QQuickTableViewPrivate::releaseLoadedItems(QQmlTableInstanceModel::Reusable
 void QQuickTableViewPrivate::releaseItem(FxTableItem *fxTableItem, QQmlTableInstanceModel::ReusableFlag reusableFlag)
 {
     Q_Q(QQuickTableView);
+    if (fxTableItem->placeholder)
+        placeholderItems.remove(fxTableItem->index);
+
     // Note that fxTableItem->item might already have been destroyed, in case
     // the item is owned by the QML context rather than the model (e.g ObjectModel etc).
     auto item = fxTableItem->item;
@@ -3527,9 +3759,12 @@ void QQuickTableViewPrivate::processLoadRequest()
         FxTableItem *fxTableItem = loadFxTableItem(cell, loadRequest.incubationMode());
 
         if (!fxTableItem) {
-            // Requested item is not yet ready. Just leave, and wait for this
-            // function to be called again when the item is ready.
-            return;
+            // Requested item is not yet ready. Unless we can fill the cell with
+            // a placeholder, just leave, and wait for this function to be called
+            // again when the item is ready.
+            if (!usePlaceholderItems())
+                return;
+            fxTableItem = createPlaceholderItem(cell);
         }
 
         loadedItems.insert(modelIndexAtCell(cell), fxTableItem);
@@ -3583,6 +3818,7 @@ void QQuickTableViewPrivate::processRebuildTable()
     if (rebuildState == RebuildState::Begin) {
         qCDebug(lcTableViewDelegateLifecycle()) << "begin rebuild:" << q << "options:" << rebuildOptions;
         tableSizeBeforeRebuild = tableSize;
+        prefetchedRect = QRect();
         edgesBeforeRebuild = loadedItems.isEmpty() ? QMargins()
             : QMargins(q->leftColumn(), q->topRow(), q->rightColumn(), q->bottomRow());
     }
@@ -3622,6 +3858,7 @@ void QQuickTableViewPrivate::processRebuildTable()
 
     if (rebuildState == RebuildState::UpdateContentSize) {
         updateContentSize();
+        rebaseContentPosition();
         if (!moveToNextRebuildState())
             return;
     }
@@ -3756,6 +3993,7 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
     if (!syncHorizontally) {
         if (rebuildOptions & RebuildOption::All) {
             // Find the first visible column from the beginning
+            rebaseOffset.rx() = 0;
             topLeftCell.rx() = nextVisibleEdgeIndex(Qt::RightEdge, 0);
             if (topLeftCell.x() == kEdgeIndexAtEnd) {
                 // No visible column found
@@ -3763,12 +4001,11 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
             }
         } else if (rebuildOptions & RebuildOption::CalculateNewTopLeftColumn) {
             // Guesstimate new top left
-            const int newColumn = int(viewportRect.x() / (averageEdgeSize.width() + cellSpacing.width()));
-            topLeftCell.rx() = qBound(0, newColumn, tableSize.width() - 1);
-            topLeftPos.rx() = topLeftCell.x() * (averageEdgeSize.width() + cellSpacing.width());
+            topLeftCell.rx() = estimatedColumnAt(viewportRect.x());
+            topLeftPos.rx() = estimatedColumnPosition(topLeftCell.x());
         } else if (rebuildOptions & RebuildOption::PositionViewAtColumn) {
             topLeftCell.rx() = qBound(0, positionViewAtColumnAfterRebuild, tableSize.width() - 1);
-            topLeftPos.rx() = qFloor(topLeftCell.x()) * (averageEdgeSize.width() + cellSpacing.width());
+            topLeftPos.rx() = estimatedColumnPosition(topLeftCell.x());
         } else {
             // Keep the current top left, unless it's outside model
             topLeftCell.rx() = qBound(0, leftColumn(), tableSize.width() - 1);
@@ -3782,6 +4019,7 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
     if (!syncVertically) {
         if (rebuildOptions & RebuildOption::All) {
             // Find the first visible row from the beginning
+            rebaseOffset.ry() = 0;
             topLeftCell.ry() = nextVisibleEdgeIndex(Qt::BottomEdge, 0);
             if (topLeftCell.y() == kEdgeIndexAtEnd) {
                 // No visible row found
@@ -3789,12 +4027,11 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
             }
         } else if (rebuildOptions & RebuildOption::CalculateNewTopLeftRow) {
             // Guesstimate new top left
-            const int newRow = int(viewportRect.y() / (averageEdgeSize.height() + cellSpacing.height()));
-            topLeftCell.ry() = qBound(0, newRow, tableSize.height() - 1);
-            topLeftPos.ry() = topLeftCell.y() * (averageEdgeSize.height() + cellSpacing.height());
+            topLeftCell.ry() = estimatedRowAt(viewportRect.y());
+            topLeftPos.ry() = estimatedRowPosition(topLeftCell.y());
         } else if (rebuildOptions & RebuildOption::PositionViewAtRow) {
             topLeftCell.ry() = qBound(0, positionViewAtRowAfterRebuild, tableSize.height() - 1);
-            topLeftPos.ry() = qFloor(topLeftCell.y()) * (averageEdgeSize.height() + cellSpacing.height());
+            topLeftPos.ry() = estimatedRowPosition(topLeftCell.y());
         } else {
             topLeftCell.ry() = qBound(0, topRow(), tableSize.height() - 1);
             topLeftPos.ry() = loadedTableOuterRect.y();
@@ -4075,6 +4312,13 @@ void QQuickTableViewPrivate::loadAndUnloadVisibleEdges(QQmlIncubator::Incubation
         return;
     }
 
+    if (incubationMode == QQmlIncubator::AsynchronousIfNested && incubationBudget > 0
+            && rebuildState == RebuildState::Done) {
+        // Let the delegate items of new edges fill in over the next frames,
+        // rather than loading them all in the frame they become visible.
+        incubationMode = QQmlIncubator::Asynchronous;
+    }
+
     bool tableModified;
 
     do {
@@ -4093,6 +4337,38 @@ void QQuickTableViewPrivate::loadAndUnloadVisibleEdges(QQmlIncubator::Incubation
         }
     } while (tableModified);
 
+    prefetchCells();
+}
+
+/*
+  Asks the model for the data of the cells in the prefetchMargin rows and
+  columns around the loaded table. Only the cells that were not part of the
+  previous request are passed on, so that loading a new edge costs one edge's
+  worth of model data.
+*/
+void QQuickTableViewPrivate::prefetchCells()
+{
+    if (prefetchMargin <= 0 || !model || loadedItems.isEmpty())
+        return;
+
+    const QRect loadedRect(QPoint(leftColumn(), topRow()), QPoint(rightColumn(), bottomRow()));
+    const QRect prefetchRect = loadedRect.adjusted(-prefetchMargin, -prefetchMargin, prefetchMargin, prefetchMargin)
+            & QRect(QPoint(0, 0), tableSize);
+    if (prefetchRect == prefetchedRect)
+        return;
+
+    for (int row = prefetchRect.top(); row <= prefetchRect.bottom(); ++row) {
+        for (int column = prefetchRect.left(); column <= prefetchRect.right(); ++column) {
+            const QPoint cell(column, row);
+            if (loadedRect.contains(cell) || prefetchedRect.contains(cell))
+                continue;
+            const int modelIndex = modelIndexAtCell(isTransposed ? QPoint(logicalRowIndex(column), logicalColumnIndex(row)) :
+                                                            QPoint(logicalColumnIndex(column), logicalRowIndex(row)));
+            model->prefetch(modelIndex, 1);
+        }
+    }
+
+    prefetchedRect = prefetchRect;
 }
 
 void QQuickTableViewPrivate::drainReusePoolAfterLoadRequest()
@@ -4435,6 +4711,11 @@ void QQuickTableViewPrivate::itemCreatedCallback(int modelIndex, QObject*)
     qCDebug(lcTableViewDelegateLifecycle) << "item done loading:"
         << cellAtModelIndex(modelIndex);
 
+    if (FxTableItem *placeholder = placeholderItems.value(modelIndex)) {
+        replacePlaceholderItem(placeholder);
+        return;
+    }
+
     // Since the item we waited for has finished incubating, we can
     // continue with the load request. processLoadRequest will
     // ask the model for the requested item once more, which will be
@@ -5658,6 +5939,9 @@ QQuickTableView::~QQuickTableView()
 {
     Q_D(QQuickTableView);
 
+    if (d->incubationBudget > 0)
+        QQuickWindowPrivate::setIncubationBudget(this, 0);
+
     if (d->syncView) {
         // Remove this TableView as a sync child from the syncView
         auto syncView_d = d->syncView->d_func();
@@ -5883,6 +6167,41 @@ void QQuickTableView::setReuseItems(bool reuse)
     emit reuseItemsChanged();
 }
 
+int QQuickTableView::incubationBudget() const
+{
+    return d_func()->incubationBudget;
+}
+
+void QQuickTableView::setIncubationBudget(int msecs)
+{
+    Q_D(QQuickTableView);
+    msecs = qMax(0, msecs);
+    if (d->incubationBudget == msecs)
+        return;
+
+    d->incubationBudget = msecs;
+    QQuickWindowPrivate::setIncubationBudget(this, msecs);
+    emit incubationBudgetChanged();
+}
+
+int QQuickTableView::prefetchMargin() const
+{
+    return d_func()->prefetchMargin;
+}
+
+void QQuickTableView::setPrefetchMargin(int count)
+{
+    Q_D(QQuickTableView);
+    count = qMax(0, count);
+    if (d->prefetchMargin == count)
+        return;
+
+    d->prefetchMargin = count;
+    d->prefetchedRect = QRect();
+    d->prefetchCells();
+    emit prefetchMarginChanged();
+}
+
 void QQuickTableView::setContentWidth(qreal width)
 {
     Q_D(QQuickTableView);
@@ -6649,10 +6968,7 @@ qreal QQuickTableView::explicitColumnWidth(int column) const
     if (d->syncHorizontally)
         return d->syncView->explicitColumnWidth(column);
 
-    const auto it = d->explicitColumnWidths.constFind(d->logicalColumnIndex(column));
-    if (it != d->explicitColumnWidths.constEnd())
-        return *it;
-    return -1;
+    return d->explicitColumnWidths.size(d->logicalColumnIndex(column), -1);
 }
 
 void QQuickTableView::setRowHeight(int row, qreal size)
@@ -6707,10 +7023,7 @@ qreal QQuickTableView::explicitRowHeight(int row) const
     if (d->syncVertically)
         return d->syncView->explicitRowHeight(row);
 
-    const auto it = d->explicitRowHeights.constFind(d->logicalRowIndex(row));
-    if (it != d->explicitRowHeights.constEnd())
-        return *it;
-    return -1;
+    return d->explicitRowHeights.size(d->logicalRowIndex(row), -1);
 }
 
 QModelIndex QQuickTableView::modelIndex(const QPoint &cell) const
@@ -6900,6 +7213,15 @@ void QQuickTableView::geometryChange(const QRectF &newGeometry, const QRectF &ol
     d->forceLayout(false);
 }
 
+void QQuickTableView::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    Q_D(QQuickTableView);
+    // The budget applies to the window the view is in
+    if (change == ItemSceneChange && value.window && d->incubationBudget > 0)
+        QQuickWindowPrivate::setIncubationBudget(this, d->incubationBudget);
+    QQuickFlickable::itemChange(change, value);
+}
+
 void QQuickTableView::viewportMoved(Qt::Orientations orientation)
 {
     Q_D(QQuickTableView);
@@ -71,6 +71,10 @@ class Q_QUICK_EXPORT QQuickTableView : public QQuickFlickable, public QQmlFinali
     Q_PROPERTY(SelectionMode selectionMode READ selectionMode WRITE setSelectionMode NOTIFY selectionModeChanged REVISION(6, 6) FINAL)
     Q_PROPERTY(QQmlDelegateModel::DelegateModelAccess delegateModelAccess READ delegateModelAccess
             WRITE setDelegateModelAccess NOTIFY delegateModelAccessChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(int incubationBudget READ incubationBudget WRITE setIncubationBudget
+            NOTIFY incubationBudgetChanged REVISION(6, 10) FINAL)
+    Q_PROPERTY(int prefetchMargin READ prefetchMargin WRITE setPrefetchMargin
+            NOTIFY prefetchMarginChanged REVISION(6, 10) FINAL)
 
     QML_NAMED_ELEMENT(TableView)
     QML_ADDED_IN_VERSION(2, 12)
@@ -191,6 +195,12 @@ public:
     QQmlDelegateModel::DelegateModelAccess delegateModelAccess() const;
     void setDelegateModelAccess(QQmlDelegateModel::DelegateModelAccess delegateModelAccess);
 
+    int incubationBudget() const;
+    void setIncubationBudget(int msecs);
+
+    int prefetchMargin() const;
+    void setPrefetchMargin(int count);
+
     Q_INVOKABLE void forceLayout();
     Q_INVOKABLE void positionViewAtCell(const QPoint &cell, PositionMode mode, const QPointF &offset = QPointF(), const QRectF &subRect = QRectF());
     Q_INVOKABLE void positionViewAtIndex(const QModelIndex &index, PositionMode mode, const QPointF &offset = QPointF(), const QRectF &subRect = QRectF());
@@ -281,9 +291,12 @@ Q_SIGNALS:
     Q_REVISION(6, 8) void rowMoved(int logicalIndex, int oldVisualIndex, int newVisualIndex);
     Q_REVISION(6, 8) void columnMoved(int logicalIndex, int oldVisualIndex, int newVisualIndex);
     Q_REVISION(6, 10) void delegateModelAccessChanged();
+    Q_REVISION(6, 10) void incubationBudgetChanged();
+    Q_REVISION(6, 10) void prefetchMarginChanged();
 
 protected:
     void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
     void viewportMoved(Qt::Orientations orientation) override;
     void keyPressEvent(QKeyEvent *e) override;
     bool eventFilter(QObject *obj, QEvent *event) override;
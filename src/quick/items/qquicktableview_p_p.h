@@ -16,6 +16,7 @@
 //
 
 #include "qquicktableview_p.h"
+#include "qquicktableviewsizemodel_p.h"
 
 #include <QtCore/qtimer.h>
 #include <QtCore/qitemselectionmodel.h>
@@ -47,6 +48,7 @@ static const qreal kDefaultRowHeight = 50;
 static const qreal kDefaultColumnWidth = 50;
 static const int kEdgeIndexNotSet = -2;
 static const int kEdgeIndexAtEnd = -3;
+static const qreal kRebaseDistance = 1 << 22;
 
 class FxTableItem;
 class QQuickTableSectionSizeProviderPrivate;
@@ -354,6 +356,9 @@ public:
 
     QPointF origin = QPointF(0, 0);
     QSizeF endExtent = QSizeF(0, 0);
+    // The distance that the content view has been moved back towards
+    // zero by rebaseContentPosition(), to preserve float precision.
+    QPointF rebaseOffset = QPointF(0, 0);
 
     QRectF viewportRect = QRectF(0, 0, -1, -1);
 
@@ -369,6 +374,16 @@ public:
 
     QQmlTableInstanceModel::ReusableFlag reusableFlag = QQmlTableInstanceModel::Reusable;
 
+    // Milliseconds per frame spent on incubating delegates that are flicked into
+    // view. Until they are ready, their cells are filled with placeholder items.
+    int incubationBudget = 0;
+    QHash<int, FxTableItem *> placeholderItems;
+
+    // Number of rows and columns around the loaded table whose model data is
+    // requested ahead of time, and the cells that were last requested.
+    int prefetchMargin = 0;
+    QRect prefetchedRect;
+
     bool blockItemCreatedCallback = false;
     mutable bool layoutWarningIssued = false;
     bool polishing = false;
@@ -453,8 +468,8 @@ public:
     int currentRow = -1;
     int currentColumn = -1;
 
-    QHash<int, qreal> explicitColumnWidths;
-    QHash<int, qreal> explicitRowHeights;
+    QQuickTableViewSizeModel explicitColumnWidths;
+    QQuickTableViewSizeModel explicitRowHeights;
 
     QQuickTableViewHoverHandler *hoverHandler = nullptr;
     QQuickTableViewResizeHandler *resizeHandler = nullptr;
@@ -531,6 +546,15 @@ public:
     void updateContentHeight();
     void updateAverageColumnWidth();
     void updateAverageRowHeight();
+    const QQuickTableViewSizeModel &columnSizeModel() const;
+    const QQuickTableViewSizeModel &rowSizeModel() const;
+    qreal estimatedColumnsWidth(int from, int to) const;
+    qreal estimatedRowsHeight(int from, int to) const;
+    qreal estimatedColumnPosition(int column) const;
+    qreal estimatedRowPosition(int row) const;
+    int estimatedColumnAt(qreal x) const;
+    int estimatedRowAt(qreal y) const;
+    void rebaseContentPosition();
     RebuildOptions checkForVisibilityChanges();
     void forceLayout(bool immediate);
 
@@ -556,6 +580,9 @@ public:
     FxTableItem *loadedTableItem(const QPoint &cell) const;
     FxTableItem *createFxTableItem(const QPoint &cell, QQmlIncubator::IncubationMode incubationMode);
     FxTableItem *loadFxTableItem(const QPoint &cell, QQmlIncubator::IncubationMode incubationMode);
+    bool usePlaceholderItems() const;
+    FxTableItem *createPlaceholderItem(const QPoint &cell);
+    void replacePlaceholderItem(FxTableItem *placeholder);
 
     void releaseItem(FxTableItem *fxTableItem, QQmlTableInstanceModel::ReusableFlag reusableFlag);
     void releaseLoadedItems(QQmlTableInstanceModel::ReusableFlag reusableFlag);
@@ -565,6 +592,7 @@ public:
     void unloadEdge(Qt::Edge edge);
     void loadAndUnloadVisibleEdges(QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested);
     void drainReusePoolAfterLoadRequest();
+    void prefetchCells();
     void processLoadRequest();
 
     void processRebuildTable();
@@ -715,6 +743,7 @@ public:
     bool contains(qreal, qreal) const override { return false; }
 
     QPoint cell;
+    bool placeholder = false;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(QQuickTableViewPrivate::RebuildOptions)
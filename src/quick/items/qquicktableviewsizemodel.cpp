@@ -0,0 +1,149 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquicktableviewsizemodel_p.h"
+
+#include <QtCore/qmath.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+qsizetype QQuickTableViewSizeModel::lowerBound(int index) const
+{
+    return std::lower_bound(m_indexes.cbegin(), m_indexes.cend(), index) - m_indexes.cbegin();
+}
+
+qsizetype QQuickTableViewSizeModel::find(int index) const
+{
+    const qsizetype i = lowerBound(index);
+    return i < m_indexes.size() && m_indexes.at(i) == index ? i : -1;
+}
+
+qreal QQuickTableViewSizeModel::sumBefore(qsizetype i) const
+{
+    if (m_sumsDirty) {
+        m_sums.resize(m_sizes.size() + 1);
+        m_sums[0] = 0;
+        for (qsizetype j = 0; j < m_sizes.size(); ++j)
+            m_sums[j + 1] = m_sums.at(j) + m_sizes.at(j);
+        m_sumsDirty = false;
+    }
+    return m_sums.isEmpty() ? 0 : m_sums.at(i);
+}
+
+/*!
+    \internal
+
+    Sets the size of the section at \a index to \a size.
+*/
+void QQuickTableViewSizeModel::insert(int index, qreal size)
+{
+    const qsizetype i = lowerBound(index);
+    if (i < m_indexes.size() && m_indexes.at(i) == index) {
+        if (m_sizes.at(i) == size)
+            return;
+        m_sizes[i] = size;
+    } else {
+        m_indexes.insert(i, index);
+        m_sizes.insert(i, size);
+    }
+    m_sumsDirty = true;
+}
+
+/*!
+    \internal
+
+    Removes the size set for the section at \a index, if any. Returns
+    whether a size was removed.
+*/
+bool QQuickTableViewSizeModel::remove(int index)
+{
+    const qsizetype i = find(index);
+    if (i == -1)
+        return false;
+    m_indexes.remove(i);
+    m_sizes.remove(i);
+    m_sumsDirty = true;
+    return true;
+}
+
+void QQuickTableViewSizeModel::clear()
+{
+    m_indexes.clear();
+    m_sizes.clear();
+    m_sums.clear();
+    m_sumsDirty = false;
+}
+
+/*!
+    \internal
+
+    Returns the sum of the sizes of the sections from \a from up to, but not
+    including, \a to, when the sections without an explicit size have the
+    size \a defaultSize.
+*/
+qreal QQuickTableViewSizeModel::sizeOf(int from, int to, qreal defaultSize) const
+{
+    if (to <= from)
+        return 0;
+    const qsizetype first = lowerBound(from);
+    const qsizetype last = lowerBound(to);
+    // Computed in double precision, which represents the offsets of up
+    // to 2^53 pixels exactly, instead of summing the sizes one by one.
+    const qreal defaultCount = qreal(to - from) - qreal(last - first);
+    return defaultCount * defaultSize + (sumBefore(last) - sumBefore(first));
+}
+
+/*!
+    \internal
+
+    Returns the section, out of \a count sections, that covers \a offset when
+    the sections are laid out from zero with \a spacing between them. The
+    spacing after a section belongs to it. Offsets before the first section
+    map to the first one, and offsets after the last section to the last one.
+*/
+int QQuickTableViewSizeModel::indexAt(qreal offset, qreal defaultSize, qreal spacing, int count) const
+{
+    if (count <= 0)
+        return -1;
+    if (offset <= 0)
+        return 0;
+
+    // Find the last override that starts at, or before, the offset.
+    qsizetype low = 0;
+    qsizetype high = m_indexes.size();
+    while (low < high) {
+        const qsizetype mid = low + (high - low) / 2;
+        const int index = m_indexes.at(mid);
+        const qreal start = (qreal(index) - qreal(mid)) * defaultSize + sumBefore(mid) + index * spacing;
+        if (start <= offset)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    // The offset is then either inside that override, or inside the run of
+    // default-sized sections that follows it.
+    int runStart = 0;
+    qreal runOffset = 0;
+    if (low > 0) {
+        const qsizetype i = low - 1;
+        const int index = m_indexes.at(i);
+        const qreal start = (qreal(index) - qreal(i)) * defaultSize + sumBefore(i) + index * spacing;
+        const qreal end = start + m_sizes.at(i) + spacing;
+        if (offset < end || index >= count - 1)
+            return qMin(index, count - 1);
+        runStart = index + 1;
+        runOffset = end;
+    }
+
+    const int runEnd = low < m_indexes.size() ? qMin(m_indexes.at(low), count) : count;
+    const qreal stride = defaultSize + spacing;
+    if (stride <= 0)
+        return qMin(runStart, count - 1);
+    const qreal steps = qFloor((offset - runOffset) / stride);
+    return int(qMin(qreal(runStart) + steps, qreal(runEnd - 1)));
+}
+
+QT_END_NAMESPACE
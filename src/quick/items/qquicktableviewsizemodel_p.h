@@ -0,0 +1,76 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKTABLEVIEWSIZEMODEL_P_H
+#define QQUICKTABLEVIEWSIZEMODEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtquickglobal_p.h>
+
+QT_REQUIRE_CONFIG(quick_tableview);
+
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+
+    Stores the column widths or row heights that were set explicitly on a
+    TableView, and computes the offsets of sections when all the other
+    sections have a default size.
+
+    Only the overrides are stored, sorted by index, together with the prefix
+    sums of their sizes. The memory used is therefore independent of the
+    number of sections, and the offset of a section, or the section at an
+    offset, is found with a binary search in O(log k) for k overrides.
+    Setting or removing an override is O(k).
+*/
+class Q_AUTOTEST_EXPORT QQuickTableViewSizeModel
+{
+public:
+    bool isEmpty() const { return m_indexes.isEmpty(); }
+    int count() const { return int(m_indexes.size()); }
+
+    bool contains(int index) const { return find(index) != -1; }
+    qreal size(int index, qreal defaultSize) const
+    {
+        const qsizetype i = find(index);
+        return i == -1 ? defaultSize : m_sizes.at(i);
+    }
+
+    void insert(int index, qreal size);
+    bool remove(int index);
+    void clear();
+
+    qreal sizeOf(int from, int to, qreal defaultSize) const;
+    qreal offset(int index, qreal defaultSize, qreal spacing) const
+    {
+        return sizeOf(0, index, defaultSize) + index * spacing;
+    }
+    int indexAt(qreal offset, qreal defaultSize, qreal spacing, int count) const;
+
+private:
+    qsizetype find(int index) const;
+    qsizetype lowerBound(int index) const;
+    qreal sumBefore(qsizetype i) const;
+
+    QList<int> m_indexes;           // sorted indexes of the overrides
+    QList<qreal> m_sizes;           // size of each override
+    mutable QList<qreal> m_sums;    // m_sums[i] is the sum of the first i sizes
+    mutable bool m_sumsDirty = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKTABLEVIEWSIZEMODEL_P_H
@@ -32,9 +32,11 @@
 #include <QtGui/private/qevent_p.h>
 #include <QtGui/private/qpointingdevice_p.h>
 #include <QtCore/qvarlengtharray.h>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qabstractanimation.h>
 #include <QtCore/QLibraryInfo>
 #include <QtCore/QRunnable>
+#include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlincubator.h>
 #include <QtQml/qqmlinfo.h>
 #include <QtQml/private/qqmlmetatype_p.h>
@@ -56,6 +58,7 @@
 
 #include <rhi/qrhi.h>
 
+#include <algorithm>
 #include <utility>
 #include <mutex>
 
@@ -77,8 +80,8 @@ class QQuickWindowIncubationController : public QObject, public QQmlIncubationCo
     Q_OBJECT
 
 public:
-    QQuickWindowIncubationController(QSGRenderLoop *loop)
-        : m_renderLoop(loop), m_timer(0)
+    QQuickWindowIncubationController(QQuickWindowPrivate *window, QSGRenderLoop *loop)
+        : m_window(window), m_renderLoop(loop), m_timer(0)
     {
         // Allow incubation for 1/3 of a frame.
         m_incubation_time = qMax(1, int(1000 / QGuiApplication::primaryScreen()->refreshRate()) / 3);
@@ -106,13 +109,22 @@ protected:
         }
     }
 
+public:
+    // The smallest budget of the views in the window caps the time spent per
+    // frame. Without any, a third of a frame is used.
+    int incubationTime(int defaultTime) const
+    {
+        const int budget = m_window->incubationBudget();
+        return budget > 0 ? budget : defaultTime;
+    }
+
 public slots:
     void incubate() {
         if (m_renderLoop && incubatingObjectCount()) {
             if (m_renderLoop->interleaveIncubation()) {
-                incubateFor(m_incubation_time);
+                incubateFor(incubationTime(m_incubation_time));
             } else {
-                incubateFor(m_incubation_time * 2);
+                incubateFor(incubationTime(m_incubation_time * 2));
                 if (incubatingObjectCount())
                     incubateAgain();
             }
@@ -129,6 +141,7 @@ protected:
     }
 
 private:
+    QQuickWindowPrivate *m_window;
     QPointer<QSGRenderLoop> m_renderLoop;
     int m_incubation_time;
     int m_timer;
@@ -652,6 +665,10 @@ void QQuickWindowPrivate::renderSceneGraph()
         sgRenderTarget = QSGRenderTarget(redirect.rt.sw.paintDevice);
     }
 
+    QElapsedTimer renderTimer;
+    renderTimer.start();
+    const quint64 textureUploadCount = QSGTexturePrivate::uploadCount();
+
     context->beginNextFrame(renderer,
                             sgRenderTarget,
                             emitBeforeRenderPassRecording,
@@ -694,6 +711,20 @@ void QQuickWindowPrivate::renderSceneGraph()
 
     context->endNextFrame(renderer);
 
+    {
+        const QSGRenderer::FrameStatistics &rendererStatistics = renderer->frameStatistics();
+        QMutexLocker locker(&frameStatisticsMutex);
+        frameStatistics.renderPrepareTime = rendererStatistics.prepareTime;
+        frameStatistics.renderTime = renderTimer.nsecsElapsed() - rendererStatistics.prepareTime;
+        frameStatistics.batchCount = rendererStatistics.batchCount;
+        frameStatistics.mergedBatchCount = rendererStatistics.mergedBatchCount;
+        frameStatistics.unmergedBatchCount = rendererStatistics.unmergedBatchCount;
+        frameStatistics.uploadedVertexBytes = rendererStatistics.uploadedVertexBytes;
+        frameStatistics.textureUploadCount = int(QSGTexturePrivate::uploadCount() - textureUploadCount);
+        frameStatistics.materialChangeCount = rendererStatistics.materialChangeCount;
+        frameStatistics.culledNodeCount = rendererStatistics.culledNodeCount;
+    }
+
     if (renderer && renderer->hasVisualizationModeWithContinuousUpdate()) {
         // For the overdraw visualizer. This update is not urgent so avoid a
         // direct update() call, this is only here to keep the overdraw
@@ -702,6 +733,33 @@ void QQuickWindowPrivate::renderSceneGraph()
     }
 }
 
+/*!
+    \internal
+
+    Records the time the render loop spent polishing items and advancing
+    animations for the current frame, in nanoseconds.
+*/
+void QQuickWindowPrivate::recordPolishTimes(qint64 polishTime, qint64 animationTime)
+{
+    QMutexLocker locker(&frameStatisticsMutex);
+    frameStatistics.polishTime = polishTime;
+    frameStatistics.animationTime = animationTime;
+}
+
+/*!
+    \internal
+
+    Records the time the render loop spent synchronizing the scene graph and
+    finishing and presenting the current frame, in nanoseconds. This may be
+    called on the render thread.
+*/
+void QQuickWindowPrivate::recordSyncAndSwapTimes(qint64 syncTime, qint64 swapTime)
+{
+    QMutexLocker locker(&frameStatisticsMutex);
+    frameStatistics.syncTime = syncTime;
+    frameStatistics.swapTime = swapTime;
+}
+
 QQuickWindowPrivate::QQuickWindowPrivate()
     : contentItem(nullptr)
     , dirtyItemList(nullptr)
@@ -2732,6 +2790,41 @@ QImage QQuickWindow::grabWindow()
     return QImage();
 }
 
+/*!
+    \internal
+
+    Sets the time in milliseconds per frame that the incubation controller of
+    the window of \a view may spend on asynchronous incubation to \a msecs.
+    If several views in the window set a budget, the smallest one applies. A
+    budget of 0 withdraws the request. Views that are not in a window yet set
+    their budget again once they are added to one.
+*/
+void QQuickWindowPrivate::setIncubationBudget(QQuickItem *view, int msecs)
+{
+    QQuickWindow *window = view->window();
+    if (!window)
+        return;
+
+    QQuickWindowPrivate *d = get(window);
+    if (msecs > 0)
+        d->incubationBudgets.insert(view, msecs);
+    else
+        d->incubationBudgets.remove(view);
+}
+
+/*!
+    \internal
+
+    Returns the smallest incubation budget set by a view in this window, or 0
+    if there is none.
+*/
+int QQuickWindowPrivate::incubationBudget() const
+{
+    if (incubationBudgets.isEmpty())
+        return 0;
+    return *std::min_element(incubationBudgets.cbegin(), incubationBudgets.cend());
+}
+
 /*!
     Returns an incubation controller that splices incubation between frames
     for this window. QQuickView automatically installs this controller for you,
@@ -2748,7 +2841,7 @@ QQmlIncubationController *QQuickWindow::incubationController() const
         return nullptr; // TODO: make sure that this is safe
 
     if (!d->incubationController)
-        d->incubationController = new QQuickWindowIncubationController(d->windowManager);
+        d->incubationController = new QQuickWindowIncubationController(d, d->windowManager);
     return d->incubationController;
 }
 
@@ -3402,6 +3495,124 @@ const QQuickWindow::GraphicsStateInfo &QQuickWindow::graphicsStateInfo()
     return d->rhiStateInfo;
 }
 
+/*!
+    \struct QQuickWindow::FrameStatistics
+    \inmodule QtQuick
+    \since 6.10
+
+    \brief Describes how the last frame of a QQuickWindow was produced.
+
+    The times are in nanoseconds, and measured on the thread performing the
+    respective step. With the threaded render loop, polishing and advancing
+    animations happen on the GUI thread, while the remaining steps happen on
+    the render thread, so the values may belong to consecutive frames.
+
+    The counters are collected by the default, batching renderer. With the
+    Software adaptation only the times are available.
+
+    It contains a number of fields which are reserved for future use.
+
+    \sa QQuickWindow::frameStatistics()
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::polishTime
+    \brief the time spent polishing items, see QQuickItem::updatePolish().
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::animationTime
+    \brief the time spent advancing animations as part of the frame.
+
+    This is only measured when the render loop drives the animations, as the
+    threaded render loop does, and 0 otherwise.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::syncTime
+    \brief the time spent synchronizing the items with the scene graph,
+    including waiting for the graphics API to begin the frame.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::renderPrepareTime
+    \brief the time the renderer spent preparing the frame.
+
+    This covers preprocessing nodes, building batches, and uploading
+    geometry and uniform data.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::renderTime
+    \brief the time spent recording the render commands of the frame,
+    including the handlers of beforeRendering() and afterRendering().
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::swapTime
+    \brief the time spent submitting and presenting the frame.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::batchCount
+    \brief the number of batches drawn, including QSGRenderNode instances.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::mergedBatchCount
+    \brief the number of batches whose nodes were merged into one draw call.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::unmergedBatchCount
+    \brief the number of batches drawn with one draw call per node.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::uploadedVertexBytes
+    \brief the size of the vertex and index data uploaded in bytes.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::textureUploadCount
+    \brief the number of texture uploads, including updates of texture
+    atlases and glyph caches.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::materialChangeCount
+    \brief the number of times the renderer switched to a different material.
+ */
+
+/*!
+    \variable QQuickWindow::FrameStatistics::culledNodeCount
+    \brief the number of nodes that were not drawn because they were entirely
+    covered by opaque content.
+
+    This is always 0 unless occlusion culling is enabled.
+
+    \sa {Occlusion Culling}
+ */
+
+/*!
+    \since 6.10
+
+    Returns statistics about the frame the window rendered last, such as the
+    time spent in each step of producing it and the number of batches drawn.
+
+    Unlike the \c{qt.scenegraph.time.renderloop} logging category and the QML
+    profiler, this is always available, and is suitable for collecting
+    performance data from deployed applications. It is safe to call this
+    function from the GUI thread at any time, for example from a handler of
+    the frameSwapped() signal.
+ */
+QQuickWindow::FrameStatistics QQuickWindow::frameStatistics() const
+{
+    Q_D(const QQuickWindow);
+    QMutexLocker locker(&d->frameStatisticsMutex);
+    return d->frameStatistics;
+}
+
 /*!
     When mixing raw graphics (OpenGL, Vulkan, Metal, etc.) commands with scene
     graph rendering, it is necessary to call this function before recording
@@ -109,6 +109,25 @@ public:
         int framesInFlight;
     };
     const GraphicsStateInfo &graphicsStateInfo();
+
+    struct FrameStatistics {
+        qint64 polishTime = 0;
+        qint64 animationTime = 0;
+        qint64 syncTime = 0;
+        qint64 renderPrepareTime = 0;
+        qint64 renderTime = 0;
+        qint64 swapTime = 0;
+        int batchCount = 0;
+        int mergedBatchCount = 0;
+        int unmergedBatchCount = 0;
+        qint64 uploadedVertexBytes = 0;
+        int textureUploadCount = 0;
+        int materialChangeCount = 0;
+        int culledNodeCount = 0;
+        int reserved[15] = {};
+    };
+    FrameStatistics frameStatistics() const;
+
     void beginExternalCommands();
     void endExternalCommands();
     QQmlIncubationController *incubationController() const;
@@ -240,6 +240,10 @@ public:
     QQuickGraphicsConfiguration graphicsConfig;
 
     mutable QQuickWindowIncubationController *incubationController;
+    // The incubation budgets of the views in this window
+    QHash<QQuickItem *, int> incubationBudgets;
+    static void setIncubationBudget(QQuickItem *view, int msecs);
+    int incubationBudget() const;
 
     static bool defaultAlphaBuffer;
     static QQuickWindow::TextRenderType textRenderType;
@@ -269,6 +273,13 @@ public:
     QOpenGLContext *openglContext();
 
     QQuickWindow::GraphicsStateInfo rhiStateInfo;
+
+    // Written by the render loop, possibly on the render thread, and read by
+    // QQuickWindow::frameStatistics() on the GUI thread.
+    mutable QMutex frameStatisticsMutex;
+    QQuickWindow::FrameStatistics frameStatistics;
+    void recordPolishTimes(qint64 polishTime, qint64 animationTime);
+    void recordSyncAndSwapTimes(qint64 syncTime, qint64 swapTime);
     QRhi *rhi = nullptr;
     QRhiSwapChain *swapchain = nullptr;
     QRhiRenderBuffer *depthStencilForSwapchain = nullptr;
@@ -9,6 +9,9 @@
 #include "qsgsoftwarerenderablenode_p.h"
 
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QThreadPool>
+#include <QtGui/QImage>
 #include <QtGui/QWindow>
 #include <QtQuick/QSGSimpleRectNode>
 
@@ -19,6 +22,7 @@ QT_BEGIN_NAMESPACE
 QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *context)
     : QSGRenderer(context)
     , m_background(new QSGSimpleRectNode)
+    , m_renderThreadCount(qMax(1, qEnvironmentVariableIntValue("QSG_SOFTWARE_RENDER_THREADS")))
     , m_nodeUpdater(new QSGSoftwareRenderableNodeUpdater(this))
 {
     // Setup special background node
@@ -93,6 +97,9 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     if (m_renderableNodes.isEmpty())
         return dirtyRegion;
 
+    if (canRenderTiled(painter))
+        return renderTiled(painter);
+
     auto iterator = m_renderableNodes.begin();
     // First node is the background and needs to painted without blending
     if (m_clearColorEnabled) {
@@ -109,6 +116,141 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     return dirtyRegion;
 }
 
+/*!
+    \internal
+
+    Returns whether the render list can be painted in tiles on several
+    threads. This needs a QImage target without a device pixel ratio, which
+    can be split into tiles that share its pixels, and no render node to
+    paint, as render nodes paint through the painter of the render context.
+*/
+bool QSGAbstractSoftwareRenderer::canRenderTiled(QPainter *painter) const
+{
+    if (m_renderThreadCount < 2)
+        return false;
+
+    const QPaintDevice *device = painter->device();
+    if (device->devType() != QInternal::Image)
+        return false;
+    const QImage *image = static_cast<const QImage *>(device);
+    if (image->depth() < 8 || image->depth() % 8 != 0 || image->colorCount() > 0
+            || !qFuzzyCompare(image->devicePixelRatio(), qreal(1)))
+        return false;
+
+    for (QSGSoftwareRenderableNode *node : std::as_const(m_renderableNodes)) {
+        if (node->type() == QSGSoftwareRenderableNode::RenderNode && node->needsPainting())
+            return false;
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Paints the render list like renderNodes(), but splits the area to be
+    painted into tiles that are painted in parallel. Each tile is painted by
+    its own QPainter on a QImage sharing the pixels of the target, and every
+    tile paints the nodes intersecting it in render list order, so the result
+    is the same as when painting serially.
+
+    Caches that nodes update lazily while painting are updated before the
+    tiles are painted. Nodes that cannot be painted concurrently are painted
+    one tile at a time.
+*/
+QRegion QSGAbstractSoftwareRenderer::renderTiled(QPainter *painter)
+{
+    static const int tileSize = 256;
+
+    struct PendingNode
+    {
+        QSGSoftwareRenderableNode *node;
+        QRect bounds; // in device coordinates
+        bool forceOpaquePainting;
+    };
+
+    QImage *image = static_cast<QImage *>(painter->device());
+    const QTransform deviceTransform = painter->combinedTransform();
+    const QRect deviceRect = image->rect();
+
+    auto begin = m_renderableNodes.cbegin();
+    // First node is the background and needs to painted without blending
+    if (!m_clearColorEnabled)
+        ++begin;
+
+    QList<PendingNode> pendingNodes;
+    QRect paintedRect;
+    for (auto it = begin; it != m_renderableNodes.cend(); ++it) {
+        QSGSoftwareRenderableNode *node = *it;
+        if (!node->needsPainting())
+            continue;
+        const QRect bounds = deviceTransform.mapRect(QRectF(node->dirtyRegion().boundingRect()))
+                .toAlignedRect() & deviceRect;
+        if (bounds.isEmpty())
+            continue;
+        node->prepareForPainting(image->devicePixelRatio());
+        pendingNodes.append({ node, bounds, it == m_renderableNodes.cbegin() });
+        paintedRect |= bounds;
+    }
+
+    QList<QRect> tiles;
+    for (int y = paintedRect.top() / tileSize * tileSize; y <= paintedRect.bottom(); y += tileSize) {
+        for (int x = paintedRect.left() / tileSize * tileSize; x <= paintedRect.right(); x += tileSize)
+            tiles.append(QRect(x, y, tileSize, tileSize) & paintedRect);
+    }
+
+    const int bytesPerPixel = image->depth() / 8;
+    const qsizetype bytesPerLine = image->bytesPerLine();
+    uchar *bits = image->bits();
+
+    QMutex serialPaintingMutex;
+    QAtomicInt nextTile = 0;
+    const auto paintTiles = [&]() {
+        for (int i = nextTile.fetchAndAddRelaxed(1); i < tiles.size(); i = nextTile.fetchAndAddRelaxed(1)) {
+            const QRect &tile = tiles.at(i);
+            QImage tileImage(bits + tile.y() * bytesPerLine + tile.x() * bytesPerPixel,
+                             tile.width(), tile.height(), bytesPerLine, image->format());
+            QPainter tilePainter(&tileImage);
+            tilePainter.setRenderHints(painter->renderHints());
+            tilePainter.setWindow(painter->window());
+            tilePainter.setViewport(painter->viewport().translated(-tile.topLeft()));
+            tilePainter.setWorldTransform(painter->worldTransform());
+
+            for (const PendingNode &pending : std::as_const(pendingNodes)) {
+                if (!pending.bounds.intersects(tile))
+                    continue;
+                if (pending.node->canPaintConcurrently()) {
+                    pending.node->paint(&tilePainter, pending.forceOpaquePainting);
+                } else {
+                    QMutexLocker locker(&serialPaintingMutex);
+                    pending.node->paint(&tilePainter, pending.forceOpaquePainting);
+                }
+            }
+        }
+    };
+
+    const int helperCount = qMin(m_renderThreadCount, int(tiles.size())) - 1;
+    if (helperCount > 0) {
+        if (!m_threadPool) {
+            m_threadPool = std::make_unique<QThreadPool>();
+            m_threadPool->setObjectName(QStringLiteral("QSGSoftwareRenderThreadPool"));
+        }
+        m_threadPool->setMaxThreadCount(m_renderThreadCount - 1);
+        for (int i = 0; i < helperCount; ++i)
+            m_threadPool->start(paintTiles);
+    }
+    paintTiles();
+    if (helperCount > 0)
+        m_threadPool->waitForDone();
+
+    qCDebug(lc2DRender) << "painted" << pendingNodes.size() << "nodes in" << tiles.size()
+                        << "tiles on" << helperCount + 1 << "threads";
+
+    QRegion dirtyRegion;
+    for (auto it = begin; it != m_renderableNodes.cend(); ++it)
+        dirtyRegion += (*it)->finishPainting(painter);
+    return dirtyRegion;
+}
+
 void QSGAbstractSoftwareRenderer::buildRenderList()
 {
     // Clear the previous renderlist
@@ -326,4 +468,17 @@ bool QSGAbstractSoftwareRenderer::clearColorEnabled() const
     return m_clearColorEnabled;
 }
 
+/*!
+    \internal
+
+    Sets the number of threads, including the rendering thread, that paint
+    the render list to \a count. With more than one thread, the render list
+    is painted in tiles when the target is a QImage. The default is taken from
+    the \c QSG_SOFTWARE_RENDER_THREADS environment variable, and is 1.
+*/
+void QSGAbstractSoftwareRenderer::setRenderThreadCount(int count)
+{
+    m_renderThreadCount = qMax(1, count);
+}
+
 QT_END_NAMESPACE
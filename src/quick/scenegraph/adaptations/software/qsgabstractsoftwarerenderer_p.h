@@ -19,9 +19,12 @@
 
 #include <QtCore/QHash>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 class QSGSimpleRectNode;
+class QThreadPool;
 
 class QSGSoftwareRenderableNode;
 class QSGSoftwareRenderableNodeUpdater;
@@ -43,6 +46,9 @@ public:
     void setClearColorEnabled(bool enable);
     bool clearColorEnabled() const;
 
+    void setRenderThreadCount(int count);
+    int renderThreadCount() const { return m_renderThreadCount; }
+
 protected:
     QRegion renderNodes(QPainter *painter);
     void buildRenderList();
@@ -64,6 +70,9 @@ private:
     void nodeMatrixUpdated(QSGNode *node);
     void nodeOpacityUpdated(QSGNode *node);
 
+    bool canRenderTiled(QPainter *painter) const;
+    QRegion renderTiled(QPainter *painter);
+
     QHash<QSGNode*, QSGSoftwareRenderableNode*> m_nodes;
     QVector<QSGSoftwareRenderableNode*> m_renderableNodes;
 
@@ -75,6 +84,9 @@ private:
     bool m_isOpaque = false;
     bool m_clearColorEnabled = true;
 
+    int m_renderThreadCount;
+    std::unique_ptr<QThreadPool> m_threadPool;
+
     QSGSoftwareRenderableNodeUpdater *m_nodeUpdater;
 };
 
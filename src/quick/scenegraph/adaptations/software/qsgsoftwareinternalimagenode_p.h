@@ -91,8 +91,9 @@ public:
     QRectF rect() const;
 
     const QPixmap &pixmap() const;
-private:
     void updateCachedMirroredPixmap();
+
+private:
     QRectF m_targetRect;
     QRectF m_innerTargetRect;
     QRectF m_innerSourceRect;
@@ -19,7 +19,7 @@
 
 QT_BEGIN_NAMESPACE
 
-class QSGSoftwarePixmapRenderer : public QSGAbstractSoftwareRenderer
+class Q_QUICK_EXPORT QSGSoftwarePixmapRenderer : public QSGAbstractSoftwareRenderer
 {
 public:
     QSGSoftwarePixmapRenderer(QSGRenderContext *context);
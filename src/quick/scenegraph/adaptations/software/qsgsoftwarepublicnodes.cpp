@@ -60,8 +60,7 @@ void QSGSoftwareImageNode::setTextureCoordinatesTransform(QSGImageNode::TextureC
 
 void QSGSoftwareImageNode::paint(QPainter *painter)
 {
-    if (m_cachedMirroredPixmapIsDirty)
-        updateCachedMirroredPixmap();
+    updateCachedMirroredPixmap();
 
     painter->setRenderHint(QPainter::SmoothPixmapTransform, (m_filtering == QSGTexture::Linear));
     // Disable antialiased clipping. It causes transformed tiles to have gaps.
@@ -82,6 +81,12 @@ void QSGSoftwareImageNode::paint(QPainter *painter)
 }
 
 void QSGSoftwareImageNode::updateCachedMirroredPixmap()
+{
+    if (m_cachedMirroredPixmapIsDirty)
+        rebuildCachedMirroredPixmap();
+}
+
+void QSGSoftwareImageNode::rebuildCachedMirroredPixmap()
 {
     if (m_transformMode == NoTransform) {
         m_cachedPixmap = QPixmap();
@@ -72,9 +72,10 @@ public:
     bool ownsTexture() const override { return m_owns; }
 
     void paint(QPainter *painter);
+    void updateCachedMirroredPixmap();
 
 private:
-    void updateCachedMirroredPixmap();
+    void rebuildCachedMirroredPixmap();
 
     QPixmap m_cachedPixmap;
     QSGTexture *m_texture;
@@ -211,43 +211,86 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
 {
     Q_ASSERT(painter);
 
-    // Check for don't paint conditions
-    if (m_nodeType != RenderNode) {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity) || m_dirtyRegion.isEmpty()) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        }
-    } else {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity)) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        } else {
-            QSGRenderNodePrivate *rd = QSGRenderNodePrivate::get(m_handle.renderNode);
-            rd->m_localMatrix = m_transform;
-            rd->m_matrix = &rd->m_localMatrix;
-            rd->m_opacity = m_opacity;
-
-            // all the clip region below is in world coordinates, taking m_transform into account already
-            QRegion cr = m_dirtyRegion;
-            if (m_clipRegion.rectCount() > 1)
-                cr &= m_clipRegion;
-
-            painter->save();
-            RenderNodeState rs;
-            rs.cr = cr;
-            m_handle.renderNode->render(&rs);
-            painter->restore();
+    if (needsPainting())
+        paint(painter, forceOpaquePainting);
+    return finishPainting(painter);
+}
 
-            const QRect br = m_handle.renderNode->flags().testFlag(QSGRenderNode::BoundedRectRendering)
-                ? m_boundingRectMax // already mapped to world
-                : QRect(0, 0, painter->device()->width(), painter->device()->height());
-            m_previousDirtyRegion = QRegion(br);
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return br;
-        }
+bool QSGSoftwareRenderableNode::needsPainting() const
+{
+    if (!m_isDirty || qFuzzyIsNull(m_opacity))
+        return false;
+    return m_nodeType == RenderNode || !m_dirtyRegion.isEmpty();
+}
+
+/*!
+    \internal
+
+    Returns whether the node can be painted on one thread while other nodes,
+    or other parts of the same node, are painted on other threads. Glyph and
+    painter nodes use caches that are not thread-safe, and render nodes paint
+    through the active painter of the render context.
+*/
+bool QSGSoftwareRenderableNode::canPaintConcurrently() const
+{
+    switch (m_nodeType) {
+    case Glyph:
+    case Painter:
+    case RenderNode:
+        return false;
+    default:
+        return true;
+    }
+}
+
+/*!
+    \internal
+
+    Updates the caches that the node would otherwise update lazily when it
+    is painted, so that it can be painted by several threads at once.
+*/
+void QSGSoftwareRenderableNode::prepareForPainting(qreal devicePixelRatio)
+{
+    switch (m_nodeType) {
+    case Image:
+        m_handle.imageNode->updateCachedMirroredPixmap();
+        break;
+    case Rectangle:
+        m_handle.rectangleNode->setDevicePixelRatio(devicePixelRatio);
+        break;
+    case SimpleImage:
+        static_cast<QSGSoftwareImageNode *>(m_handle.simpleImageNode)->updateCachedMirroredPixmap();
+        break;
+    default:
+        break;
+    }
+}
+
+/*!
+    \internal
+
+    Paints the dirty region of the node with \a painter, without changing the
+    dirty state of the node. This is done by finishPainting().
+*/
+void QSGSoftwareRenderableNode::paint(QPainter *painter, bool forceOpaquePainting)
+{
+    if (m_nodeType == RenderNode) {
+        QSGRenderNodePrivate *rd = QSGRenderNodePrivate::get(m_handle.renderNode);
+        rd->m_localMatrix = m_transform;
+        rd->m_matrix = &rd->m_localMatrix;
+        rd->m_opacity = m_opacity;
+
+        // all the clip region below is in world coordinates, taking m_transform into account already
+        QRegion cr = m_dirtyRegion;
+        if (m_clipRegion.rectCount() > 1)
+            cr &= m_clipRegion;
+
+        painter->save();
+        RenderNodeState rs;
+        rs.cr = cr;
+        m_handle.renderNode->render(&rs);
+        painter->restore();
+        return;
     }
 
     painter->save();
@@ -310,12 +353,32 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     }
 
     painter->restore();
+}
+
+/*!
+    \internal
+
+    Marks the node as clean after it was painted with \a painter, or after
+    it was found not to need painting. Returns the area that was painted.
+*/
+QRegion QSGSoftwareRenderableNode::finishPainting(QPainter *painter)
+{
+    QRegion areaToBeFlushed;
+    if (needsPainting()) {
+        if (m_nodeType == RenderNode) {
+            const QRect br = m_handle.renderNode->flags().testFlag(QSGRenderNode::BoundedRectRendering)
+                ? m_boundingRectMax // already mapped to world
+                : QRect(0, 0, painter->device()->width(), painter->device()->height());
+            m_previousDirtyRegion = QRegion(br);
+            areaToBeFlushed = br;
+        } else {
+            areaToBeFlushed = m_dirtyRegion;
+            m_previousDirtyRegion = QRegion(m_boundingRectMax);
+        }
+    }
 
-    QRegion areaToBeFlushed = m_dirtyRegion;
-    m_previousDirtyRegion = QRegion(m_boundingRectMax);
     m_isDirty = false;
     m_dirtyRegion = QRegion();
-
     return areaToBeFlushed;
 }
 
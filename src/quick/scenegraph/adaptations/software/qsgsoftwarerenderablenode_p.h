@@ -62,6 +62,11 @@ public:
     void update();
 
     QRegion renderNode(QPainter *painter, bool forceOpaquePainting = false);
+    bool needsPainting() const;
+    bool canPaintConcurrently() const;
+    void prepareForPainting(qreal devicePixelRatio);
+    void paint(QPainter *painter, bool forceOpaquePainting = false);
+    QRegion finishPainting(QPainter *painter);
     QRect boundingRectMin() const { return m_boundingRectMin; }
     QRect boundingRectMax() const { return m_boundingRectMax; }
     NodeType type() const { return m_nodeType; }
@@ -107,16 +107,13 @@ void QSGSoftwareRenderLoop::renderWindow(QQuickWindow *window, bool isNewExpose)
     Q_TRACE_SCOPE(QSG_renderWindow)
     QElapsedTimer renderTimer;
     qint64 renderTime = 0, syncTime = 0, polishTime = 0;
-    bool profileFrames = QSG_RASTER_LOG_TIME_RENDERLOOP().isDebugEnabled();
-    if (profileFrames)
-        renderTimer.start();
+    renderTimer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphPolishFrame);
     Q_TRACE(QSG_polishItems_entry);
 
     cd->polishItems();
 
-    if (profileFrames)
-        polishTime = renderTimer.nsecsElapsed();
+    polishTime = renderTimer.nsecsElapsed();
     Q_TRACE(QSG_polishItems_exit);
     Q_QUICK_SG_PROFILE_SWITCH(QQuickProfiler::SceneGraphPolishFrame,
                               QQuickProfiler::SceneGraphRenderLoopFrame,
@@ -130,8 +127,7 @@ void QSGSoftwareRenderLoop::renderWindow(QQuickWindow *window, bool isNewExpose)
     cd->syncSceneGraph();
     rc->endSync();
 
-    if (profileFrames)
-        syncTime = renderTimer.nsecsElapsed();
+    syncTime = renderTimer.nsecsElapsed();
     Q_TRACE(QSG_sync_exit);
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphRenderLoopSync);
@@ -144,8 +140,7 @@ void QSGSoftwareRenderLoop::renderWindow(QQuickWindow *window, bool isNewExpose)
 
     cd->renderSceneGraph();
 
-    if (profileFrames)
-        renderTime = renderTimer.nsecsElapsed();
+    renderTime = renderTimer.nsecsElapsed();
     Q_TRACE(QSG_render_exit);
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphRenderLoopRender);
@@ -167,9 +162,9 @@ void QSGSoftwareRenderLoop::renderWindow(QQuickWindow *window, bool isNewExpose)
 
     emit window->afterFrameEnd();
 
-    qint64 swapTime = 0;
-    if (profileFrames)
-        swapTime = renderTimer.nsecsElapsed();
+    const qint64 swapTime = renderTimer.nsecsElapsed();
+    cd->recordPolishTimes(polishTime, 0);
+    cd->recordSyncAndSwapTimes(syncTime - polishTime, swapTime - renderTime);
     Q_TRACE(QSG_swap_exit);
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphRenderLoopFrame,
                            QQuickProfiler::SceneGraphRenderLoopSwap);
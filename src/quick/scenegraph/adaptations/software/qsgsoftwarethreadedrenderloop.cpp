@@ -143,6 +143,7 @@ public:
 
     void syncAndRender();
     void sync(bool inExpose);
+    void finishFrame();
 
     void requestRepaint()
     {
@@ -168,6 +169,8 @@ public:
     volatile bool active = false;
     uint pendingUpdate = 0;
     bool sleeping = false;
+    bool rendering = false;
+    bool syncDeferred = false;
     bool syncResultedInChanges = false;
     float vsyncDelta;
     QMutex mutex;
@@ -202,6 +205,7 @@ bool QSGSoftwareRenderThread::event(QEvent *e)
             delete backingStore;
             backingStore = nullptr;
         }
+        syncDeferred = false;
         waitCondition.wakeOne();
         mutex.unlock();
         return true;
@@ -428,11 +432,16 @@ void QSGSoftwareRenderThread::syncAndRender()
     const bool exposeRequested = (pendingUpdate & ExposeRequest) == ExposeRequest;
     pendingUpdate = 0;
 
+    mutex.lock();
+    rendering = true;
+    mutex.unlock();
+
     emit exposedWindow->beforeFrameBegin();
 
     if (syncRequested)
         sync(exposeRequested);
 
+    syncTime = waitTimer.nsecsElapsed();
     Q_TRACE(QSG_sync_exit);
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphRenderLoopSync);
@@ -442,6 +451,7 @@ void QSGSoftwareRenderThread::syncAndRender()
         int waitTime = vsyncDelta - (int) waitTimer.elapsed();
         if (waitTime > 0)
             msleep(waitTime);
+        finishFrame();
         return;
     }
 
@@ -462,6 +472,7 @@ void QSGSoftwareRenderThread::syncAndRender()
             softwareRenderer->setBackingStore(backingStore);
         wd->renderSceneGraph();
 
+        renderTime = waitTimer.nsecsElapsed();
         Q_TRACE(QSG_render_exit);
         Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                                   QQuickProfiler::SceneGraphRenderLoopRender);
@@ -480,6 +491,7 @@ void QSGSoftwareRenderThread::syncAndRender()
         renderThrottleTimer.start();
 
         wd->fireFrameSwapped();
+        wd->recordSyncAndSwapTimes(syncTime, waitTimer.nsecsElapsed() - renderTime);
     } else {
         Q_TRACE(QSG_render_exit);
         Q_QUICK_SG_PROFILE_SKIP(QQuickProfiler::SceneGraphRenderLoopFrame,
@@ -498,11 +510,29 @@ void QSGSoftwareRenderThread::syncAndRender()
         mutex.unlock();
     }
 
+    finishFrame();
+
     Q_TRACE(QSG_swap_exit);
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphRenderLoopFrame,
                            QQuickProfiler::SceneGraphRenderLoopSwap);
 }
 
+/*
+    Called when the render thread is done with a frame. In pipelined mode the
+    GUI thread does not wait for a frame to be rasterized when it wants to
+    sync the next one, but defers the sync until it is notified here.
+ */
+void QSGSoftwareRenderThread::finishFrame()
+{
+    QMutexLocker locker(&mutex);
+    rendering = false;
+    if (syncDeferred) {
+        syncDeferred = false;
+        qCDebug(QSG_RASTER_LOG_RENDERLOOP, "RT - frame done, requesting deferred sync");
+        QCoreApplication::postEvent(renderLoop, new QSGSoftwareWindowEvent(exposedWindow, QEvent::Type(WM_ReadyForSync)));
+    }
+}
+
 QSGSoftwareThreadedRenderLoop::WindowData *QSGSoftwareThreadedRenderLoop::windowFor(QQuickWindow *window)
 {
     for (const auto &t : std::as_const(m_windows)) {
@@ -514,8 +544,9 @@ QSGSoftwareThreadedRenderLoop::WindowData *QSGSoftwareThreadedRenderLoop::window
 
 
 QSGSoftwareThreadedRenderLoop::QSGSoftwareThreadedRenderLoop()
+    : m_pipelined(qEnvironmentVariableIntValue("QSG_SOFTWARE_PIPELINED_RENDERING") != 0)
 {
-    qCDebug(QSG_RASTER_LOG_RENDERLOOP, "software threaded render loop constructor");
+    qCDebug(QSG_RASTER_LOG_RENDERLOOP, "software threaded render loop constructor, pipelined: %d", m_pipelined);
     m_sg = new QSGSoftwareContext;
     m_anim = m_sg->createAnimationDriver(this);
     connect(m_anim, &QAnimationDriver::started, this, &QSGSoftwareThreadedRenderLoop::onAnimationStarted);
@@ -732,6 +763,14 @@ bool QSGSoftwareThreadedRenderLoop::event(QEvent *e)
             emit timeToIncubate();
             return true;
         }
+    } else if (e->type() == QEvent::Type(WM_ReadyForSync)) {
+        QSGSoftwareWindowEvent *we = static_cast<QSGSoftwareWindowEvent *>(e);
+        WindowData *w = windowFor(we->window);
+        if (w && w->syncDeferred) {
+            w->syncDeferred = false;
+            polishAndSync(w, false);
+        }
+        return true;
     }
 
     return QObject::event(e);
@@ -787,6 +826,7 @@ void QSGSoftwareThreadedRenderLoop::handleExposure(QQuickWindow *window)
         win.thread = new QSGSoftwareRenderThread(this, rc);
         win.updateDuringSync = false;
         win.forceRenderPass = true; // also covered by polishAndSync(inExpose=true), but doesn't hurt
+        win.syncDeferred = false;
         m_windows.append(win);
         w = &m_windows.last();
     }
@@ -919,8 +959,11 @@ void QSGSoftwareThreadedRenderLoop::polishAndSync(QSGSoftwareThreadedRenderLoop:
     Q_TRACE(QSG_polishItems_entry);
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphPolishAndSync);
 
+    QElapsedTimer timer;
+    timer.start();
     QQuickWindowPrivate *wd = QQuickWindowPrivate::get(window);
     wd->polishItems();
+    const qint64 polishTime = timer.nsecsElapsed();
 
     Q_TRACE(QSG_polishItems_exit);
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphPolishAndSync,
@@ -933,6 +976,29 @@ void QSGSoftwareThreadedRenderLoop::polishAndSync(QSGSoftwareThreadedRenderLoop:
 
     qCDebug(QSG_RASTER_LOG_RENDERLOOP, "polishAndSync - lock for sync");
     w->thread->mutex.lock();
+
+    // In pipelined mode, do not block while the previous frame is being
+    // rasterized. The render thread asks for the sync once it is done, and
+    // until then the GUI thread is free to process events and bindings.
+    if (m_pipelined && !inExpose && w->thread->rendering) {
+        qCDebug(QSG_RASTER_LOG_RENDERLOOP, "polishAndSync - render thread busy, deferring sync");
+        w->thread->syncDeferred = true;
+        w->syncDeferred = true;
+        w->thread->mutex.unlock();
+        wd->recordPolishTimes(polishTime, 0);
+        Q_TRACE(QSG_sync_exit);
+        Q_QUICK_SG_PROFILE_SKIP(QQuickProfiler::SceneGraphPolishAndSync,
+                                QQuickProfiler::SceneGraphPolishAndSyncPolish, 2);
+        Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphPolishAndSync,
+                               QQuickProfiler::SceneGraphPolishAndSyncAnimations);
+        return;
+    }
+
+    // This sync covers any deferred one, such as when an expose event
+    // arrives while waiting for the render thread.
+    w->thread->syncDeferred = false;
+    w->syncDeferred = false;
+
     lockedForSync = true;
     w->thread->postEvent(new QSGSoftwareSyncEvent(window, inExpose, w->forceRenderPass));
     w->forceRenderPass = false;
@@ -953,6 +1019,7 @@ void QSGSoftwareThreadedRenderLoop::polishAndSync(QSGSoftwareThreadedRenderLoop:
                               QQuickProfiler::SceneGraphPolishAndSyncSync);
     Q_TRACE(QSG_animations_entry);
 
+    const qint64 syncTime = timer.nsecsElapsed();
     if (!animationTimer && m_anim->isRunning()) {
         qCDebug(QSG_RASTER_LOG_RENDERLOOP, "polishAndSync - advancing animations");
         m_anim->advance();
@@ -963,6 +1030,10 @@ void QSGSoftwareThreadedRenderLoop::polishAndSync(QSGSoftwareThreadedRenderLoop:
         w->window->requestUpdate();
     }
 
+    // Advancing the animations may have deleted the window
+    if (windowFor(window))
+        wd->recordPolishTimes(polishTime, timer.nsecsElapsed() - syncTime);
+
     Q_TRACE(QSG_animations_exit);
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphPolishAndSync,
                            QQuickProfiler::SceneGraphPolishAndSyncAnimations);
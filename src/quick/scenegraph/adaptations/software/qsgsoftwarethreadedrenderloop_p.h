@@ -59,6 +59,7 @@ private:
         QSGSoftwareRenderThread *thread;
         uint updateDuringSync : 1;
         uint forceRenderPass : 1;
+        uint syncDeferred : 1;
     };
 
     WindowData *windowFor(QQuickWindow *window);
@@ -74,6 +75,7 @@ private:
     QAnimationDriver *m_anim;
     int animationTimer = 0;
     bool lockedForSync = false;
+    bool m_pipelined;
     QList<WindowData> m_windows;
 
     friend class QSGSoftwareRenderThread;
@@ -79,6 +79,7 @@ void Atlas::enqueueTextureUpload(QSGRhiAtlasTexture::TextureBase *t, QRhiResourc
     subresDesc.setDestinationTopLeft(r.topLeft());
 
     QRhiTextureUploadDescription desc(QRhiTextureUploadEntry(0, 0, subresDesc));
+    QSGTexturePrivate::countUpload();
     rcub->uploadTexture(m_texture, desc);
 
     qCDebug(QSG_LOG_TEXTUREIO, "compressed atlastexture upload, size %dx%d format 0x%x",
@@ -368,6 +368,7 @@ void QSGCompressedTexture::commitTextureOperations(QRhi *rhi, QRhiResourceUpdate
     }
 
     // only upload mip level 0 since we never do mipmapping for compressed textures (for now?)
+    QSGTexturePrivate::countUpload();
     resourceUpdates->uploadTexture(
             m_texture,
             QRhiTextureUploadEntry(0, 0,
@@ -8,6 +8,8 @@
 #include <qmath.h>
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 #include <QtCore/QtNumeric>
 
 #include <QtGui/QGuiApplication>
@@ -16,6 +18,9 @@
 #include "qsgmaterialshader_p.h"
 
 #include "qsgrhivisualizer_p.h"
+#include <QtQuick/qsgflatcolormaterial.h>
+#include <QtQuick/qsgtexturematerial.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
 
 #include <algorithm>
 
@@ -718,12 +723,7 @@ BatchCompatibility Batch::isMaterialCompatible(Element *e) const
  */
 bool Batch::geometryWasChanged(QSGGeometryNode *gn)
 {
-    Element *e = first;
-    Q_ASSERT_X(e, "Batch::geometryWasChanged", "Batch is expected to 'valid' at this time");
-    // 'gn' is the first node in the batch, compare against the next one.
-    while (e && (e->node == gn || e->removed))
-        e = e->nextInBatch;
-    if (!e || e->node->geometry()->attributes() == gn->geometry()->attributes()) {
+    if (hasCompatibleGeometry(gn)) {
         needsUpload = true;
         return true;
     } else {
@@ -731,6 +731,16 @@ bool Batch::geometryWasChanged(QSGGeometryNode *gn)
     }
 }
 
+bool Batch::hasCompatibleGeometry(QSGGeometryNode *gn) const
+{
+    Element *e = first;
+    Q_ASSERT_X(e, "Batch::hasCompatibleGeometry", "Batch is expected to 'valid' at this time");
+    // 'gn' is the first node in the batch, compare against the next one.
+    while (e && (e->node == gn || e->removed))
+        e = e->nextInBatch;
+    return !e || e->node->geometry()->attributes() == gn->geometry()->attributes();
+}
+
 void Batch::cleanupRemovedElements()
 {
     if (!needsPurge)
@@ -863,6 +873,7 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMod
     , m_currentShader(nullptr)
     , m_vertexUploadPool(256)
     , m_indexUploadPool(64)
+    , m_batchUploads(16)
 {
     m_rhi = m_context->rhi();
     Q_ASSERT(m_rhi); // no more direct OpenGL code path in Qt 6
@@ -892,10 +903,22 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMod
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
     m_srbPoolThreshold = qt_sg_envInt("QSG_RENDERER_SRB_POOL_THRESHOLD", 1024);
     m_bufferPoolSizeLimit = qt_sg_envInt("QSG_RENDERER_BUFFER_POOL_LIMIT", DEFAULT_BUFFER_POOL_SIZE_LIMIT);
+    // Parallel uploads are opt-in: each renderer would otherwise start its own
+    // threads, competing with the other render threads and the GUI thread.
+    m_uploadThreadCount = qBound(1, qt_sg_envInt("QSG_RENDERER_UPLOAD_THREADS", 1),
+                                 QThread::idealThreadCount());
+    m_uploadVertexThreshold = qt_sg_envInt("QSG_RENDERER_UPLOAD_VERTEX_THRESHOLD", 32768);
+    m_damage.enabled = qt_sg_envInt("QSG_RENDERER_DAMAGE_TRACKING", 0) != 0;
+    // Occlusion culling is opt-in: finding the occluders and testing every
+    // element against them costs a pass over the render lists whenever a
+    // matrix, geometry or opacity changes, which most scenes don't earn back.
+    m_occluderLimit = qt_sg_envInt("QSG_RENDERER_OCCLUDER_LIMIT", 0);
 
     if (Q_UNLIKELY(debug_build() || debug_render() || debug_pools())) {
         qDebug("Batch thresholds: nodes: %d vertices: %d srb pool: %d buffer pool: %d",
                m_batchNodeThreshold, m_batchVertexThreshold, m_srbPoolThreshold, m_bufferPoolSizeLimit);
+        qDebug("Upload threads: %d vertex threshold: %d", m_uploadThreadCount, m_uploadVertexThreshold);
+        qDebug("Damage tracking: %s occluders: %d", m_damage.enabled ? "enabled" : "disabled", m_occluderLimit);
     }
 }
 
@@ -971,6 +994,7 @@ void Renderer::destroyGraphicsResources()
 
     qDeleteAll(m_samplers);
     m_stencilClipCommon.reset();
+    m_damage.releaseResources();
     delete m_dummyTexture;
     m_visualizer->releaseResources();
 }
@@ -1025,15 +1049,15 @@ void Renderer::invalidateAndRecycleBatch(Batch *b)
     m_batchPool.add(b);
 }
 
-void Renderer::map(Buffer *buffer, quint32 byteSize, bool isIndexBuf)
+void Renderer::map(Buffer *buffer, quint32 byteSize, bool isIndexBuf, quint32 poolOffset)
 {
     if (m_visualizer->mode() == Visualizer::VisualizeNothing) {
         // Common case, use a shared memory pool for uploading vertex data to avoid
         // excessive reevaluation
         QDataBuffer<char> &pool = isIndexBuf ? m_indexUploadPool : m_vertexUploadPool;
-        if (byteSize > quint32(pool.size()))
-            pool.resize(byteSize);
-        buffer->data = pool.data();
+        if (poolOffset + byteSize > quint32(pool.size()))
+            pool.resize(poolOffset + byteSize);
+        buffer->data = pool.data() + poolOffset;
     } else if (buffer->size != byteSize) {
         free(buffer->data);
         buffer->data = (char *) malloc(byteSize);
@@ -1106,6 +1130,7 @@ void Renderer::unmap(Buffer *buffer, bool isIndexBuf)
         }
     }
     if (buffer->buf) {
+        m_frameStatistics.uploadedVertexBytes += buffer->size;
         if (buffer->buf->type() != QRhiBuffer::Dynamic) {
             m_resourceUpdates->uploadStaticBuffer(buffer->buf, 0, buffer->size, buffer->data);
             buffer->nonDynamicChangeCount += 1;
@@ -1281,7 +1306,8 @@ void Renderer::nodeWasRemoved(Node *node)
                 e->batch->needsUpload = true;
                 e->batch->needsPurge = true;
             }
-
+            if (e->hasDamageRect)
+                m_damage.removed += e->damageRect;
         }
 
     } else if (node->type() == QSGNode::ClipNodeType) {
@@ -1311,6 +1337,9 @@ void Renderer::nodeWasRemoved(Node *node)
 
             if (e->batch != nullptr)
                 e->batch->needsPurge = true;
+
+            // What the render node drew is not known
+            m_damage.full = true;
         }
     }
 
@@ -1340,6 +1369,35 @@ void Renderer::turnNodeIntoBatchRoot(Node *node)
 }
 
 
+/*
+    Returns true if the geometry of \a e still has the layout it was merged
+    into its batch with, so that its vertices and indices fill the same
+    ranges of the batch's buffers.
+ */
+static bool qsg_keepsMergedRange(const Element *e)
+{
+    const QSGGeometry *g = e->node->geometry();
+    return g->vertexCount() > 0
+            && g->vertexCount() == e->mergedRange.vertexCount
+            && g->indexCount() == e->mergedRange.indexCount
+            && g->drawingMode() == e->mergedRange.drawingMode
+            && g->indexType() == QSGGeometry::UnsignedShortType;
+}
+
+/*
+    Returns true if the bounds of \a e, which were \a oldBounds before its
+    geometry changed, stayed the same. Alpha batches depend on the bounds of
+    their elements not overlapping with other batches.
+ */
+static bool qsg_keepsBounds(Element *e, bool hadBounds, const Rect &oldBounds)
+{
+    if (!hadBounds)
+        return false;
+    e->ensureBoundsValid();
+    return e->bounds.tl.x == oldBounds.tl.x && e->bounds.tl.y == oldBounds.tl.y
+            && e->bounds.br.x == oldBounds.br.x && e->bounds.br.y == oldBounds.br.y;
+}
+
 void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
 {
 #ifndef QT_NO_DEBUG_OUTPUT
@@ -1412,6 +1470,23 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
     }
 
     shadowNode->dirtyState |= state;
+    if (m_occluderLimit > 0 && (state & (QSGNode::DirtyGeometry
+                                         | QSGNode::DirtyMaterial
+                                         | QSGNode::DirtyMatrix
+                                         | QSGNode::DirtyNodeAdded
+                                         | QSGNode::DirtyNodeRemoved
+                                         | QSGNode::DirtyOpacity))) {
+        m_occlusionDirty = true;
+    }
+
+    if (m_damage.enabled && (state & (QSGNode::DirtyGeometry
+                                      | QSGNode::DirtyMaterial
+                                      | QSGNode::DirtyMatrix
+                                      | QSGNode::DirtyNodeAdded
+                                      | QSGNode::DirtyOpacity
+                                      | QSGNode::DirtyForceUpdate))) {
+        m_damage.nodes.insert(node);
+    }
 
     if (state & QSGNode::DirtyMatrix && !shadowNode->isBatchRoot) {
         Q_ASSERT(node->type() == QSGNode::TransformNodeType);
@@ -1430,10 +1505,18 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
         QSGGeometryNode *gn = static_cast<QSGGeometryNode *>(node);
         Element *e = shadowNode->element();
         if (e) {
+            const bool hadBounds = e->boundsComputed;
+            const Rect oldBounds = e->bounds;
             e->boundsComputed = false;
             Batch *b = e->batch;
             if (b) {
-                if (!e->batch->geometryWasChanged(gn) || !e->batch->isOpaque) {
+                if (b->merged && !b->needsUpload && b->hasCompatibleGeometry(gn)
+                        && qsg_keepsMergedRange(e) && (b->isOpaque || qsg_keepsBounds(e, hadBounds, oldBounds))) {
+                    // Only the contents changed, such as the color of a
+                    // rectangle, so the data is replaced where it is.
+                    e->needsPartialUpload = true;
+                    b->needsPartialUpload = true;
+                } else if (!e->batch->geometryWasChanged(gn) || !e->batch->isOpaque) {
                     invalidateBatchAndOverlappingRenderOrders(e->batch);
                 } else {
                     b->needsUpload = true;
@@ -1514,15 +1597,29 @@ void Renderer::buildRenderLists(QSGNode *node)
         Q_ASSERT(e);
 
         bool opaque = gn->inheritedOpacity() > OPAQUE_LIMIT && !(gn->activeMaterial()->flags() & QSGMaterial::Blending);
-        if (opaque && useDepthBuffer())
+        bool inOpaqueList = opaque && useDepthBuffer();
+        if (inOpaqueList)
             m_opaqueRenderList << e;
         else
             m_alphaRenderList << e;
 
-        e->order = ++m_nextRenderOrder;
-        // Used while rebuilding partial roots.
-        if (m_partialRebuild)
+        const int order = ++m_nextRenderOrder;
+        // Used while rebuilding partial roots. The element stays in its
+        // batch unless it moved to the other render list. Merged batches
+        // have the z order baked into their vertices, so these are uploaded
+        // again when the order of one of their elements changes.
+        if (m_partialRebuild) {
             e->orphaned = false;
+            if (e->batch) {
+                if (e->batch->isOpaque != inOpaqueList) {
+                    e->batch->invalidate();
+                    ++m_rebuildStats.invalidatedBatches;
+                } else if (e->order != order && e->batch->merged) {
+                    e->batch->needsUpload = true;
+                }
+            }
+        }
+        e->order = order;
 
     } else if (node->type() == QSGNode::ClipNodeType || shadowNode->isBatchRoot) {
         Q_ASSERT(m_nodes.contains(node));
@@ -1586,19 +1683,40 @@ static void qsg_addBackOrphanedElements(QDataBuffer<Element *> &orphans, QDataBu
     orphans.reset();
 }
 
+static bool qsg_canBatchOpaqueNodes(QSGGeometryNode *gni, QSGGeometryNode *gnj)
+{
+    const QSGGeometry *gniGeometry = gni->geometry();
+    const QSGMaterial *gniMaterial = gni->activeMaterial();
+    const QSGGeometry *gnjGeometry = gnj->geometry();
+    const QSGMaterial *gnjMaterial = gnj->activeMaterial();
+    return gni->clipList() == gnj->clipList()
+            && gniGeometry->drawingMode() == gnjGeometry->drawingMode()
+            && (gniGeometry->lineWidth() == gnjGeometry->lineWidth()
+                || (gniGeometry->drawingMode() != QSGGeometry::DrawLines
+                    && gniGeometry->drawingMode() != QSGGeometry::DrawLineStrip))
+            && gniGeometry->attributes() == gnjGeometry->attributes()
+            && gniGeometry->indexType() == gnjGeometry->indexType()
+            && gni->inheritedOpacity() == gnj->inheritedOpacity()
+            && gniMaterial->type() == gnjMaterial->type()
+            && gniMaterial->viewCount() == gnjMaterial->viewCount()
+            && gniMaterial->compare(gnjMaterial) == 0;
+}
+
 /*
  * To rebuild the tagged roots, we start by putting all subroots of tagged
  * roots into the list of tagged roots. This is to make the rest of the
  * algorithm simpler.
  *
- * Second, we invalidate all batches which belong to tagged roots, which now
- * includes the entire subtree under a given root
- *
  * Then we call buildRenderLists for all tagged subroots which do not have
  * parents which are tagged, aka, we traverse only the topmosts roots.
  *
  * Then we sort the render lists based on their render order, to restore the
  * right order for rendering.
+ *
+ * The batches of the tagged roots are kept. Finally, the new elements are
+ * spliced into the existing batches where possible, and only the batches
+ * they cannot be spliced into are invalidated, see
+ * retainBatchesOfTaggedRoots().
  */
 void Renderer::buildRenderListsForTaggedRoots()
 {
@@ -1620,18 +1738,6 @@ void Renderer::buildRenderListsForTaggedRoots()
         tagSubRoots(*it);
     }
 
-    for (int i=0; i<m_opaqueBatches.size(); ++i) {
-        Batch *b = m_opaqueBatches.at(i);
-        if (m_taggedRoots.contains(b->root))
-            invalidateAndRecycleBatch(b);
-
-    }
-    for (int i=0; i<m_alphaBatches.size(); ++i) {
-        Batch *b = m_alphaBatches.at(i);
-        if (m_taggedRoots.contains(b->root))
-            invalidateAndRecycleBatch(b);
-    }
-
     m_opaqueRenderList.reset();
     m_alphaRenderList.reset();
     int maxRenderOrder = m_nextRenderOrder;
@@ -1650,7 +1756,6 @@ void Renderer::buildRenderListsForTaggedRoots()
     }
     m_partialRebuild = false;
     m_partialRebuildRoot = nullptr;
-    m_taggedRoots.clear();
     m_nextRenderOrder = qMax(m_nextRenderOrder, maxRenderOrder);
 
     // Add orphaned elements back into the list and then sort it..
@@ -1662,6 +1767,141 @@ void Renderer::buildRenderListsForTaggedRoots()
     if (m_alphaRenderList.size())
         std::sort(&m_alphaRenderList.first(), &m_alphaRenderList.last() + 1, qsg_sort_element_increasing_order);
 
+    retainBatchesOfTaggedRoots();
+    m_taggedRoots.clear();
+}
+
+/*
+ * Brings the batches of the tagged roots up to date after their render
+ * lists were rebuilt, instead of building them again from scratch.
+ *
+ * Removed elements are dropped from the batches and the render order range
+ * of each batch is recalculated, as the elements may have been renumbered.
+ *
+ * A new alpha element has to be rendered between the elements it was
+ * inserted between, so the alpha batches spanning its render order are
+ * invalidated along with the ones overlapping them. So is the batch of the
+ * element preceding it, which the new element is likely to merge into.
+ *
+ * A new opaque element is appended to a compatible opaque batch of the same
+ * root if there is one, as the depth buffer takes care of the ordering.
+ *
+ * Elements which are left without a batch are picked up by
+ * prepareOpaqueBatches() and prepareAlphaBatches().
+ */
+void Renderer::retainBatchesOfTaggedRoots()
+{
+    const auto updateBatches = [this](const QDataBuffer<Batch *> &batches) {
+        for (int i=0; i<batches.size(); ++i) {
+            Batch *b = batches.at(i);
+            if (!b->first || !m_taggedRoots.contains(b->root))
+                continue;
+            b->cleanupRemovedElements();
+            if (!b->first)
+                continue;
+            int lastOrder = b->first->order;
+            for (Element *e = b->first->nextInBatch; e; e = e->nextInBatch)
+                lastOrder = qMax(lastOrder, e->order);
+            b->lastOrderInBatch = lastOrder;
+            ++m_rebuildStats.retainedBatches;
+        }
+    };
+    updateBatches(m_opaqueBatches);
+    updateBatches(m_alphaBatches);
+
+    QVarLengthArray<int, 64> insertedOrders;
+    for (int i=0; i<m_alphaRenderList.size(); ++i) {
+        Element *e = m_alphaRenderList.at(i);
+        if (!e || e->batch || e->removed || e->culled || e->isRenderNode || !m_taggedRoots.contains(e->root))
+            continue;
+        insertedOrders.append(e->order);
+
+        for (int j=i - 1; j >= 0; --j) {
+            Element *p = m_alphaRenderList.at(j);
+            if (!p)
+                continue;
+            if (p->batch && p->batch->first && !p->isRenderNode && p->root == e->root) {
+                invalidateBatchAndOverlappingRenderOrders(p->batch);
+                ++m_rebuildStats.invalidatedBatches;
+            }
+            break;
+        }
+    }
+
+    if (!insertedOrders.isEmpty()) {
+        for (int i=0; i<m_alphaBatches.size(); ++i) {
+            Batch *b = m_alphaBatches.at(i);
+            if (!b->first)
+                continue;
+            const int *next = std::upper_bound(insertedOrders.cbegin(), insertedOrders.cend(),
+                                               b->first->order);
+            if (next != insertedOrders.cend() && *next < b->lastOrderInBatch) {
+                invalidateBatchAndOverlappingRenderOrders(b);
+                ++m_rebuildStats.invalidatedBatches;
+            }
+        }
+    }
+
+    for (int i=0; i<m_opaqueRenderList.size(); ++i) {
+        Element *e = m_opaqueRenderList.at(i);
+        if (!e || e->batch || e->removed || e->culled || !m_taggedRoots.contains(e->root)
+                || e->node->geometry()->vertexCount() == 0) {
+            continue;
+        }
+        if (spliceIntoOpaqueBatch(e))
+            ++m_rebuildStats.splicedElements;
+    }
+}
+
+bool Renderer::spliceIntoOpaqueBatch(Element *e)
+{
+    for (int i=0; i<m_opaqueBatches.size(); ++i) {
+        Batch *b = m_opaqueBatches.at(i);
+        if (!b->first || b->root != e->root || !qsg_canBatchOpaqueNodes(b->first->node, e->node))
+            continue;
+
+        Element *last = b->first;
+        while (last->nextInBatch)
+            last = last->nextInBatch;
+        last->nextInBatch = e;
+        e->batch = b;
+        b->lastOrderInBatch = qMax(b->lastOrderInBatch, e->order);
+        b->needsUpload = true;
+        b->ubufDataValid = false;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Describes the batches of the last frame, opaque batches first, so that
+ * autotests can compare the results of partial and full rebuilds.
+ */
+QList<Renderer::BatchSnapshot> Renderer::batchSnapshot() const
+{
+    QList<BatchSnapshot> snapshot;
+    const auto addBatches = [&snapshot](const QDataBuffer<Batch *> &batches) {
+        for (int i=0; i<batches.size(); ++i) {
+            const Batch *b = batches.at(i);
+            if (!b->first || b->isRenderNode)
+                continue;
+            QVarLengthArray<Element *, 64> elements;
+            for (Element *e = b->first; e; e = e->nextInBatch)
+                elements.append(e);
+            std::sort(elements.begin(), elements.end(), qsg_sort_element_increasing_order);
+            BatchSnapshot info;
+            info.isOpaque = b->isOpaque;
+            info.merged = b->merged;
+            info.vertexCount = b->vertexCount;
+            info.indexCount = b->indexCount;
+            for (Element *e : elements)
+                info.nodes.append(e->node);
+            snapshot.append(info);
+        }
+    };
+    addBatches(m_opaqueBatches);
+    addBatches(m_alphaBatches);
+    return snapshot;
 }
 
 void Renderer::buildRenderListsFromScratch()
@@ -1714,6 +1954,208 @@ void Renderer::invalidateBatchAndOverlappingRenderOrders(Batch *batch)
     m_rebuild |= BuildBatches;
 }
 
+QMatrix4x4 qsg_matrixForRoot(Node *node);
+
+/*
+    Returns in \a rect the bounding rectangle of \a e in the coordinate system
+    of the scene, which is shared by all batch roots. Returns false if it is
+    not known, for example with a perspective transform.
+ */
+static bool qsg_sceneBounds(Element *e, const QMatrix4x4 &rootMatrix, QRectF *rect)
+{
+    e->ensureBoundsValid();
+    if (e->boundsOutsideFloatRange)
+        return false;
+    if (!qFuzzyIsNull(rootMatrix(3, 0)) || !qFuzzyIsNull(rootMatrix(3, 1)))
+        return false;
+    *rect = rootMatrix.mapRect(QRectF(QPointF(e->bounds.tl.x, e->bounds.tl.y),
+                                      QPointF(e->bounds.br.x, e->bounds.br.y)));
+    return true;
+}
+
+/*
+    Returns true if \a material is known to write every fragment it covers
+    when it is not blended. Custom materials may discard fragments, so only
+    the built-in materials used by QSGRectangleNode, QSGImageNode and the
+    rectangle and image nodes of Qt Quick qualify.
+ */
+static bool qsg_isOccludingMaterial(const QSGMaterial *material)
+{
+    static const QSGMaterialType *const types[] = {
+        QSGFlatColorMaterial().type(),
+        QSGOpaqueTextureMaterial().type(),
+        QSGTextureMaterial().type(),
+        QSGVertexColorMaterial().type()
+    };
+    return std::find(std::cbegin(types), std::cend(types), material->type()) != std::cend(types);
+}
+
+/*
+    Returns in \a rect the area of the scene that \a e paints over entirely,
+    which is what QSGRectangleNode, QSGImageNode and the rectangle and image
+    nodes of Qt Quick produce for opaque content: a single, unclipped, opaque
+    rectangle with an axis aligned transform. Returns false for anything else.
+ */
+static bool qsg_occluderRect(Element *e, const QMatrix4x4 &rootMatrix, QRectF *rect)
+{
+    QSGGeometryNode *gn = e->node;
+    if (e->isMaterialBlended || gn->inheritedOpacity() <= OPAQUE_LIMIT || gn->clipList()
+            || !qsg_isOccludingMaterial(gn->activeMaterial())) {
+        return false;
+    }
+
+    QSGGeometry *g = gn->geometry();
+    if (g->drawingMode() != QSGGeometry::DrawTriangleStrip || g->vertexCount() != 4
+            || (g->indexCount() != 0 && g->indexCount() != 4)) {
+        return false;
+    }
+    const int offset = qsg_positionAttribute(g);
+    if (offset == -1)
+        return false;
+
+    Pt p[4];
+    for (int i = 0; i < 4; ++i) {
+        int v = i;
+        if (g->indexCount()) {
+            v = g->indexType() == QSGGeometry::UnsignedShortType ? int(g->indexDataAsUShort()[i])
+                                                                  : int(g->indexDataAsUInt()[i]);
+            if (v >= 4)
+                return false;
+        }
+        p[i] = *reinterpret_cast<const Pt *>(static_cast<const char *>(g->vertexData())
+                                             + v * g->sizeOfVertex() + offset);
+    }
+
+    // The two triangles of the strip share the edge from p[1] to p[2]. They
+    // cover the rectangle if that edge is a diagonal and p[0] and p[3] are
+    // the other two corners.
+    const bool isRectangle = p[1].x != p[2].x && p[1].y != p[2].y
+            && ((p[0].x == p[1].x && p[0].y == p[2].y && p[3].x == p[2].x && p[3].y == p[1].y)
+                || (p[0].x == p[2].x && p[0].y == p[1].y && p[3].x == p[1].x && p[3].y == p[2].y));
+    if (!isRectangle)
+        return false;
+
+    const QMatrix4x4 m = rootMatrix * *gn->matrix();
+    if (!qFuzzyIsNull(m(0, 1)) || !qFuzzyIsNull(m(1, 0))
+            || !qFuzzyIsNull(m(3, 0)) || !qFuzzyIsNull(m(3, 1))) {
+        return false;
+    }
+    *rect = m.mapRect(QRectF(QPointF(p[1].x, p[1].y), QPointF(p[2].x, p[2].y)).normalized());
+    return !rect->isEmpty();
+}
+
+/*
+    Culls the elements that are entirely covered by an opaque rectangle which
+    is drawn on top of them. Culled elements are left out of the batches, like
+    elements without vertices, so they are neither uploaded nor drawn. Only
+    the m_occluderLimit largest occluders are considered, which covers the
+    typical case of full screen pages stacked on top of each other.
+ */
+void Renderer::updateOcclusion()
+{
+    if (m_occluderLimit <= 0 || m_renderMode == QSGRendererInterface::RenderMode3D)
+        return;
+    if (!m_occlusionDirty && !(m_rebuild & (BuildRenderLists | BuildRenderListsForTaggedRoots)))
+        return;
+    m_occlusionDirty = false;
+
+    struct Occluder {
+        QRectF rect;
+        int order;
+    };
+    QVarLengthArray<Occluder, 16> occluders;
+
+    // Many elements share a root, so look up its matrix only once
+    QHash<Node *, QMatrix4x4> rootMatrices;
+    const auto rootMatrix = [&rootMatrices](Node *root) -> const QMatrix4x4 & {
+        auto it = rootMatrices.find(root);
+        if (it == rootMatrices.end())
+            it = rootMatrices.insert(root, root ? qsg_matrixForRoot(root) : QMatrix4x4());
+        return *it;
+    };
+
+    const auto collectOccluders = [this, &occluders, &rootMatrix](const QDataBuffer<Element *> &list) {
+        for (int i = 0; i < list.size(); ++i) {
+            Element *e = list.at(i);
+            if (!e || e->removed || e->isRenderNode)
+                continue;
+            QRectF rect;
+            if (!qsg_occluderRect(e, rootMatrix(e->root), &rect))
+                continue;
+            if (occluders.size() < m_occluderLimit) {
+                occluders.append({ rect, e->order });
+                continue;
+            }
+            const auto area = [](const QRectF &r) { return r.width() * r.height(); };
+            Occluder *smallest = std::min_element(occluders.begin(), occluders.end(),
+                                                  [&area](const Occluder &a, const Occluder &b) {
+                return area(a.rect) < area(b.rect);
+            });
+            if (area(rect) > area(smallest->rect))
+                *smallest = { rect, e->order };
+        }
+    };
+    collectOccluders(m_opaqueRenderList);
+    collectOccluders(m_alphaRenderList);
+
+    if (occluders.isEmpty() && m_culledElementCount == 0)
+        return;
+
+    int culledCount = 0;
+    QVarLengthArray<int, 16> unculledAlphaOrders;
+    const auto cull = [&](const QDataBuffer<Element *> &list, bool isAlphaList) {
+        for (int i = 0; i < list.size(); ++i) {
+            Element *e = list.at(i);
+            if (!e || e->removed || e->isRenderNode)
+                continue;
+
+            bool culled = false;
+            QRectF rect;
+            if (!occluders.isEmpty()
+                    && qsg_sceneBounds(e, rootMatrix(e->root), &rect)) {
+                for (const Occluder &occluder : std::as_const(occluders)) {
+                    if (occluder.order > e->order && occluder.rect.contains(rect)) {
+                        culled = true;
+                        break;
+                    }
+                }
+            }
+
+            if (culled) {
+                ++culledCount;
+                if (e->batch) {
+                    invalidateBatchAndOverlappingRenderOrders(e->batch);
+                    ++m_rebuildStats.invalidatedBatches;
+                }
+            } else if (e->culled) {
+                if (isAlphaList)
+                    unculledAlphaOrders.append(e->order);
+                m_rebuild |= BuildBatches;
+            }
+            e->culled = culled;
+        }
+    };
+    cull(m_opaqueRenderList, false);
+    cull(m_alphaRenderList, true);
+
+    // An alpha element that is drawn again must not end up below a batch
+    // that spans its order.
+    for (int i = 0; i < m_alphaBatches.size() && !unculledAlphaOrders.isEmpty(); ++i) {
+        Batch *b = m_alphaBatches.at(i);
+        if (!b->first)
+            continue;
+        for (int order : std::as_const(unculledAlphaOrders)) {
+            if (b->first->order < order && order < b->lastOrderInBatch) {
+                invalidateBatchAndOverlappingRenderOrders(b);
+                ++m_rebuildStats.invalidatedBatches;
+                break;
+            }
+        }
+    }
+
+    m_culledElementCount = culledCount;
+}
+
 /* Clean up batches by making it a consecutive list of "valid"
  * batches and moving all invalidated batches to the batches pool.
  */
@@ -1733,9 +2175,10 @@ void Renderer::prepareOpaqueBatches()
 {
     for (int i=m_opaqueRenderList.size() - 1; i >= 0; --i) {
         Element *ei = m_opaqueRenderList.at(i);
-        if (!ei || ei->batch || ei->node->geometry()->vertexCount() == 0)
+        if (!ei || ei->batch || ei->culled || ei->node->geometry()->vertexCount() == 0)
             continue;
         Batch *batch = newBatch();
+        ++m_rebuildStats.createdBatches;
         batch->first = ei;
         batch->root = ei->root;
         batch->isOpaque = true;
@@ -1755,27 +2198,10 @@ void Renderer::prepareOpaqueBatches()
                 continue;
             if (ej->root != ei->root)
                 break;
-            if (ej->batch || ej->node->geometry()->vertexCount() == 0)
+            if (ej->batch || ej->culled || ej->node->geometry()->vertexCount() == 0)
                 continue;
 
-            QSGGeometryNode *gnj = ej->node;
-
-            const QSGGeometry *gniGeometry = gni->geometry();
-            const QSGMaterial *gniMaterial = gni->activeMaterial();
-            const QSGGeometry *gnjGeometry = gnj->geometry();
-            const QSGMaterial *gnjMaterial = gnj->activeMaterial();
-            if (gni->clipList() == gnj->clipList()
-                    && gniGeometry->drawingMode() == gnjGeometry->drawingMode()
-                    && (gniGeometry->lineWidth() == gnjGeometry->lineWidth()
-                        || (gniGeometry->drawingMode() != QSGGeometry::DrawLines
-                            && gniGeometry->drawingMode() != QSGGeometry::DrawLineStrip))
-                    && gniGeometry->attributes() == gnjGeometry->attributes()
-                    && gniGeometry->indexType() == gnjGeometry->indexType()
-                    && gni->inheritedOpacity() == gnj->inheritedOpacity()
-                    && gniMaterial->type() == gnjMaterial->type()
-                    && gniMaterial->viewCount() == gnjMaterial->viewCount()
-                    && gniMaterial->compare(gnjMaterial) == 0)
-            {
+            if (qsg_canBatchOpaqueNodes(gni, ej->node)) {
                 ej->batch = batch;
                 next->nextInBatch = ej;
                 next = ej;
@@ -1831,6 +2257,7 @@ void Renderer::prepareAlphaBatches()
 
         if (ei->isRenderNode) {
             Batch *rnb = newBatch();
+            ++m_rebuildStats.createdBatches;
             rnb->first = ei;
             rnb->root = ei->root;
             rnb->isOpaque = false;
@@ -1840,10 +2267,11 @@ void Renderer::prepareAlphaBatches()
             continue;
         }
 
-        if (ei->node->geometry()->vertexCount() == 0)
+        if (ei->culled || ei->node->geometry()->vertexCount() == 0)
             continue;
 
         Batch *batch = newBatch();
+        ++m_rebuildStats.createdBatches;
         batch->first = ei;
         batch->root = ei->root;
         batch->isOpaque = false;
@@ -1873,7 +2301,7 @@ void Renderer::prepareAlphaBatches()
             }
 
             QSGGeometryNode *gnj = ej->node;
-            if (gnj->geometry()->vertexCount() == 0)
+            if (ej->culled || gnj->geometry()->vertexCount() == 0)
                 continue;
 
             const QSGGeometry *gniGeometry = gni->geometry();
@@ -2068,22 +2496,111 @@ QMatrix4x4 qsg_matrixForRoot(Node *node)
     return *c->matrix();
 }
 
-void Renderer::uploadBatch(Batch *b)
+/*
+    Uploads all \a batches. The vertex and index data of the batches is
+    independent once they have been sized, so when there is enough of it, all
+    batches get their own region of the upload pools and are filled in
+    parallel. The resulting buffers are then handed to the QRhi in order, on
+    the render thread.
+ */
+void Renderer::uploadBatches(const QDataBuffer<Batch *> &batches)
+{
+    m_batchUploads.reset();
+    qint64 vertexCount = 0;
+    for (int i = 0; i < batches.size(); ++i) {
+        BatchUpload upload;
+        upload.batch = batches.at(i);
+        if (upload.batch->needsPartialUpload && !upload.batch->needsUpload
+                && !uploadChangedElements(upload.batch)) {
+            upload.batch->needsUpload = true;
+        }
+        if (prepareBatchUpload(upload.batch, &upload)) {
+            m_batchUploads.add(upload);
+            vertexCount += upload.batch->vertexCount;
+        }
+    }
+
+    const int threadCount = qMin(m_uploadThreadCount, m_batchUploads.size());
+    if (threadCount < 2 || vertexCount < m_uploadVertexThreshold || debug_upload()) {
+        for (int i = 0; i < m_batchUploads.size(); ++i) {
+            const BatchUpload &upload = m_batchUploads.at(i);
+            map(&upload.batch->ibo, upload.indexBufferSize, true);
+            map(&upload.batch->vbo, upload.vertexBufferSize);
+            fillBatchBuffers(upload.batch);
+            finishBatchUpload(upload.batch);
+        }
+        return;
+    }
+
+    // Give each batch its own, suitably aligned, region of the upload pools.
+    // The pools are grown up front so that they do not move while mapping.
+    const auto aligned = [](quint32 size) { return (size + 15) & ~quint32(15); };
+    quint32 vertexPoolSize = 0;
+    quint32 indexPoolSize = 0;
+    for (int i = 0; i < m_batchUploads.size(); ++i) {
+        vertexPoolSize += aligned(m_batchUploads.at(i).vertexBufferSize);
+        indexPoolSize += aligned(m_batchUploads.at(i).indexBufferSize);
+    }
+    if (vertexPoolSize > quint32(m_vertexUploadPool.size()))
+        m_vertexUploadPool.resize(vertexPoolSize);
+    if (indexPoolSize > quint32(m_indexUploadPool.size()))
+        m_indexUploadPool.resize(indexPoolSize);
+
+    quint32 vertexOffset = 0;
+    quint32 indexOffset = 0;
+    for (int i = 0; i < m_batchUploads.size(); ++i) {
+        const BatchUpload &upload = m_batchUploads.at(i);
+        map(&upload.batch->ibo, upload.indexBufferSize, true, indexOffset);
+        map(&upload.batch->vbo, upload.vertexBufferSize, false, vertexOffset);
+        indexOffset += aligned(upload.indexBufferSize);
+        vertexOffset += aligned(upload.vertexBufferSize);
+    }
+
+    QAtomicInt nextUpload = 0;
+    const auto fillBatches = [this, &nextUpload]() {
+        for (int i = nextUpload.fetchAndAddRelaxed(1); i < m_batchUploads.size(); i = nextUpload.fetchAndAddRelaxed(1))
+            fillBatchBuffers(m_batchUploads.at(i).batch);
+    };
+
+    if (!m_uploadThreadPool) {
+        m_uploadThreadPool = std::make_unique<QThreadPool>();
+        m_uploadThreadPool->setObjectName(QStringLiteral("QSGBatchRendererUploadPool"));
+        m_uploadThreadPool->setMaxThreadCount(m_uploadThreadCount - 1);
+    }
+    for (int i = 1; i < threadCount; ++i)
+        m_uploadThreadPool->start(fillBatches);
+    fillBatches();
+    m_uploadThreadPool->waitForDone();
+
+    for (int i = 0; i < m_batchUploads.size(); ++i)
+        finishBatchUpload(m_batchUploads.at(i).batch);
+
+    if (Q_UNLIKELY(debug_render())) {
+        qDebug() << " -> uploaded" << m_batchUploads.size() << "batches," << vertexCount
+                 << "vertices on" << threadCount << "threads";
+    }
+}
+
+/*
+    Decides whether \a b is merged and calculates the sizes of its vertex and
+    index buffers. Returns false if the batch has nothing to upload.
+ */
+bool Renderer::prepareBatchUpload(Batch *b, BatchUpload *upload)
 {
     // Early out if nothing has changed in this batch..
     if (!b->needsUpload) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "already uploaded...";
-        return;
+        return false;
     }
 
     if (!b->first) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "is invalid...";
-        return;
+        return false;
     }
 
     if (b->isRenderNode) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch: " << b << "is a render node...";
-        return;
+        return false;
     }
 
     // Figure out if we can merge or not, if not, then just render the batch as is..
@@ -2130,7 +2647,7 @@ void Renderer::uploadBatch(Batch *b)
     // Abort if there are no vertices in this batch.. We abort this late as
     // this is a broken usecase which we do not care to optimize for...
     if (b->vertexCount == 0 || (b->merged && b->indexCount == 0))
-        return;
+        return false;
 
     /* Allocate memory for this batch. Merged batches are divided into three separate blocks
            1. Vertex data for all elements, as they were in the QSGGeometry object, but
@@ -2154,8 +2671,19 @@ void Renderer::uploadBatch(Batch *b)
         ibufferSize = unmergedIndexSize;
     }
 
-    map(&b->ibo, ibufferSize, true);
-    map(&b->vbo, bufferSize);
+    upload->vertexBufferSize = bufferSize;
+    upload->indexBufferSize = ibufferSize;
+    return true;
+}
+
+/*
+    Fills the mapped vertex and index data of \a b. This only reads the
+    geometry of the batch's nodes and writes the batch's own buffers, so
+    different batches can be filled on different threads.
+ */
+void Renderer::fillBatchBuffers(Batch *b)
+{
+    QSGGeometry *g = b->first->node->geometry();
 
     if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << " first:" << b->first << " root:"
                                              << b->root << " merged:" << b->merged << " positionAttribute" << b->positionAttribute
@@ -2168,13 +2696,13 @@ void Renderer::uploadBatch(Batch *b)
 
         quint16 iOffset16 = 0;
         quint32 iOffset32 = 0;
-        e = b->first;
         uint verticesInSet = 0;
         // Start a new set already after 65534 vertices because 0xFFFF may be
         // used for an always-on primitive restart with some apis (adapt for
         // uint32 indices as appropriate).
         const uint verticesInSetLimit = m_uint32IndexForRhi ? 0xfffffffe : 0xfffe;
         int indicesInSet = 0;
+        Element *e = b->first;
         b->drawSets.reset();
         int drawSetIndices = 0;
         const char *indexBase = b->ibo.data;
@@ -2199,6 +2727,14 @@ void Renderer::uploadBatch(Batch *b)
             void *iBasePtr = &iOffset16;
             if (m_uint32IndexForRhi)
                 iBasePtr = &iOffset32;
+            QSGGeometry *eg = e->node->geometry();
+            e->mergedRange.vertexOffset = quint32(vertexData - b->vbo.data);
+            e->mergedRange.indexOffset = quint32(indexData - indexBase);
+            e->mergedRange.indexBase = m_uint32IndexForRhi ? iOffset32 : iOffset16;
+            e->mergedRange.vertexCount = eg->vertexCount();
+            e->mergedRange.indexCount = eg->indexCount();
+            e->mergedRange.drawingMode = eg->drawingMode();
+            e->needsPartialUpload = false;
             uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, iBasePtr, &indicesInSet);
             e = e->nextInBatch;
         }
@@ -2214,6 +2750,7 @@ void Renderer::uploadBatch(Batch *b)
         char *iboData = b->ibo.data;
         Element *e = b->first;
         while (e) {
+            e->needsPartialUpload = false;
             QSGGeometry *g = e->node->geometry();
             int vbs = g->vertexCount() * g->sizeOfVertex();
             memcpy(vboData, g->vertexData(), vbs);
@@ -2303,7 +2840,13 @@ void Renderer::uploadBatch(Batch *b)
         }
     }
 #endif // QT_NO_DEBUG_OUTPUT
+}
 
+/*
+    Hands the filled vertex and index data of \a b to the QRhi.
+ */
+void Renderer::finishBatchUpload(Batch *b)
+{
     unmap(&b->vbo);
     unmap(&b->ibo, true);
 
@@ -2311,9 +2854,123 @@ void Renderer::uploadBatch(Batch *b)
         qDebug() << "  --- vertex/index buffers unmapped, batch upload completed... vbo pool size" << m_vboPoolCost << "ibo pool size" << m_iboPoolCost;
 
     b->needsUpload = false;
+    b->needsPartialUpload = false;
+
+    if (Q_UNLIKELY(debug_render()))
+        b->uploadedThisFrame = true;
+}
+
+/*
+    Replaces the data of the elements of the merged batch \a b whose geometry
+    changed in place, such as when only the color of some rectangles in a
+    large grid changed. The elements are merged again into the ranges they
+    were given by the last full upload of the batch, and consecutive ranges
+    are uploaded together. The z order is left alone, as it only changes
+    together with the order of the elements, which uploads the whole batch.
+
+    Returns false if the whole batch has to be uploaded instead, either
+    because an element changed its layout or because so much changed that
+    one upload is cheaper. Updates count toward turning immutable buffers
+    into dynamic ones like full uploads do, and once that is due, the whole
+    batch is uploaded as well, which switches the buffers over in unmap().
+ */
+bool Renderer::uploadChangedElements(Batch *b)
+{
+    b->needsPartialUpload = false;
+    if (!b->merged || !b->first || !b->vbo.buf || !b->ibo.buf
+            || m_visualizer->mode() != Visualizer::VisualizeNothing) {
+        return false;
+    }
+    for (const Buffer *buffer : { &b->vbo, &b->ibo }) {
+        if (buffer->buf->type() != QRhiBuffer::Dynamic
+                && buffer->nonDynamicChangeCount > DYNAMIC_VERTEX_INDEX_BUFFER_THRESHOLD) {
+            return false;
+        }
+    }
+
+    const int vertexSize = b->first->node->geometry()->sizeOfVertex();
+    int changedVertexCount = 0;
+    int changedIndexCount = 0;
+    for (Element *e = b->first; e; e = e->nextInBatch) {
+        if (!e->needsPartialUpload)
+            continue;
+        if (!qsg_keepsMergedRange(e) || e->node->geometry()->sizeOfVertex() != vertexSize)
+            return false;
+        e->ensureBoundsValid();
+        if (e->boundsOutsideFloatRange)
+            return false;
+        changedVertexCount += e->mergedRange.vertexCount;
+        // Upper bound: triangle strips get two degenerate indices
+        changedIndexCount += (e->mergedRange.indexCount ? e->mergedRange.indexCount : e->mergedRange.vertexCount) + 2;
+    }
+    if (changedVertexCount == 0)
+        return true;
+    if (changedVertexCount * 2 > b->vertexCount)
+        return false;
+
+    // The pools are not used by full uploads yet, and QRhi copies the data.
+    const quint32 zSize = useDepthBuffer() ? changedVertexCount * sizeof(float) : 0;
+    m_vertexUploadPool.resize(changedVertexCount * vertexSize + zSize);
+    m_indexUploadPool.resize(changedIndexCount * mergedIndexElemSize());
+    char *vertexBase = m_vertexUploadPool.data();
+    char *zData = vertexBase + changedVertexCount * vertexSize;
+    char *indexBase = m_indexUploadPool.data();
+
+    const auto uploadRange = [this](Buffer *buffer, quint32 offset, quint32 size, const char *data) {
+        if (buffer->buf->type() == QRhiBuffer::Dynamic)
+            m_resourceUpdates->updateDynamicBuffer(buffer->buf, offset, size, data);
+        else
+            m_resourceUpdates->uploadStaticBuffer(buffer->buf, offset, size, data);
+        m_frameStatistics.uploadedVertexBytes += size;
+    };
+
+    char *vertexData = vertexBase;
+    char *indexData = indexBase;
+    char *runVertexData = vertexData;
+    char *runIndexData = indexData;
+    const Element *runStart = nullptr;
+    quint32 runEnd = 0;
+    const auto flush = [&]() {
+        if (!runStart)
+            return;
+        uploadRange(&b->vbo, runStart->mergedRange.vertexOffset, vertexData - runVertexData, runVertexData);
+        uploadRange(&b->ibo, runStart->mergedRange.indexOffset, indexData - runIndexData, runIndexData);
+        runStart = nullptr;
+    };
+
+    for (Element *e = b->first; e; e = e->nextInBatch) {
+        if (!e->needsPartialUpload) {
+            flush();
+            continue;
+        }
+        if (runStart && e->mergedRange.vertexOffset != runEnd)
+            flush();
+        if (!runStart) {
+            runStart = e;
+            runVertexData = vertexData;
+            runIndexData = indexData;
+        }
+
+        quint16 iBase16 = quint16(e->mergedRange.indexBase);
+        quint32 iBase32 = e->mergedRange.indexBase;
+        void *iBasePtr = m_uint32IndexForRhi ? static_cast<void *>(&iBase32) : static_cast<void *>(&iBase16);
+        int indexCount = 0;
+        uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, iBasePtr, &indexCount);
+        runEnd = e->mergedRange.vertexOffset + e->mergedRange.vertexCount * vertexSize;
+        e->needsPartialUpload = false;
+    }
+    flush();
+
+    for (Buffer *buffer : { &b->vbo, &b->ibo }) {
+        if (buffer->buf->type() != QRhiBuffer::Dynamic)
+            buffer->nonDynamicChangeCount += 1;
+    }
 
+    if (Q_UNLIKELY(debug_upload()))
+        qDebug() << " - batch" << b << "updated" << changedVertexCount << "of" << b->vertexCount << "vertices in place";
     if (Q_UNLIKELY(debug_render()))
         b->uploadedThisFrame = true;
+    return true;
 }
 
 void Renderer::applyClipStateToGraphicsState()
@@ -2606,6 +3263,16 @@ void Renderer::updateClipState(const QSGClipNode *clipList, Batch *batch)
         batch->stencilClipState.updateStencilBuffer = true;
     }
 
+    // With a partial update only the damaged area is rendered, the rest of
+    // the render target keeps the contents of the previous frame.
+    if (m_damage.partial) {
+        if (clipType & ClipState::ScissorClip)
+            scissorRect &= m_damage.scissorRect;
+        else
+            scissorRect = m_damage.scissorRect;
+        clipType |= ClipState::ScissorClip;
+    }
+
     m_currentClipState.clipList = clipList;
     m_currentClipState.type = clipType;
     m_currentClipState.scissor = QRhiScissor(scissorRect.x(), scissorRect.y(),
@@ -3224,6 +3891,8 @@ bool Renderer::prepareRenderMergedBatch(Batch *batch, PreparedRenderBatch *rende
     Q_ASSERT(sms->materialShader);
     if (m_currentShader != sms)
         setActiveRhiShader(sms->materialShader, sms);
+    if (m_currentMaterial != material)
+        ++m_frameStatistics.materialChangeCount;
 
     m_current_opacity = gn->inheritedOpacity();
     if (!qFuzzyCompare(sms->lastOpacity, float(m_current_opacity))) {
@@ -3402,6 +4071,8 @@ bool Renderer::prepareRenderUnmergedBatch(Batch *batch, PreparedRenderBatch *ren
     Q_ASSERT(sms->materialShader);
     if (m_currentShader != sms)
         setActiveRhiShader(sms->materialShader, sms);
+    if (m_currentMaterial != material)
+        ++m_frameStatistics.materialChangeCount;
 
     m_current_opacity = gn->inheritedOpacity();
     if (sms->lastOpacity != m_current_opacity) {
@@ -3650,6 +4321,252 @@ void Renderer::deleteRemovedElements()
     m_elementsToDelete.reset();
 }
 
+static bool qsg_preservesColorContents(QRhiRenderTarget *rt)
+{
+    if (rt->resourceType() != QRhiResource::TextureRenderTarget)
+        return false;
+    const QRhiTextureRenderTarget::Flags flags = static_cast<QRhiTextureRenderTarget *>(rt)->flags();
+    return flags.testFlag(QRhiTextureRenderTarget::PreserveColorContents)
+            && !flags.testFlag(QRhiTextureRenderTarget::PreserveDepthStencilContents);
+}
+
+/*
+    Returns the area of the render target covered by \a e, in pixels with a
+    top-left origin. The bounds of the element are conservative, so this may
+    be larger than what is actually drawn.
+ */
+QRect Renderer::damageRectForElement(Element *e, const QMatrix4x4 &projection)
+{
+    const QRect targetRect(QPoint(0, 0), deviceRect().size());
+
+    e->ensureBoundsValid();
+    QMatrix4x4 m = projection;
+    if (e->root)
+        m *= qsg_matrixForRoot(e->root);
+    const bool isAffine = qFuzzyIsNull(m(3, 0)) && qFuzzyIsNull(m(3, 1));
+    if (e->boundsOutsideFloatRange || !isAffine)
+        return targetRect;
+
+    const QRectF ndc = m.mapRect(QRectF(QPointF(e->bounds.tl.x, e->bounds.tl.y),
+                                        QPointF(e->bounds.br.x, e->bounds.br.y)));
+    const qreal halfWidth = targetRect.width() * qreal(0.5);
+    const qreal halfHeight = targetRect.height() * qreal(0.5);
+    const QRectF pixels(QPointF((ndc.left() + 1) * halfWidth, (1 - ndc.bottom()) * halfHeight),
+                        QPointF((ndc.right() + 1) * halfWidth, (1 - ndc.top()) * halfHeight));
+    return pixels.toAlignedRect() & targetRect;
+}
+
+void Renderer::collectDamage(Node *node, const QMatrix4x4 &projection, QRegion *damage)
+{
+    if (node->type() == QSGNode::GeometryNodeType) {
+        Element *e = node->element();
+        if (e && !e->removed) {
+            if (e->hasDamageRect)
+                *damage += e->damageRect;
+            e->damageRect = damageRectForElement(e, projection);
+            e->hasDamageRect = true;
+            *damage += e->damageRect;
+        }
+    }
+
+    SHADOWNODE_TRAVERSE(node)
+        collectDamage(child, projection, damage);
+}
+
+/*
+    Computes the damage region of the frame from the nodes changed and the
+    elements removed since the previous frame. The old and the new area of
+    every element below a changed node is damaged.
+
+    When the render pass is started by the renderer into a texture that
+    preserves its contents, the damaged area is cleared and, unless everything
+    is damaged, all batches are scissored to it, which keeps the rest of the
+    previous frame.
+ */
+void Renderer::updateDamage(RenderPassContext *ctx)
+{
+    m_damage.clear = false;
+    m_damage.partial = false;
+    if (!m_damage.enabled)
+        return;
+
+    const QSGRenderTarget &rt(renderTarget());
+    const QRect targetRect(QPoint(0, 0), deviceRect().size());
+    const QMatrix4x4 projection = projectionMatrixWithNativeNDC(0);
+    const QColor clearColor = this->clearColor();
+
+    const bool full = m_damage.full
+            || !m_renderNodeElements.isEmpty()
+            || m_renderMode == QSGRendererInterface::RenderMode3D
+            || rt.multiViewCount > 1
+            || m_visualizer->mode() != Visualizer::VisualizeNothing
+            || rt.rt != m_damage.renderTarget
+            || targetRect.size() != m_damage.targetSize
+            || viewportRect() != m_damage.viewport
+            || projection != m_damage.projection
+            || clearColor != m_damage.clearColor;
+
+    if (full) {
+        // Every element has to know its area for the next partial update
+        for (int i = 0; i < m_opaqueRenderList.size(); ++i) {
+            Element *e = m_opaqueRenderList.at(i);
+            if (e && !e->removed) {
+                e->damageRect = damageRectForElement(e, projection);
+                e->hasDamageRect = true;
+            }
+        }
+        for (int i = 0; i < m_alphaRenderList.size(); ++i) {
+            Element *e = m_alphaRenderList.at(i);
+            if (e && !e->removed && !e->isRenderNode) {
+                e->damageRect = damageRectForElement(e, projection);
+                e->hasDamageRect = true;
+            }
+        }
+        m_damageRegion = targetRect;
+    } else {
+        QRegion damage = m_damage.removed;
+        for (QSGNode *node : std::as_const(m_damage.nodes)) {
+            if (Node *shadowNode = m_nodes.value(node))
+                collectDamage(shadowNode, projection, &damage);
+        }
+        m_damageRegion = damage & targetRect;
+    }
+
+    m_damage.full = false;
+    m_damage.nodes.clear();
+    m_damage.removed = QRegion();
+    m_damage.renderTarget = rt.rt;
+    m_damage.targetSize = targetRect.size();
+    m_damage.viewport = viewportRect();
+    m_damage.projection = projection;
+    m_damage.clearColor = clearColor;
+
+    if (Q_UNLIKELY(debug_render()))
+        qDebug() << " -> Damage:" << (full ? "full" : "partial") << m_damageRegion;
+
+    if (!ctx->beginsRenderPass || !qsg_preservesColorContents(rt.rt))
+        return;
+
+    m_damage.partial = !full;
+    if (m_damageRegion.isEmpty())
+        return;
+
+    // The scissor covers the bounding rectangle of the damage, flipped to a
+    // bottom-left origin.
+    const QRect bounds = m_damageRegion.boundingRect();
+    m_damage.scissorRect = QRect(bounds.x(), targetRect.height() - bounds.y() - bounds.height(),
+                                 bounds.width(), bounds.height());
+    m_damage.clear = prepareDamageClear(clearColor);
+    if (!m_damage.clear && m_damage.partial) {
+        // Render everything like without damage tracking
+        m_damage.partial = false;
+        m_damageRegion = targetRect;
+    }
+}
+
+/*
+    Creates the resources for drawing the clear color over the damaged area,
+    which the beginning of the render pass does not clear as the render target
+    preserves its contents. Returns false if they could not be created.
+ */
+bool Renderer::prepareDamageClear(const QColor &clearColor)
+{
+    QRhiRenderPassDescriptor *rpDesc = renderTarget().rpDesc;
+    const int sampleCount = renderTarget().rt->sampleCount();
+    if (m_damage.ps && (m_damage.ps->sampleCount() != sampleCount
+                        || m_damage.psFormat != rpDesc->serializedFormat())) {
+        delete m_damage.ps;
+        m_damage.ps = nullptr;
+    }
+
+    if (!m_damage.vbuf) {
+        float v[] = { -1, 1,   1, 1,   -1, -1,   1, -1 };
+        m_damage.vbuf = m_rhi->newBuffer(QRhiBuffer::Immutable, QRhiBuffer::VertexBuffer, sizeof(v));
+        if (!m_damage.vbuf->create()) {
+            delete m_damage.vbuf;
+            m_damage.vbuf = nullptr;
+            return false;
+        }
+        m_resourceUpdates->uploadStaticBuffer(m_damage.vbuf, v);
+    }
+
+    // The shaders of the visualizer draw the quad in a solid color
+    if (!m_damage.ubuf) {
+        m_damage.ubuf = m_rhi->newBuffer(QRhiBuffer::Dynamic, QRhiBuffer::UniformBuffer,
+                                         RhiVisualizer::DrawCall::UBUF_SIZE);
+        if (!m_damage.ubuf->create()) {
+            delete m_damage.ubuf;
+            m_damage.ubuf = nullptr;
+            return false;
+        }
+        QMatrix4x4 ident;
+        m_resourceUpdates->updateDynamicBuffer(m_damage.ubuf, 0, 64, ident.constData()); // matrix
+        m_resourceUpdates->updateDynamicBuffer(m_damage.ubuf, 64, 64, ident.constData()); // rotation
+        float pattern = 0.0f;
+        m_resourceUpdates->updateDynamicBuffer(m_damage.ubuf, 144, 4, &pattern);
+        qint32 projection = 0;
+        m_resourceUpdates->updateDynamicBuffer(m_damage.ubuf, 148, 4, &projection);
+    }
+    const float color[4] = { float(clearColor.redF()), float(clearColor.greenF()),
+                             float(clearColor.blueF()), float(clearColor.alphaF()) };
+    m_resourceUpdates->updateDynamicBuffer(m_damage.ubuf, 128, 16, color);
+
+    if (!m_damage.srb) {
+        m_damage.srb = m_rhi->newShaderResourceBindings();
+        m_damage.srb->setBindings({ QRhiShaderResourceBinding::uniformBuffer(0,
+                                            QRhiShaderResourceBinding::VertexStage | QRhiShaderResourceBinding::FragmentStage,
+                                            m_damage.ubuf) });
+        if (!m_damage.srb->create()) {
+            delete m_damage.srb;
+            m_damage.srb = nullptr;
+            return false;
+        }
+    }
+
+    if (!m_damage.ps) {
+        if (!m_damage.vs.isValid())
+            m_damage.vs = QSGMaterialShaderPrivate::loadShader(QLatin1String(":/qt-project.org/scenegraph/shaders_ng/visualization.vert.qsb"));
+        if (!m_damage.fs.isValid())
+            m_damage.fs = QSGMaterialShaderPrivate::loadShader(QLatin1String(":/qt-project.org/scenegraph/shaders_ng/visualization.frag.qsb"));
+
+        m_damage.ps = m_rhi->newGraphicsPipeline();
+        m_damage.ps->setFlags(QRhiGraphicsPipeline::UsesScissor);
+        m_damage.ps->setTopology(QRhiGraphicsPipeline::TriangleStrip);
+        m_damage.ps->setShaderStages({ QRhiShaderStage(QRhiShaderStage::Vertex, m_damage.vs),
+                                       QRhiShaderStage(QRhiShaderStage::Fragment, m_damage.fs) });
+        QRhiVertexInputLayout inputLayout;
+        inputLayout.setBindings({ QRhiVertexInputBinding(2 * sizeof(float)) });
+        inputLayout.setAttributes({ QRhiVertexInputAttribute(0, 0, QRhiVertexInputAttribute::Float2, 0) });
+        m_damage.ps->setVertexInputLayout(inputLayout);
+        m_damage.ps->setSampleCount(sampleCount);
+        m_damage.ps->setShaderResourceBindings(m_damage.srb);
+        m_damage.ps->setRenderPassDescriptor(rpDesc);
+        if (!m_damage.ps->create()) {
+            delete m_damage.ps;
+            m_damage.ps = nullptr;
+            return false;
+        }
+        m_damage.psFormat = rpDesc->serializedFormat();
+    }
+
+    return true;
+}
+
+void Renderer::renderDamageClear()
+{
+    QRhiCommandBuffer *cb = renderTarget().cb;
+    cb->setGraphicsPipeline(m_damage.ps);
+    cb->setViewport(m_pstate.viewport);
+    cb->setScissor(QRhiScissor(m_damage.scissorRect.x(), m_damage.scissorRect.y(),
+                               m_damage.scissorRect.width(), m_damage.scissorRect.height()));
+    m_pstate.viewportSet = true;
+    m_pstate.scissorSet = true;
+    cb->setShaderResources();
+    const QRhiCommandBuffer::VertexInput vbufBinding(m_damage.vbuf, 0);
+    cb->setVertexInput(0, 1, &vbufBinding);
+    cb->draw(4);
+}
+
 void Renderer::render()
 {
     // Gracefully handle the lack of a render target - some autotests may rely
@@ -3657,7 +4574,11 @@ void Renderer::render()
     if (!renderTarget().rt)
         return;
 
+    QElapsedTimer prepareTimer;
+    prepareTimer.start();
+    m_mainRenderPassContext.beginsRenderPass = true;
     prepareRenderPass(&m_mainRenderPassContext);
+    m_frameStatistics.prepareTime += prepareTimer.nsecsElapsed();
     beginRenderPass(&m_mainRenderPassContext);
     recordRenderPass(&m_mainRenderPassContext);
     endRenderPass(&m_mainRenderPassContext);
@@ -3671,7 +4592,11 @@ void Renderer::render()
 
 void Renderer::prepareInline()
 {
+    QElapsedTimer prepareTimer;
+    prepareTimer.start();
+    m_mainRenderPassContext.beginsRenderPass = false;
     prepareRenderPass(&m_mainRenderPassContext);
+    m_frameStatistics.prepareTime += prepareTimer.nsecsElapsed();
 }
 
 void Renderer::renderInline()
@@ -3719,12 +4644,21 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
 
     m_resourceUpdates = m_rhi->nextResourceUpdateBatch();
 
+    ++m_rebuildStats.frames;
+    m_rebuildStats.retainedBatches = 0;
+    m_rebuildStats.splicedElements = 0;
+    m_rebuildStats.invalidatedBatches = 0;
+    m_rebuildStats.createdBatches = 0;
+
     if (m_rebuild & (BuildRenderLists | BuildRenderListsForTaggedRoots)) {
         bool complete = (m_rebuild & BuildRenderLists) != 0;
-        if (complete)
+        if (complete) {
             buildRenderListsFromScratch();
-        else
+            ++m_rebuildStats.fullRebuilds;
+        } else {
             buildRenderListsForTaggedRoots();
+            ++m_rebuildStats.partialRebuilds;
+        }
         m_rebuild |= BuildBatches;
 
         if (Q_UNLIKELY(debug_build())) {
@@ -3740,6 +4674,9 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
             }
         }
     }
+    updateOcclusion();
+    m_frameStatistics.culledNodeCount = m_culledElementCount;
+
     if (Q_UNLIKELY(debug_render())) ctx->timeRenderLists = ctx->timer.restart();
 
     for (int i=0; i<m_opaqueBatches.size(); ++i)
@@ -3752,6 +4689,8 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     cleanupBatches(&m_alphaBatches);
 
     if (m_rebuild & BuildBatches) {
+        if (!(m_rebuild & (BuildRenderLists | BuildRenderListsForTaggedRoots)))
+            ++m_rebuildStats.batchRebuilds;
         prepareOpaqueBatches();
         if (Q_UNLIKELY(debug_render())) ctx->timePrepareOpaque = ctx->timer.restart();
         prepareAlphaBatches();
@@ -3805,23 +4744,26 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     m_indexUploadPool.reset();
 
     if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Opaque Batches:");
-    for (int i=0; i<m_opaqueBatches.size(); ++i) {
-        Batch *b = m_opaqueBatches.at(i);
-        uploadBatch(b);
-    }
+    uploadBatches(m_opaqueBatches);
     if (Q_UNLIKELY(debug_render())) ctx->timeUploadOpaque = ctx->timer.restart();
 
     if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
-    for (int i=0; i<m_alphaBatches.size(); ++i) {
-        Batch *b = m_alphaBatches.at(i);
-        uploadBatch(b);
-    }
+    uploadBatches(m_alphaBatches);
     if (Q_UNLIKELY(debug_render())) ctx->timeUploadAlpha = ctx->timer.restart();
 
     if (Q_UNLIKELY(debug_render())) {
         qDebug().nospace() << "Rendering:" << Qt::endl
                            << " -> Opaque: " << qsg_countNodesInBatches(m_opaqueBatches) << " nodes in " << m_opaqueBatches.size() << " batches..." << Qt::endl
-                           << " -> Alpha: " << qsg_countNodesInBatches(m_alphaBatches) << " nodes in " << m_alphaBatches.size() << " batches...";
+                           << " -> Alpha: " << qsg_countNodesInBatches(m_alphaBatches) << " nodes in " << m_alphaBatches.size() << " batches..." << Qt::endl
+                           << " -> Culled: " << m_culledElementCount << " nodes" << Qt::endl
+                           << " -> Batches: " << m_rebuildStats.createdBatches << " created, "
+                           << m_rebuildStats.retainedBatches << " retained, "
+                           << m_rebuildStats.invalidatedBatches << " invalidated, "
+                           << m_rebuildStats.splicedElements << " elements spliced" << Qt::endl
+                           << " -> Rebuilds in " << m_rebuildStats.frames << " frames: "
+                           << m_rebuildStats.fullRebuilds << " full, "
+                           << m_rebuildStats.partialRebuilds << " partial, "
+                           << m_rebuildStats.batchRebuilds << " batches only";
     }
 
     m_current_opacity = 1;
@@ -3830,10 +4772,19 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     m_currentProgram = nullptr;
     m_currentClipState.reset();
 
+    updateDamage(ctx);
+    if (m_damage.partial) {
+        m_currentClipState.type = ClipState::ScissorClip;
+        m_currentClipState.scissor = QRhiScissor(m_damage.scissorRect.x(), m_damage.scissorRect.y(),
+                                                 m_damage.scissorRect.width(), m_damage.scissorRect.height());
+    }
+
     const QRect viewport = viewportRect();
 
-    bool renderOpaque = !debug_noopaque();
-    bool renderAlpha = !debug_noalpha();
+    // Nothing changed since the previous frame, which the render target still holds
+    const bool skipBatches = m_damage.partial && m_damageRegion.isEmpty();
+    bool renderOpaque = !debug_noopaque() && !skipBatches;
+    bool renderAlpha = !debug_noalpha() && !skipBatches;
 
     m_pstate.viewport =
             QRhiViewport(viewport.x(), deviceRect().bottom() - viewport.bottom(), viewport.width(),
@@ -3870,8 +4821,13 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
                 ok = prepareRenderMergedBatch(b, &renderBatch);
             else
                 ok = prepareRenderUnmergedBatch(b, &renderBatch);
-            if (ok)
+            if (ok) {
                 ctx->opaqueRenderBatches.append(renderBatch);
+                if (b->merged)
+                    ++m_frameStatistics.mergedBatchCount;
+                else
+                    ++m_frameStatistics.unmergedBatchCount;
+            }
         }
     }
 
@@ -3902,10 +4858,16 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
                 ok = prepareRhiRenderNode(b, &renderBatch);
             else
                 ok = prepareRenderUnmergedBatch(b, &renderBatch);
-            if (ok)
+            if (ok) {
                 ctx->alphaRenderBatches.append(renderBatch);
+                if (b->merged)
+                    ++m_frameStatistics.mergedBatchCount;
+                else if (!b->isRenderNode)
+                    ++m_frameStatistics.unmergedBatchCount;
+            }
         }
     }
+    m_frameStatistics.batchCount = ctx->opaqueRenderBatches.size() + ctx->alphaRenderBatches.size();
 
     m_rebuild = 0;
 
@@ -3958,6 +4920,11 @@ void Renderer::recordRenderPass(RenderPassContext *ctx)
     QRhiCommandBuffer *cb = renderTarget().cb;
     cb->debugMarkBegin(QByteArrayLiteral("Qt Quick scene render"));
 
+    if (m_damage.clear) {
+        cb->debugMarkMsg(QByteArrayLiteral("Qt Quick damage clear"));
+        renderDamageClear();
+    }
+
     for (int i = 0, ie = ctx->opaqueRenderBatches.size(); i != ie; ++i) {
         if (i == 0)
             cb->debugMarkMsg(QByteArrayLiteral("Qt Quick opaque batches"));
@@ -30,8 +30,12 @@
 
 #include <rhi/qrhi.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
+class QThreadPool;
+
 namespace QSGBatchRenderer
 {
 
@@ -277,6 +281,9 @@ struct Element {
         , orphaned(false)
         , isRenderNode(false)
         , isMaterialBlended(false)
+        , hasDamageRect(false)
+        , culled(false)
+        , needsPartialUpload(false)
     {
     }
 
@@ -297,6 +304,18 @@ struct Element {
     Node *root = nullptr;
 
     Rect bounds; // in device coordinates
+    QRect damageRect; // area covered on the render target in the last frame, only with damage tracking
+
+    // Where the data of the element went in the last upload of its merged
+    // batch, so that it can be replaced without uploading the whole batch.
+    struct MergedRange {
+        quint32 vertexOffset = 0;
+        quint32 indexOffset = 0;
+        quint32 indexBase = 0;
+        int vertexCount = 0;
+        int indexCount = 0;
+        int drawingMode = 0;
+    } mergedRange;
 
     int order = 0;
     QRhiShaderResourceBindings *srb = nullptr;
@@ -310,6 +329,9 @@ struct Element {
     uint orphaned : 1;
     uint isRenderNode : 1;
     uint isMaterialBlended : 1;
+    uint hasDamageRect : 1;
+    uint culled : 1;
+    uint needsPartialUpload : 1;
 };
 
 struct RenderNodeElement : public Element {
@@ -404,6 +426,7 @@ struct Batch
 {
     Batch() : drawSets(1) {}
     bool geometryWasChanged(QSGGeometryNode *gn);
+    bool hasCompatibleGeometry(QSGGeometryNode *gn) const;
     BatchCompatibility isMaterialCompatible(Element *e) const;
     void invalidate();
     void cleanupRemovedElements();
@@ -420,6 +443,7 @@ struct Batch
         indexCount = 0;
         isOpaque = false;
         needsUpload = false;
+        needsPartialUpload = false;
         merged = false;
         positionAttribute = -1;
         uploadedThisFrame = false;
@@ -442,6 +466,7 @@ struct Batch
 
     uint isOpaque : 1;
     uint needsUpload : 1;
+    uint needsPartialUpload : 1;
     uint merged : 1;
     uint isRenderNode : 1;
     uint ubufDataValid : 1;
@@ -749,6 +774,18 @@ public:
     Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMode renderMode = QSGRendererInterface::RenderMode2D);
     ~Renderer();
 
+    // For autotests
+    struct BatchSnapshot {
+        bool isOpaque = false;
+        bool merged = false;
+        int vertexCount = 0;
+        int indexCount = 0;
+        QList<QSGGeometryNode *> nodes; // in render order
+    };
+    QList<BatchSnapshot> batchSnapshot() const;
+    int fullRebuildCount() const { return m_rebuildStats.fullRebuilds; }
+    int partialRebuildCount() const { return m_rebuildStats.partialRebuilds; }
+
 protected:
     void nodeChanged(QSGNode *node, QSGNode::DirtyState state) override;
     void render() override;
@@ -763,6 +800,7 @@ protected:
 
     struct RenderPassContext {
         bool valid = false;
+        bool beginsRenderPass = false;
         QVarLengthArray<PreparedRenderBatch, 64> opaqueRenderBatches;
         QVarLengthArray<PreparedRenderBatch, 64> alphaRenderBatches;
         QElapsedTimer timer;
@@ -797,11 +835,13 @@ private:
     friend class RhiVisualizer;
 
     void destroyGraphicsResources();
-    void map(Buffer *buffer, quint32 byteSize, bool isIndexBuf = false);
+    void map(Buffer *buffer, quint32 byteSize, bool isIndexBuf = false, quint32 poolOffset = 0);
     void unmap(Buffer *buffer, bool isIndexBuf = false);
 
     void buildRenderListsFromScratch();
     void buildRenderListsForTaggedRoots();
+    void retainBatchesOfTaggedRoots();
+    bool spliceIntoOpaqueBatch(Element *e);
     void tagSubRoots(Node *node);
     void buildRenderLists(QSGNode *node);
 
@@ -811,8 +851,25 @@ private:
     bool checkOverlap(int first, int last, const Rect &bounds);
     void prepareAlphaBatches();
     void invalidateBatchAndOverlappingRenderOrders(Batch *batch);
+    void updateOcclusion();
+
+    void updateDamage(RenderPassContext *ctx);
+    void collectDamage(Node *node, const QMatrix4x4 &projection, QRegion *damage);
+    QRect damageRectForElement(Element *e, const QMatrix4x4 &projection);
+    bool prepareDamageClear(const QColor &clearColor);
+    void renderDamageClear();
+
+    struct BatchUpload {
+        Batch *batch;
+        quint32 vertexBufferSize;
+        quint32 indexBufferSize;
+    };
 
-    void uploadBatch(Batch *b);
+    void uploadBatches(const QDataBuffer<Batch *> &batches);
+    bool prepareBatchUpload(Batch *b, BatchUpload *upload);
+    void fillBatchBuffers(Batch *b);
+    bool uploadChangedElements(Batch *b);
+    void finishBatchUpload(Batch *b);
     void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount);
 
     bool ensurePipelineState(Element *e, const ShaderManager::Shader *sms, bool depthPostPass = false);
@@ -886,6 +943,19 @@ private:
 
     uint m_rebuild;
     qreal m_zRange;
+
+    struct RebuildStatistics {
+        // Accumulated since the renderer was created
+        int frames = 0;
+        int fullRebuilds = 0;
+        int partialRebuilds = 0;
+        int batchRebuilds = 0;
+        // Reset every frame
+        int retainedBatches = 0;
+        int splicedElements = 0;
+        int invalidatedBatches = 0;
+        int createdBatches = 0;
+    } m_rebuildStats;
 #if defined(QSGBATCHRENDERER_INVALIDATE_WEDGED_NODES)
     int m_renderOrderRebuildLower;
     int m_renderOrderRebuildUpper;
@@ -895,6 +965,11 @@ private:
     int m_batchVertexThreshold;
     int m_srbPoolThreshold;
     int m_bufferPoolSizeLimit;
+    int m_uploadThreadCount;
+    int m_uploadVertexThreshold;
+    int m_occluderLimit;
+    int m_culledElementCount = 0;
+    bool m_occlusionDirty = true;
 
     Visualizer *m_visualizer;
 
@@ -906,6 +981,8 @@ private:
 
     QDataBuffer<char> m_vertexUploadPool;
     QDataBuffer<char> m_indexUploadPool;
+    QDataBuffer<BatchUpload> m_batchUploads;
+    std::unique_ptr<QThreadPool> m_uploadThreadPool;
 
     Allocator<Node, 256> m_nodeAllocator;
     Allocator<Element, 64> m_elementAllocator;
@@ -930,6 +1007,33 @@ private:
         inline void reset();
     } m_stencilClipCommon;
 
+    struct DamageTrackingData {
+        bool enabled = false;
+        // Collected between frames
+        bool full = true;
+        QSet<QSGNode *> nodes;
+        QRegion removed;
+        // State of the previous frame, a change of these damages everything
+        QRhiRenderTarget *renderTarget = nullptr;
+        QSize targetSize;
+        QRect viewport;
+        QMatrix4x4 projection;
+        QColor clearColor;
+        // Set for the frame being prepared
+        bool clear = false;
+        bool partial = false;
+        QRect scissorRect; // bottom-left origin, like the clip scissors
+        // Resources for clearing the damaged area
+        QRhiBuffer *vbuf = nullptr;
+        QRhiBuffer *ubuf = nullptr;
+        QRhiShaderResourceBindings *srb = nullptr;
+        QRhiGraphicsPipeline *ps = nullptr;
+        QVector<quint32> psFormat;
+        QShader vs;
+        QShader fs;
+        inline void releaseResources();
+    } m_damage;
+
     inline int mergedIndexElemSize() const;
     inline bool useDepthBuffer() const;
     inline void setStateForDepthPostPass();
@@ -991,6 +1095,25 @@ void Renderer::StencilClipCommonData::reset()
     fs = QShader();
 }
 
+void Renderer::DamageTrackingData::releaseResources()
+{
+    delete ps;
+    ps = nullptr;
+
+    delete srb;
+    srb = nullptr;
+
+    delete ubuf;
+    ubuf = nullptr;
+
+    delete vbuf;
+    vbuf = nullptr;
+
+    psFormat.clear();
+    vs = QShader();
+    fs = QShader();
+}
+
 void ClipState::reset()
 {
     clipList = nullptr;
@@ -139,7 +139,12 @@ void QSGRenderer::renderScene()
 
     qint64 renderTime = 0;
 
+    m_frameStatistics = {};
+    m_damageRegion = QRect(QPoint(0, 0), deviceRect().size());
+    QElapsedTimer prepareTimer;
+    prepareTimer.start();
     preprocess();
+    m_frameStatistics.prepareTime = prepareTimer.nsecsElapsed();
 
     Q_TRACE(QSG_render_entry);
     render();
@@ -168,7 +173,12 @@ void QSGRenderer::prepareSceneInline()
     Q_ASSERT(!m_is_rendering);
     m_is_rendering = true;
 
+    m_frameStatistics = {};
+    m_damageRegion = QRect(QPoint(0, 0), deviceRect().size());
+    QElapsedTimer prepareTimer;
+    prepareTimer.start();
     preprocess();
+    m_frameStatistics.prepareTime = prepareTimer.nsecsElapsed();
 
     prepareInline();
 }
@@ -21,6 +21,8 @@
 
 #include <QtQuick/private/qsgcontext_p.h>
 
+#include <QtGui/qregion.h>
+
 QT_BEGIN_NAMESPACE
 
 class QSGNodeUpdater;
@@ -94,6 +96,22 @@ public:
     void setRenderTarget(const QSGRenderTarget &rt) { m_rt = rt; }
     const QSGRenderTarget &renderTarget() const { return m_rt; }
 
+    struct FrameStatistics {
+        qint64 prepareTime = 0;
+        int batchCount = 0;
+        int mergedBatchCount = 0;
+        int unmergedBatchCount = 0;
+        qint64 uploadedVertexBytes = 0;
+        int materialChangeCount = 0;
+        int culledNodeCount = 0;
+    };
+    // Statistics of the last frame rendered, see QQuickWindow::frameStatistics()
+    const FrameStatistics &frameStatistics() const { return m_frameStatistics; }
+
+    // Area of the render target changed by the last frame, in pixels with a
+    // top-left origin, see QQuickRenderControl::damageRegion()
+    const QRegion &damageRegion() const { return m_damageRegion; }
+
     void setRenderPassRecordingCallbacks(QSGRenderContext::RenderPassCallback start,
                                          QSGRenderContext::RenderPassCallback end,
                                          void *userData)
@@ -132,6 +150,8 @@ protected:
         QSGRenderContext::RenderPassCallback end = nullptr;
         void *userData = nullptr;
     } m_renderPassRecordingCallbacks;
+    FrameStatistics m_frameStatistics;
+    QRegion m_damageRegion;
 
 private:
     QSGNodeUpdater *m_node_updater;
@@ -616,6 +616,18 @@ void QSGTexturePrivate::resetDirtySamplerOptions()
     wrapChanged = filteringChanged = anisotropyChanged = false;
 }
 
+Q_CONSTINIT static thread_local quint64 qsg_textureUploadCount = 0;
+
+void QSGTexturePrivate::countUpload()
+{
+    ++qsg_textureUploadCount;
+}
+
+quint64 QSGTexturePrivate::uploadCount()
+{
+    return qsg_textureUploadCount;
+}
+
 /*!
     \class QSGDynamicTexture
     \brief The QSGDynamicTexture class serves as a baseclass for dynamically changing textures,
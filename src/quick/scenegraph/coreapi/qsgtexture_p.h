@@ -101,6 +101,11 @@ public:
     void resetDirtySamplerOptions();
     bool hasDirtySamplerOptions() const;
 
+    // Counts the texture uploads enqueued on the current thread, sampled
+    // around each frame for QQuickWindow::frameStatistics()
+    static void countUpload();
+    static quint64 uploadCount();
+
     uint wrapChanged : 1;
     uint filteringChanged : 1;
     uint anisotropyChanged : 1;
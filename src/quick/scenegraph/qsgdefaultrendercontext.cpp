@@ -186,6 +186,9 @@ void QSGDefaultRenderContext::endNextFrame(QSGRenderer *renderer)
     Q_UNUSED(renderer);
     m_currentFrameCommandBuffer = nullptr;
     m_currentFrameRenderPass = nullptr;
+    ++m_frameCount;
+    if (m_rhiAtlasManager)
+        m_rhiAtlasManager->endFrame();
 }
 
 QSGTexture *QSGDefaultRenderContext::createTexture(const QImage &image, uint flags) const
@@ -91,6 +91,8 @@ public:
         return m_currentFrameRenderPass;
     }
 
+    quint64 frameCount() const { return m_frameCount; }
+
     qreal currentDevicePixelRatio() const
     {
         // Valid starting from QQuickWindow::syncSceneGraph(). This takes the
@@ -114,6 +116,7 @@ protected:
     QSGRhiAtlasTexture::Manager *m_rhiAtlasManager;
     QRhiCommandBuffer *m_currentFrameCommandBuffer;
     QRhiRenderPassDescriptor *m_currentFrameRenderPass;
+    quint64 m_frameCount = 0;
     qreal m_currentDevicePixelRatio;
     bool m_useDepthBufferFor2D;
     QRhiResourceUpdateBatch *m_glyphCacheResourceUpdates;
@@ -607,8 +607,7 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     QElapsedTimer renderTimer;
     qint64 renderTime = 0, syncTime = 0, polishTime = 0;
     const bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
-    if (profileFrames)
-        renderTimer.start();
+    renderTimer.start();
     Q_TRACE(QSG_polishItems_entry);
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphPolishFrame);
 
@@ -616,8 +615,7 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     cd->polishItems();
     m_inPolish = false;
 
-    if (profileFrames)
-        polishTime = renderTimer.nsecsElapsed();
+    polishTime = renderTimer.nsecsElapsed();
 
     Q_TRACE(QSG_polishItems_exit);
     Q_QUICK_SG_PROFILE_SWITCH(QQuickProfiler::SceneGraphPolishFrame,
@@ -692,8 +690,7 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     if (lastDirtyWindow)
         data.rc->endSync();
 
-    if (profileFrames)
-        syncTime = renderTimer.nsecsElapsed();
+    syncTime = renderTimer.nsecsElapsed();
 
     Q_TRACE(QSG_sync_exit);
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
@@ -702,8 +699,7 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
 
     cd->renderSceneGraph();
 
-    if (profileFrames)
-        renderTime = renderTimer.nsecsElapsed();
+    renderTime = renderTimer.nsecsElapsed();
     Q_TRACE(QSG_render_exit);
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphRenderLoopRender);
@@ -730,9 +726,9 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
 
     emit window->afterFrameEnd();
 
-    qint64 swapTime = 0;
-    if (profileFrames)
-        swapTime = renderTimer.nsecsElapsed();
+    const qint64 swapTime = renderTimer.nsecsElapsed();
+    cd->recordPolishTimes(polishTime, 0);
+    cd->recordSyncAndSwapTimes(syncTime - polishTime, swapTime - renderTime);
 
     Q_TRACE(QSG_swap_exit);
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphRenderLoopFrame,
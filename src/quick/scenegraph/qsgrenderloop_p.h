@@ -120,6 +120,10 @@ WM_PostJob           = QEvent::User + 6,
 // the event filter installed on the QQuickWindow.
 WM_ReleaseSwapchain  = QEvent::User + 7,
 
+// Passed from the RT to the RL when a sync that was deferred while the RT
+// was rendering can proceed.
+WM_ReadyForSync      = QEvent::User + 8,
+
 };
 
 QT_END_NAMESPACE
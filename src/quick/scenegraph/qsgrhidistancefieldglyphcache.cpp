@@ -4,6 +4,7 @@
 #include "qsgrhidistancefieldglyphcache_p.h"
 #include "qsgcontext_p.h"
 #include "qsgdefaultrendercontext_p.h"
+#include <private/qsgtexture_p.h>
 #include <QtGui/private/qdistancefield_p.h>
 #include <QtCore/qelapsedtimer.h>
 #include <QtQml/private/qqmlglobal_p.h>
@@ -152,6 +153,7 @@ void QSGRhiDistanceFieldGlyphCache::storeGlyphs(const QList<QDistanceField> &gly
         if (!texInfo->uploads.isEmpty()) {
             QRhiTextureUploadDescription desc;
             desc.setEntries(texInfo->uploads.cbegin(), texInfo->uploads.cend());
+            QSGTexturePrivate::countUpload();
             resourceUpdates->uploadTexture(texInfo->texture, desc);
             texInfo->uploads.clear();
         }
@@ -200,6 +202,7 @@ void QSGRhiDistanceFieldGlyphCache::createTexture(TextureInfo *texInfo,
         QRhiResourceUpdateBatch *resourceUpdates = m_rc->glyphCacheResourceUpdates();
         QRhiTextureSubresourceUploadDescription subresDesc(pixels, width * height);
         subresDesc.setSourceSize(QSize(width, height));
+        QSGTexturePrivate::countUpload();
         resourceUpdates->uploadTexture(texInfo->texture, QRhiTextureUploadEntry(0, 0, subresDesc));
     } else {
         qWarning("Failed to create distance field glyph cache");
@@ -228,6 +231,7 @@ void QSGRhiDistanceFieldGlyphCache::resizeTexture(TextureInfo *texInfo, int widt
         QRhiTextureSubresourceUploadDescription subresDesc(texInfo->image.constBits(),
                                                            oldWidth * oldHeight);
         subresDesc.setSourceSize(QSize(oldWidth, oldHeight));
+        QSGTexturePrivate::countUpload();
         resourceUpdates->uploadTexture(texInfo->texture, QRhiTextureUploadEntry(0, 0, subresDesc));
         texInfo->image = texInfo->image.copy(0, 0, width, height);
     } else {
@@ -3,6 +3,7 @@
 
 #include "qsgrhitextureglyphcache_p.h"
 #include "qsgdefaultrendercontext_p.h"
+#include <private/qsgtexture_p.h>
 #include <qrgb.h>
 #include <private/qdrawhelper_p.h>
 
@@ -45,6 +46,7 @@ QRhiTexture *QSGRhiTextureGlyphCache::createEmptyTexture(QRhiTexture::Format for
         data.fill(0, m_size.width() * m_size.height() * 4);
     QRhiTextureSubresourceUploadDescription subresDesc(data.constData(), data.size());
     subresDesc.setSourceSize(m_size);
+    QSGTexturePrivate::countUpload();
     resourceUpdates->uploadTexture(t, QRhiTextureUploadEntry(0, 0, subresDesc));
 
     return t;
@@ -86,6 +88,7 @@ void QSGRhiTextureGlyphCache::resizeTextureData(int width, int height)
             QRhiTextureSubresourceUploadDescription subresDesc(img);
             const QSize oldSize = m_texture->pixelSize();
             subresDesc.setSourceSize(QSize(qMin(oldSize.width(), width), qMin(oldSize.height(), height)));
+            QSGTexturePrivate::countUpload();
             resourceUpdates->uploadTexture(t, QRhiTextureUploadEntry(0, 0, subresDesc));
         }
 
@@ -189,6 +192,7 @@ void QSGRhiTextureGlyphCache::endFillTexture()
     QRhiResourceUpdateBatch *resourceUpdates = m_rc->glyphCacheResourceUpdates();
     QRhiTextureUploadDescription desc;
     desc.setEntries(m_uploads.cbegin(), m_uploads.cend());
+    QSGTexturePrivate::countUpload();
     resourceUpdates->uploadTexture(m_texture, desc);
     m_uploads.clear();
 }
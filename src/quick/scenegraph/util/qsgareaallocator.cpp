@@ -89,6 +89,7 @@ bool QSGAreaAllocator::allocateInNode(const QSize &size, QPoint &result, const Q
         if (size.width() + maxMargin >= currentRect.width() && size.height() + maxMargin >= currentRect.height()) {
             //Snug fit, occupy entire rectangle.
             node->isOccupied = true;
+            m_usedArea += currentRect.width() * currentRect.height();
             result = currentRect.topLeft();
             return true;
         }
@@ -129,14 +130,28 @@ bool QSGAreaAllocator::allocateInNode(const QSize &size, QPoint &result, const Q
 
 bool QSGAreaAllocator::deallocateInNode(const QPoint &pos, QSGAreaAllocatorNode *node)
 {
+    QRect currentRect(QPoint(0, 0), m_size);
     while (!node->isLeaf()) {
         //  has been split.
         int cmp = node->splitType == HorizontalSplit ? pos.y() : pos.x();
-        node = cmp < node->split ? node->left : node->right;
+        const bool left = cmp < node->split;
+        if (node->splitType == HorizontalSplit) {
+            if (left)
+                currentRect.setBottom(node->split - 1);
+            else
+                currentRect.setTop(node->split);
+        } else {
+            if (left)
+                currentRect.setRight(node->split - 1);
+            else
+                currentRect.setLeft(node->split);
+        }
+        node = left ? node->left : node->right;
     }
     if (!node->isOccupied)
         return false;
     node->isOccupied = false;
+    m_usedArea -= currentRect.width() * currentRect.height();
     mergeNodeWithNeighbors(node);
     return true;
 }
@@ -250,6 +265,83 @@ void QSGAreaAllocator::mergeNodeWithNeighbors(QSGAreaAllocatorNode *node)
     } // end while(!done)
 }
 
+namespace {
+    struct AreaAllocatorVisit
+    {
+        QSGAreaAllocatorNode *node;
+        QRect rect;
+    };
+
+    // Calls f(rect, isOccupied) for every leaf of the tree below root.
+    template <typename F>
+    void forEachLeaf(QSGAreaAllocatorNode *root, const QSize &size, F f)
+    {
+        QStack<AreaAllocatorVisit> nodes;
+        nodes.push({ root, QRect(QPoint(0, 0), size) });
+        while (!nodes.isEmpty()) {
+            const AreaAllocatorVisit visit = nodes.pop();
+            QSGAreaAllocatorNode *node = visit.node;
+            if (!node->left) {
+                f(visit.rect, node->isOccupied);
+                continue;
+            }
+            QRect leftRect = visit.rect;
+            QRect rightRect = visit.rect;
+            if (node->splitType == HorizontalSplit) {
+                leftRect.setHeight(node->split - leftRect.top());
+                rightRect.setTop(node->split);
+            } else {
+                leftRect.setWidth(node->split - leftRect.left());
+                rightRect.setLeft(node->split);
+            }
+            nodes.push({ node->left, leftRect });
+            nodes.push({ node->right, rightRect });
+        }
+    }
+}
+
+/*!
+    \internal
+
+    Returns the area of the largest free rectangle the allocator tracks.
+    Free neighbors that could not be merged with it are not taken into
+    account.
+*/
+int QSGAreaAllocator::largestFreeArea() const
+{
+    int largest = 0;
+    forEachLeaf(m_root, m_size, [&largest](const QRect &rect, bool occupied) {
+        if (!occupied)
+            largest = qMax(largest, rect.width() * rect.height());
+    });
+    return largest;
+}
+
+/*!
+    \internal
+
+    Returns how fragmented the free area is, from \c 0, when it is a single
+    rectangle, towards \c 1, when it is scattered over many small ones.
+    A full or empty allocator is not fragmented.
+*/
+qreal QSGAreaAllocator::fragmentation() const
+{
+    const int free = freeArea();
+    if (free <= 0 || m_usedArea == 0)
+        return 0;
+    return 1 - qreal(largestFreeArea()) / free;
+}
+
+int QSGAreaAllocator::occupiedArea() const
+{
+    int area = 0;
+    forEachLeaf(m_root, m_size, [&area](const QRect &rect, bool occupied) {
+        if (occupied)
+            area += rect.width() * rect.height();
+    });
+    return area;
+}
+
 namespace {
     struct AreaAllocatorTable
     {
@@ -388,6 +480,7 @@ const char *QSGAreaAllocator::deserialize(const char *data, int size)
         data += AreaAllocatorTable::NodeSize;
     }
 
+    m_usedArea = occupiedArea();
     return data;
 }
 
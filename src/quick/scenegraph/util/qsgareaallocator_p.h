@@ -34,6 +34,11 @@ public:
     bool isEmpty() const { return m_root == nullptr; }
     QSize size() const { return m_size; }
 
+    int usedArea() const { return m_usedArea; }
+    int freeArea() const { return m_size.width() * m_size.height() - m_usedArea; }
+    int largestFreeArea() const;
+    qreal fragmentation() const;
+
     QByteArray serialize();
     const char *deserialize(const char *data, int size);
 
@@ -41,9 +46,11 @@ private:
     bool allocateInNode(const QSize &size, QPoint &result, const QRect &currentRect, QSGAreaAllocatorNode *node);
     bool deallocateInNode(const QPoint &pos, QSGAreaAllocatorNode *node);
     void mergeNodeWithNeighbors(QSGAreaAllocatorNode *node);
+    int occupiedArea() const;
 
     QSGAreaAllocatorNode *m_root;
     QSize m_size;
+    int m_usedArea = 0;
 };
 
 QT_END_NAMESPACE
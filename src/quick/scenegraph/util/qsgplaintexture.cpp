@@ -289,6 +289,7 @@ void QSGPlainTexture::commitTextureOperations(QRhi *rhi, QRhiResourceUpdateBatch
     if (tmp.width() * 4 != tmp.bytesPerLine())
         tmp = tmp.copy();
 
+    QSGTexturePrivate::countUpload();
     resourceUpdates->uploadTexture(m_texture, tmp);
 
     if (hasMipMaps) {
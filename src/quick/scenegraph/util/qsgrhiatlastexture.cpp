@@ -51,12 +51,18 @@ Manager::Manager(QSGDefaultRenderContext *rc, const QSize &surfacePixelSize, QSu
     m_atlas_size_limit = qt_sg_envInt("QSG_ATLAS_SIZE_LIMIT", qMax(w, h) / 2);
     m_atlas_size = QSize(w, h);
 
+    // A full atlas that uses no more than this percentage of its area is
+    // replaced by a fresh one instead of making new images standalone textures.
+    m_atlas_compaction_threshold = qt_sg_envInt("QSG_ATLAS_COMPACTION_THRESHOLD", 50);
+    m_atlas_retired_limit = qt_sg_envInt("QSG_ATLAS_RETIRED_LIMIT", 1);
+
     qCDebug(QSG_LOG_INFO, "rhi texture atlas dimensions: %dx%d", w, h);
 }
 
 Manager::~Manager()
 {
     Q_ASSERT(m_atlas == nullptr);
+    Q_ASSERT(m_retiredAtlases.isEmpty());
     Q_ASSERT(m_atlases.isEmpty());
 }
 
@@ -68,6 +74,12 @@ void Manager::invalidate()
         m_atlas = nullptr;
     }
 
+    for (Atlas *atlas : std::as_const(m_retiredAtlases)) {
+        atlas->invalidate();
+        atlas->deleteLater();
+    }
+    m_retiredAtlases.clear();
+
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*>::iterator i = m_atlases.begin();
     while (i != m_atlases.end()) {
         i.value()->invalidate();
@@ -84,12 +96,119 @@ QSGTexture *Manager::create(const QImage &image, bool hasAlphaChannel)
         if (!m_atlas)
             m_atlas = new Atlas(m_rc, m_atlas_size);
         t = m_atlas->create(image);
+        if (!t && compact())
+            t = m_atlas->create(image);
+        if (!t) {
+            ++m_fallbackCount;
+            m_statisticsChanged = true;
+        }
         if (t && !hasAlphaChannel && t->hasAlphaChannel())
             t->setHasAlphaChannel(false);
     }
     return t;
 }
 
+/*!
+    \internal
+
+    Called when an image does not fit into the current atlas. The textures in
+    the atlas cannot be moved, as nodes bake their normalizedTextureSubRect()
+    into their vertices, so when the atlas is mostly unused, which means its
+    free area is fragmented, it is retired instead: new images go into a
+    fresh atlas, and the retired one is released by endFrame() once its last
+    texture is gone. Returns \c false if the atlas is kept.
+*/
+bool Manager::compact()
+{
+    const QSGAreaAllocator &allocator = m_atlas->allocator();
+    const qint64 area = qint64(m_atlas_size.width()) * m_atlas_size.height();
+    if (m_retiredAtlases.size() >= m_atlas_retired_limit
+            || allocator.usedArea() * 100 > area * m_atlas_compaction_threshold) {
+        return false;
+    }
+
+    qCDebug(QSG_LOG_INFO, "rhi texture atlas retired: %d%% used, fragmentation %.2f",
+            int(allocator.usedArea() * 100 / area), allocator.fragmentation());
+
+    m_retiredAtlases.append(m_atlas);
+    m_atlas = new Atlas(m_rc, m_atlas_size);
+    ++m_compactionCount;
+    m_statisticsChanged = true;
+    return true;
+}
+
+/*!
+    \internal
+
+    Releases the retired atlases that no texture uses anymore. This is done
+    at the end of a frame, so that the last textures removed during the sync
+    and the render pass are not referenced by it anymore.
+
+    When atlases were retired or released, or images did not fit, the
+    statistics() are logged to the \c qt.scenegraph.general category.
+*/
+void Manager::endFrame()
+{
+    for (auto it = m_retiredAtlases.begin(); it != m_retiredAtlases.end(); ) {
+        Atlas *atlas = *it;
+        if (atlas->allocator().usedArea() == 0) {
+            atlas->invalidate();
+            atlas->deleteLater();
+            it = m_retiredAtlases.erase(it);
+            ++m_releasedAtlasCount;
+            m_statisticsChanged = true;
+        } else {
+            ++it;
+        }
+    }
+
+    if (m_statisticsChanged) {
+        m_statisticsChanged = false;
+        if (QSG_LOG_INFO().isDebugEnabled()) {
+            const Statistics stats = statistics();
+            qCDebug(QSG_LOG_INFO, "rhi texture atlas statistics: %d atlases (%d retired), "
+                                  "%lld of %lld pixels used, fragmentation %.2f, "
+                                  "%d retired, %d released, %d standalone fallbacks, "
+                                  "least recently used %llu frames ago",
+                    stats.atlasCount, stats.retiredAtlasCount, stats.usedArea, stats.totalArea,
+                    stats.fragmentation, stats.compactionCount, stats.releasedAtlasCount,
+                    stats.fallbackCount, stats.leastRecentlyUsedAge);
+        }
+    }
+}
+
+/*!
+    \internal
+
+    Returns the usage of the atlases for uncompressed images. The age of the
+    least recently used atlas is the number of frames since a texture in it
+    was last drawn, which tells how long the textures that keep a retired
+    atlas alive have been unused.
+*/
+Manager::Statistics Manager::statistics() const
+{
+    Statistics stats;
+    stats.compactionCount = m_compactionCount;
+    stats.releasedAtlasCount = m_releasedAtlasCount;
+    stats.fallbackCount = m_fallbackCount;
+    stats.retiredAtlasCount = m_retiredAtlases.size();
+
+    const quint64 frame = m_rc->frameCount();
+    const auto addAtlas = [&stats, frame](const Atlas *atlas) {
+        ++stats.atlasCount;
+        stats.usedArea += atlas->allocator().usedArea();
+        stats.totalArea += qint64(atlas->size().width()) * atlas->size().height();
+        stats.leastRecentlyUsedAge = qMax(stats.leastRecentlyUsedAge, frame - qMin(frame, atlas->lastUsedFrame()));
+    };
+    for (const Atlas *atlas : m_retiredAtlases)
+        addAtlas(atlas);
+    if (m_atlas) {
+        addAtlas(m_atlas);
+        stats.fragmentation = m_atlas->allocator().fragmentation();
+    }
+    return stats;
+}
+
 QSGTexture *Manager::create(const QSGCompressedTextureFactory *factory)
 {
     QSGTexture *t = nullptr;
@@ -136,6 +255,8 @@ void AtlasBase::invalidate()
 
 void AtlasBase::commitTextureOperations(QRhiResourceUpdateBatch *resourceUpdates)
 {
+    m_lastUsedFrame = m_rc->frameCount();
+
     if (!m_allocated) {
         m_allocated = true;
         if (!generateTexture()) {
@@ -309,6 +430,7 @@ void Atlas::enqueueTextureUpload(TextureBase *t, QRhiResourceUpdateBatch *resour
 
     QRhiTextureUploadDescription desc;
     desc.setEntries(entries.cbegin(), entries.cend());
+    QSGTexturePrivate::countUpload();
     resourceUpdates->uploadTexture(m_texture, desc);
 
     const QSize textureSize = t->textureSize();
@@ -37,7 +37,7 @@ class Texture;
 class TextureBase;
 class Atlas;
 
-class Manager : public QObject
+class Q_QUICK_EXPORT Manager : public QObject
 {
     Q_OBJECT
 
@@ -45,19 +45,45 @@ public:
     Manager(QSGDefaultRenderContext *rc, const QSize &surfacePixelSize, QSurface *maybeSurface);
     ~Manager();
 
+    struct Statistics {
+        int atlasCount = 0;
+        int retiredAtlasCount = 0;
+        qint64 usedArea = 0;
+        qint64 totalArea = 0;
+        qreal fragmentation = 0;
+        int compactionCount = 0;
+        int releasedAtlasCount = 0;
+        int fallbackCount = 0;
+        quint64 leastRecentlyUsedAge = 0;
+    };
+
     QSGTexture *create(const QImage &image, bool hasAlphaChannel);
     QSGTexture *create(const QSGCompressedTextureFactory *factory);
     void invalidate();
+    void endFrame();
+
+    Statistics statistics() const;
 
 private:
+    bool compact();
+
     QSGDefaultRenderContext *m_rc;
     QRhi *m_rhi;
     Atlas *m_atlas = nullptr;
+    // full atlases that are released once their last texture is gone
+    QList<Atlas *> m_retiredAtlases;
     // set of atlases for different compressed formats
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*> m_atlases;
 
     QSize m_atlas_size;
     int m_atlas_size_limit;
+    int m_atlas_compaction_threshold;
+    int m_atlas_retired_limit;
+
+    int m_compactionCount = 0;
+    int m_releasedAtlasCount = 0;
+    int m_fallbackCount = 0;
+    bool m_statisticsChanged = false;
 };
 
 class AtlasBase : public QObject
@@ -75,6 +101,8 @@ public:
     QRhi *rhi() const { return m_rhi; }
     QRhiTexture *texture() const { return m_texture; }
     QSize size() const { return m_size; }
+    const QSGAreaAllocator &allocator() const { return m_allocator; }
+    quint64 lastUsedFrame() const { return m_lastUsedFrame; }
 
 protected:
     virtual bool generateTexture() = 0;
@@ -87,6 +115,7 @@ protected:
     QRhiTexture *m_texture = nullptr;
     QSize m_size;
     QVector<TextureBase *> m_pending_uploads;
+    quint64 m_lastUsedFrame = 0;
     friend class TextureBase;
     friend class TextureBasePrivate;
 
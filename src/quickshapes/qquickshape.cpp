@@ -1018,6 +1018,17 @@ void QQuickShape::setPreferredRendererType(QQuickShape::RendererType preferredTy
     results of the path rendering are shown only when all the asynchronous
     work has been finished.
 
+    With \c Shape.GeometryRenderer, the triangles of a path are cached and
+    reused by all Shapes that have an identical path at the same scale, with
+    the same fill rule and stroke parameters, regardless of their colors.
+    The cache is disabled by default, and is enabled by setting its size in
+    kilobytes with the \c QT_QUICKSHAPES_TESSELLATION_CACHE_SIZE environment
+    variable. Large paths made of many separate subpaths can also be split,
+    and the parts processed on multiple threads, by setting the maximum number
+    of threads with the \c QT_QUICKSHAPES_TESSELLATION_THREADS environment
+    variable. As this applies regardless of this property, it is disabled by
+    default.
+
     The default value is \c false.
  */
 
@@ -11,8 +11,15 @@
 
 #include <QtQuick/private/qsggradientcache_p.h>
 
+#include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
+
+#include <algorithm>
+#include <atomic>
+
 #if QT_CONFIG(thread)
 #include <QThreadPool>
+#include <QSemaphore>
 #endif
 
 QT_BEGIN_NAMESPACE
@@ -441,15 +448,322 @@ void QQuickShapeGenericRenderer::maybeUpdateAsyncItem()
         m_asyncCallback(m_asyncCallbackData);
 }
 
-// the stroke/fill triangulation functions may be invoked either on the gui
-// thread or some worker thread and must thus be self-contained.
-void QQuickShapeGenericRenderer::triangulateFill(const QPainterPath &path,
-                                                 const Color4ub &fillColor,
-                                                 VertexContainerType *fillVertices,
-                                                 IndexContainerType *fillIndices,
-                                                 QSGGeometry::Type *indexType,
-                                                 bool supportsElementIndexUint,
-                                                 qreal triangulationScale)
+namespace {
+
+// Identifies the result of a triangulation independently of the color, so
+// that identical paths in different Shapes share their triangles.
+struct TessellationKey
+{
+    QPainterPath path;
+    QPen pen;
+    QSize clipSize;
+    qreal scale = 1;
+    bool stroke = false;
+    bool supportsElementIndexUint = false;
+    size_t hash = 0;
+
+    bool operator==(const TessellationKey &other) const
+    {
+        if (hash != other.hash || stroke != other.stroke || scale != other.scale
+                || supportsElementIndexUint != other.supportsElementIndexUint
+                || clipSize != other.clipSize || pen != other.pen
+                || path.fillRule() != other.path.fillRule()
+                || path.elementCount() != other.path.elementCount()) {
+            return false;
+        }
+        // QPainterPath::operator==() is fuzzy, the triangles are not.
+        for (int i = 0; i < path.elementCount(); ++i) {
+            const QPainterPath::Element &a = path.elementAt(i);
+            const QPainterPath::Element &b = other.path.elementAt(i);
+            if (a.type != b.type || a.x != b.x || a.y != b.y)
+                return false;
+        }
+        return true;
+    }
+};
+
+size_t qHash(const TessellationKey &key, size_t seed = 0)
+{
+    return qHashMulti(seed, key.hash);
+}
+
+static size_t hashPath(const QPainterPath &path)
+{
+    size_t hash = qHash(int(path.fillRule()));
+    for (int i = 0; i < path.elementCount(); ++i) {
+        const QPainterPath::Element &e = path.elementAt(i);
+        hash = qHashMulti(hash, int(e.type), e.x, e.y);
+    }
+    return hash;
+}
+
+struct Tessellation
+{
+    QQuickShapeGenericRenderer::VertexContainerType vertices;
+    QQuickShapeGenericRenderer::IndexContainerType indices;
+    QSGGeometry::Type indexType;
+};
+
+class TessellationCache
+{
+public:
+    TessellationCache()
+    {
+        // in KB, disabled unless asked for
+        setSize(qEnvironmentVariableIntValue("QT_QUICKSHAPES_TESSELLATION_CACHE_SIZE"));
+    }
+
+    bool isEnabled()
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_cache.maxCost() > 0;
+    }
+
+    int size()
+    {
+        QMutexLocker locker(&m_mutex);
+        return int(m_cache.maxCost() / 1024);
+    }
+
+    void setSize(int kilobytes)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_cache.setMaxCost(qMax(0, kilobytes) * qsizetype(1024));
+    }
+
+    bool find(const TessellationKey &key, Tessellation *result)
+    {
+        QMutexLocker locker(&m_mutex);
+        const Tessellation *t = m_cache.object(key);
+        if (!t)
+            return false;
+        *result = *t;
+        return true;
+    }
+
+    void insert(const TessellationKey &key, const Tessellation &t)
+    {
+        const qsizetype cost = t.vertices.size() * sizeof(QSGGeometry::ColoredPoint2D)
+                + t.indices.size() * sizeof(quint32) + key.path.elementCount() * sizeof(QPainterPath::Element);
+        QMutexLocker locker(&m_mutex);
+        m_cache.insert(key, new Tessellation(t), cost);
+    }
+
+    void clear()
+    {
+        QMutexLocker locker(&m_mutex);
+        m_cache.clear();
+    }
+
+private:
+    QMutex m_mutex;
+    QCache<TessellationKey, Tessellation> m_cache;
+};
+
+Q_GLOBAL_STATIC(TessellationCache, tessellationCache)
+
+// Paths with fewer elements are not worth splitting across threads.
+static const int minElementsPerTessellationThread = 512;
+
+// Large paths are only split when asked for, as the extra threads compete with
+// the rest of the application, also for Shapes that are not asynchronous.
+static int defaultTessellationThreadCount()
+{
+#if QT_CONFIG(thread)
+    return qMax(1, qEnvironmentVariableIntValue("QT_QUICKSHAPES_TESSELLATION_THREADS"));
+#else
+    return 1;
+#endif
+}
+
+// Function-local, so that the environment is only read on first use rather
+// than while the library is loaded.
+static std::atomic<int> &maxTessellationThreads()
+{
+    static std::atomic<int> count(defaultTessellationThreadCount());
+    return count;
+}
+
+#if QT_CONFIG(thread)
+// Separate from pathWorkThreadPool: the tasks started here never wait for
+// anything, so a triangulation running on a worker thread can wait for them
+// without risking a deadlock.
+Q_GLOBAL_STATIC(QThreadPool, tessellationThreadPool)
+#endif
+
+// Calls f(0) ... f(count - 1), in parallel when possible, and returns when all
+// calls have finished.
+template <typename F>
+void runInParallel(int count, const F &f)
+{
+#if QT_CONFIG(thread)
+    QThreadPool *pool = tessellationThreadPool();
+    QSemaphore done;
+    for (int i = 1; i < count; ++i) {
+        pool->start([&f, &done, i] {
+            f(i);
+            done.release();
+        });
+    }
+    f(0);
+    done.acquire(count - 1);
+#else
+    for (int i = 0; i < count; ++i)
+        f(i);
+#endif
+}
+
+struct SubpathRange
+{
+    int begin;
+    int end;
+    QRectF bounds;
+};
+
+static QList<SubpathRange> subpathRanges(const QPainterPath &path)
+{
+    QList<SubpathRange> ranges;
+    qreal minX = 0, minY = 0, maxX = 0, maxY = 0;
+    for (int i = 0; i < path.elementCount(); ++i) {
+        const QPainterPath::Element &e = path.elementAt(i);
+        if (e.isMoveTo() || ranges.isEmpty()) {
+            if (!ranges.isEmpty())
+                ranges.last().bounds = QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+            ranges.append({ i, i, QRectF() });
+            minX = maxX = e.x;
+            minY = maxY = e.y;
+        }
+        // The control points of a curve bound it, which is good enough here.
+        minX = qMin(minX, e.x);
+        maxX = qMax(maxX, e.x);
+        minY = qMin(minY, e.y);
+        maxY = qMax(maxY, e.y);
+        ranges.last().end = i + 1;
+    }
+    if (!ranges.isEmpty())
+        ranges.last().bounds = QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+    return ranges;
+}
+
+static void appendSubpaths(QPainterPath *dst, const QPainterPath &src, int begin, int end)
+{
+    for (int i = begin; i < end; ++i) {
+        const QPainterPath::Element &e = src.elementAt(i);
+        switch (e.type) {
+        case QPainterPath::MoveToElement:
+            dst->moveTo(e);
+            break;
+        case QPainterPath::LineToElement:
+            dst->lineTo(e);
+            break;
+        case QPainterPath::CurveToElement:
+            dst->cubicTo(e, src.elementAt(i + 1), src.elementAt(i + 2));
+            i += 2;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// Groups the subpaths into clusters whose bounds do not overlap along one
+// axis, so that the fill of each cluster does not depend on the others.
+static QList<QList<SubpathRange>> independentClusters(QList<SubpathRange> ranges)
+{
+    const auto clusterAlong = [&ranges](auto begin, auto end) {
+        std::sort(ranges.begin(), ranges.end(), [&](const SubpathRange &a, const SubpathRange &b) {
+            return begin(a.bounds) < begin(b.bounds);
+        });
+        QList<QList<SubpathRange>> clusters;
+        qreal clusterEnd = 0;
+        for (const SubpathRange &range : std::as_const(ranges)) {
+            if (clusters.isEmpty() || begin(range.bounds) > clusterEnd) {
+                clusters.append(QList<SubpathRange>());
+                clusterEnd = end(range.bounds);
+            } else {
+                clusterEnd = qMax(clusterEnd, end(range.bounds));
+            }
+            clusters.last().append(range);
+        }
+        return clusters;
+    };
+
+    QList<QList<SubpathRange>> byX = clusterAlong([](const QRectF &r) { return r.left(); },
+                                                  [](const QRectF &r) { return r.right(); });
+    QList<QList<SubpathRange>> byY = clusterAlong([](const QRectF &r) { return r.top(); },
+                                                  [](const QRectF &r) { return r.bottom(); });
+    return byY.size() > byX.size() ? byY : byX;
+}
+
+// Splits path into at most tessellationThreadCount() parts of similar size
+// that can be triangulated independently. Returns an empty list when the path
+// is not worth splitting.
+static QList<QPainterPath> splitPath(const QPainterPath &path, bool forFill)
+{
+    const int elementCount = path.elementCount();
+    const int maxParts = qMin(maxTessellationThreads().load(), elementCount / minElementsPerTessellationThread);
+    if (maxParts < 2)
+        return QList<QPainterPath>();
+
+    QList<SubpathRange> ranges = subpathRanges(path);
+    if (ranges.size() < 2)
+        return QList<QPainterPath>();
+
+    QList<QList<SubpathRange>> clusters;
+    if (forFill) {
+        clusters = independentClusters(std::move(ranges));
+    } else {
+        // The stroke of each subpath is independent of the others.
+        for (const SubpathRange &range : std::as_const(ranges))
+            clusters.append({ range });
+    }
+    if (clusters.size() < 2)
+        return QList<QPainterPath>();
+
+    QList<QPainterPath> parts;
+    const int elementsPerPart = elementCount / maxParts;
+    int partElements = 0;
+    for (const QList<SubpathRange> &cluster : std::as_const(clusters)) {
+        if (parts.isEmpty() || (partElements >= elementsPerPart && parts.size() < maxParts)) {
+            parts.append(QPainterPath());
+            parts.last().setFillRule(path.fillRule());
+            partElements = 0;
+        }
+        for (const SubpathRange &range : cluster) {
+            appendSubpaths(&parts.last(), path, range.begin, range.end);
+            partElements += range.end - range.begin;
+        }
+    }
+    if (parts.size() < 2)
+        return QList<QPainterPath>();
+
+    // qtVectorPathForPath() initializes a unique_ptr without locking.
+    // Do that before starting the threads as otherwise we get a race condition.
+    for (const QPainterPath &part : std::as_const(parts))
+        qtVectorPathForPath(part);
+    return parts;
+}
+
+static void setVertexColor(QQuickShapeGenericRenderer::VertexContainerType *vertices,
+                           const QQuickShapeGenericRenderer::Color4ub &color)
+{
+    if (vertices->isEmpty())
+        return;
+    const ColoredVertex *first = reinterpret_cast<const ColoredVertex *>(vertices->constData());
+    if (!memcmp(&first->color, &color, sizeof(color)))
+        return;
+    ColoredVertex *vdst = reinterpret_cast<ColoredVertex *>(vertices->data());
+    for (qsizetype i = 0, count = vertices->size(); i < count; ++i)
+        vdst[i].color = color;
+}
+
+static void triangulateFillPart(const QPainterPath &path,
+                                const QQuickShapeGenericRenderer::Color4ub &fillColor,
+                                QQuickShapeGenericRenderer::VertexContainerType *fillVertices,
+                                QQuickShapeGenericRenderer::IndexContainerType *fillIndices,
+                                QSGGeometry::Type *indexType,
+                                bool supportsElementIndexUint,
+                                qreal triangulationScale)
 {
     const QVectorPath &vp = qtVectorPathForPath(path);
 
@@ -476,15 +790,61 @@ void QQuickShapeGenericRenderer::triangulateFill(const QPainterPath &path,
     memcpy(fillIndices->data(), ts.indices.data(), indexByteSize);
 }
 
-void QQuickShapeGenericRenderer::triangulateStroke(const QPainterPath &path,
-                                                   const QPen &pen,
-                                                   const Color4ub &strokeColor,
-                                                   VertexContainerType *strokeVertices,
-                                                   const QSize &clipSize,
-                                                   qreal triangulationScale)
+static void triangulateFillParts(const QList<QPainterPath> &parts,
+                                 const QQuickShapeGenericRenderer::Color4ub &fillColor,
+                                 QQuickShapeGenericRenderer::VertexContainerType *fillVertices,
+                                 QQuickShapeGenericRenderer::IndexContainerType *fillIndices,
+                                 QSGGeometry::Type *indexType,
+                                 qreal triangulationScale)
+{
+    QList<QTriangleSet> sets(parts.size());
+    runInParallel(parts.size(), [&parts, &sets, triangulationScale](int i) {
+        sets[i] = qTriangulate(qtVectorPathForPath(parts.at(i)),
+                               QTransform::fromScale(triangulationScale, triangulationScale), 1, true);
+    });
+
+    qsizetype vertexCount = 0;
+    qsizetype indexCount = 0;
+    for (const QTriangleSet &ts : std::as_const(sets)) {
+        vertexCount += ts.vertices.size() / 2;
+        indexCount += ts.indices.size();
+    }
+
+    fillVertices->resize(vertexCount);
+    ColoredVertex *vdst = reinterpret_cast<ColoredVertex *>(fillVertices->data());
+    for (const QTriangleSet &ts : std::as_const(sets)) {
+        const qreal *vsrc = ts.vertices.constData();
+        for (qsizetype i = 0, count = ts.vertices.size() / 2; i < count; ++i)
+            (vdst++)->set(vsrc[i * 2] / triangulationScale, vsrc[i * 2 + 1] / triangulationScale, fillColor);
+    }
+
+    // 16-bit indices are packed in pairs, so their count has to be even.
+    const bool shortIndices = vertexCount <= 0xFFFF && indexCount % 2 == 0;
+    *indexType = shortIndices ? QSGGeometry::UnsignedShortType : QSGGeometry::UnsignedIntType;
+    fillIndices->resize(shortIndices ? indexCount / 2 : indexCount);
+
+    quint16 *shortDst = reinterpret_cast<quint16 *>(fillIndices->data());
+    quint32 *intDst = fillIndices->data();
+    quint32 base = 0;
+    for (const QTriangleSet &ts : std::as_const(sets)) {
+        const bool shortSrc = ts.indices.type() == QVertexIndexVector::UnsignedShort;
+        const quint16 *shortSrcData = static_cast<const quint16 *>(ts.indices.data());
+        const quint32 *intSrcData = static_cast<const quint32 *>(ts.indices.data());
+        for (int i = 0; i < ts.indices.size(); ++i) {
+            const quint32 index = base + (shortSrc ? shortSrcData[i] : intSrcData[i]);
+            if (shortIndices)
+                *shortDst++ = quint16(index);
+            else
+                *intDst++ = index;
+        }
+        base += quint32(ts.vertices.size() / 2);
+    }
+}
+
+static QList<float> triangulateStrokePart(const QPainterPath &path, const QPen &pen,
+                                          const QRectF &clip, qreal triangulationScale)
 {
     const QVectorPath &vp = qtVectorPathForPath(path);
-    const QRectF clip(QPointF(0, 0), clipSize);
     const qreal inverseScale = 1.0 / triangulationScale;
 
     QTriangulatingStroker stroker;
@@ -501,17 +861,153 @@ void QQuickShapeGenericRenderer::triangulateStroke(const QPainterPath &path,
         stroker.process(dashStroke, pen, clip, {});
     }
 
-    if (!stroker.vertexCount()) {
-        strokeVertices->clear();
-        return;
+    return QList<float>(stroker.vertices(), stroker.vertices() + stroker.vertexCount());
+}
+
+} // namespace
+
+/*!
+    \internal
+
+    Returns the maximum number of threads a single path is triangulated on,
+    which is one when large paths are not split.
+*/
+int QQuickShapeGenericRenderer::tessellationThreadCount()
+{
+    return maxTessellationThreads().load();
+}
+
+void QQuickShapeGenericRenderer::setTessellationThreadCount(int count)
+{
+    maxTessellationThreads().store(qMax(1, count));
+}
+
+/*!
+    \internal
+
+    Returns the maximum size of the cache of triangulations in kilobytes,
+    which is zero when the cache is disabled.
+*/
+int QQuickShapeGenericRenderer::tessellationCacheSize()
+{
+    return tessellationCache()->size();
+}
+
+void QQuickShapeGenericRenderer::setTessellationCacheSize(int kilobytes)
+{
+    tessellationCache()->setSize(kilobytes);
+}
+
+void QQuickShapeGenericRenderer::clearTessellationCache()
+{
+    tessellationCache()->clear();
+}
+
+// the stroke/fill triangulation functions may be invoked either on the gui
+// thread or some worker thread and must thus be self-contained.
+//
+// When enabled, results are kept in a cache shared by all Shapes, keyed on the
+// exact path elements and everything else the triangles depend on except the
+// color. Large paths can also be split into parts that do not affect each
+// other, which are then triangulated on separate threads.
+void QQuickShapeGenericRenderer::triangulateFill(const QPainterPath &path,
+                                                 const Color4ub &fillColor,
+                                                 VertexContainerType *fillVertices,
+                                                 IndexContainerType *fillIndices,
+                                                 QSGGeometry::Type *indexType,
+                                                 bool supportsElementIndexUint,
+                                                 qreal triangulationScale)
+{
+    TessellationCache *cache = tessellationCache();
+    const bool useCache = cache->isEnabled();
+    TessellationKey key;
+    if (useCache) {
+        key = { path, QPen(), QSize(), triangulationScale, false, supportsElementIndexUint,
+                qHashMulti(hashPath(path), triangulationScale, supportsElementIndexUint) };
+        Tessellation t;
+        if (cache->find(key, &t)) {
+            *fillVertices = std::move(t.vertices);
+            *fillIndices = std::move(t.indices);
+            *indexType = t.indexType;
+            setVertexColor(fillVertices, fillColor);
+            return;
+        }
+    }
+
+    // Merging the parts may need 32-bit indices.
+    const QList<QPainterPath> parts = supportsElementIndexUint ? splitPath(path, true) : QList<QPainterPath>();
+    if (parts.isEmpty()) {
+        triangulateFillPart(path, fillColor, fillVertices, fillIndices, indexType,
+                            supportsElementIndexUint, triangulationScale);
+    } else {
+        triangulateFillParts(parts, fillColor, fillVertices, fillIndices, indexType, triangulationScale);
+    }
+
+    if (useCache)
+        cache->insert(key, { *fillVertices, *fillIndices, *indexType });
+}
+
+void QQuickShapeGenericRenderer::triangulateStroke(const QPainterPath &path,
+                                                   const QPen &pen,
+                                                   const Color4ub &strokeColor,
+                                                   VertexContainerType *strokeVertices,
+                                                   const QSize &clipSize,
+                                                   qreal triangulationScale)
+{
+    TessellationCache *cache = tessellationCache();
+    const bool useCache = cache->isEnabled();
+    TessellationKey key;
+    if (useCache) {
+        key = { path, pen, clipSize, triangulationScale, true, false,
+                qHashMulti(hashPath(path), pen.widthF(), int(pen.style()), int(pen.capStyle()),
+                           int(pen.joinStyle()), clipSize.width(), clipSize.height(), triangulationScale) };
+        Tessellation t;
+        if (cache->find(key, &t)) {
+            *strokeVertices = std::move(t.vertices);
+            setVertexColor(strokeVertices, strokeColor);
+            return;
+        }
+    }
+
+    const QRectF clip(QPointF(0, 0), clipSize);
+    // Only solid strokes are split, the dash processor works on the whole path.
+    const QList<QPainterPath> parts = pen.style() == Qt::SolidLine ? splitPath(path, false) : QList<QPainterPath>();
+    QList<QList<float>> partVertices(qMax(qsizetype(1), parts.size()));
+    if (parts.isEmpty()) {
+        partVertices[0] = triangulateStrokePart(path, pen, clip, triangulationScale);
+    } else {
+        runInParallel(parts.size(), [&](int i) {
+            partVertices[i] = triangulateStrokePart(parts.at(i), pen, clip, triangulationScale);
+        });
+    }
+
+    // The parts are joined by degenerate triangles, like the subpaths of a
+    // single stroke are.
+    qsizetype vertexCount = 0;
+    for (const QList<float> &vertices : std::as_const(partVertices)) {
+        if (!vertices.isEmpty())
+            vertexCount += (vertexCount ? 2 : 0) + vertices.size() / 2;
     }
 
-    const int vertexCount = stroker.vertexCount() / 2; // just a float vector with x,y hence the / 2
     strokeVertices->resize(vertexCount);
-    ColoredVertex *vdst = reinterpret_cast<ColoredVertex *>(strokeVertices->data());
-    const float *vsrc = stroker.vertices();
-    for (int i = 0; i < vertexCount; ++i)
-        vdst[i].set(vsrc[i * 2], vsrc[i * 2 + 1], strokeColor);
+    ColoredVertex *vbegin = reinterpret_cast<ColoredVertex *>(strokeVertices->data());
+    ColoredVertex *vdst = vbegin;
+    for (const QList<float> &vertices : std::as_const(partVertices)) {
+        if (vertices.isEmpty())
+            continue;
+        const float *vsrc = vertices.constData();
+        const qsizetype count = vertices.size() / 2;
+        if (vdst != vbegin) {
+            vdst->set(vdst[-1].x, vdst[-1].y, strokeColor);
+            ++vdst;
+            (vdst++)->set(vsrc[0], vsrc[1], strokeColor);
+        }
+        for (qsizetype i = 0; i < count; ++i)
+            (vdst++)->set(vsrc[i * 2], vsrc[i * 2 + 1], strokeColor);
+    }
+
+    if (useCache)
+        cache->insert(key, { *strokeVertices, IndexContainerType(), QSGGeometry::UnsignedIntType });
 }
 
 void QQuickShapeGenericRenderer::setRootNode(QQuickShapeGenericNode *node)
@@ -32,7 +32,7 @@ class QQuickShapeGenericStrokeFillNode;
 class QQuickShapeFillRunnable;
 class QQuickShapeStrokeRunnable;
 
-class QQuickShapeGenericRenderer : public QQuickAbstractPathRenderer
+class Q_QUICKSHAPES_EXPORT QQuickShapeGenericRenderer : public QQuickAbstractPathRenderer
 {
 public:
     enum Dirty {
@@ -97,6 +97,12 @@ public:
                                   const QSize &clipSize,
                                   qreal triangulationScale);
 
+    static int tessellationThreadCount();
+    static void setTessellationThreadCount(int count);
+    static int tessellationCacheSize();
+    static void setTessellationCacheSize(int kilobytes);
+    static void clearTessellationCache();
+
 private:
     void maybeUpdateAsyncItem();
 
@@ -0,0 +1,8 @@
+import QtQml
+import QtQml.Models
+
+DelegateModel {
+    delegate: QtObject {
+        property string text: model.a + model.b + model.c
+    }
+}
@@ -0,0 +1,12 @@
+import QtQml
+import QtQml.Models
+
+DelegateModel {
+    property int countChanges: 0
+    property int updates: 0
+
+    coalesceChanges: true
+    delegate: QtObject {}
+    onCountChanged: ++countChanges
+    items.onChanged: ++updates
+}
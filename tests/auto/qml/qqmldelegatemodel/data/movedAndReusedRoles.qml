@@ -0,0 +1,10 @@
+import QtQml
+import QtQml.Models
+
+DelegateModel {
+    delegate: QtObject {
+        property string text: model.index + ":" + model.a + model.b
+        property var texts: []
+        onTextChanged: texts = texts.concat([text])
+    }
+}
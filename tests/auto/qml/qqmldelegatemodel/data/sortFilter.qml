@@ -0,0 +1,31 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQml
+import QtQml.Models
+
+DelegateModel {
+    property ListModel source: ListModel {
+        ListElement { name: "d"; size: 4; shown: true }
+        ListElement { name: "b"; size: 2; shown: false }
+        ListElement { name: "e"; size: 5; shown: true }
+        ListElement { name: "a"; size: 1; shown: true }
+        ListElement { name: "c"; size: 3; shown: true }
+    }
+
+    function appendRow(name: string, size: int) {
+        source.append({ name: name, size: size, shown: true })
+    }
+
+    function removeRow(row: int) {
+        source.remove(row)
+    }
+
+    model: source
+    sortRole: "size"
+    filterRole: "shown"
+    delegate: QtObject {
+        required property string name
+        required property int index
+    }
+}
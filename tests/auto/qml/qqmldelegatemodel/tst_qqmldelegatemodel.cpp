@@ -3,6 +3,7 @@
 
 #include <QtTest/qtest.h>
 #include <QtCore/qjsonobject.h>
+#include <QtCore/qstringlistmodel.h>
 #include <QtCore/qsortfilterproxymodel.h>
 #include <QtCore/QConcatenateTablesProxyModel>
 #include <QtCore/qtimer.h>
@@ -60,6 +61,11 @@ private slots:
 
     void delegateModelAccess_data();
     void delegateModelAccess();
+    void sortFilter();
+    void batchedRoles();
+    void batchedRolesMovedAndReused();
+    void coalesceChanges();
+    void coalesceChangesFromHandler();
 };
 
 class BaseAbstractItemModel : public QAbstractItemModel
@@ -1009,6 +1015,298 @@ void tst_QQmlDelegateModel::delegateModelAccess()
     QCOMPARE(delegate->property("modelX").toDouble(), expected);
 }
 
+static QString sortFilterNames(QQmlDelegateModel *model)
+{
+    QString names;
+    for (int i = 0; i < model->count(); ++i)
+        names += model->variantValue(i, QStringLiteral("name")).toString();
+    return names;
+}
+
+void tst_QQmlDelegateModel::sortFilter()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("sortFilter.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> object(c.create());
+
+    QQmlDelegateModel *delegateModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(delegateModel);
+    QQmlListModel *source = object->property("source").value<QQmlListModel *>();
+    QVERIFY(source);
+
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("acde"));
+
+    // Delegates know both their sorted index and their row in the model
+    QObject *delegate = delegateModel->object(0);
+    QVERIFY(delegate);
+    QCOMPARE(delegate->property("name").toString(), QStringLiteral("a"));
+    QCOMPARE(delegate->property("index").toInt(), 0);
+
+    QQmlChangeSet changes;
+    int updates = 0;
+    connect(delegateModel, &QQmlDelegateModel::modelUpdated, delegateModel,
+            [&](const QQmlChangeSet &changeSet, bool reset) {
+        QVERIFY(!reset);
+        changes = changeSet;
+        ++updates;
+    });
+
+    // An inserted row is placed at its sorted position
+    QMetaObject::invokeMethod(object.data(), "appendRow", QString("f"), 0);
+    QCOMPARE(updates, 1);
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("facde"));
+    QCOMPARE(changes.inserts().size(), 1);
+    QCOMPARE(changes.inserts().first().index, 0);
+    QVERIFY(changes.removes().isEmpty());
+    QCOMPARE(delegate->property("index").toInt(), 1);
+
+    // Changing the sort key only moves the changed item
+    source->setProperty(0, QStringLiteral("size"), 10);
+    QCOMPARE(updates, 2);
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("faced"));
+    QCOMPARE(changes.removes().size(), 1);
+    QCOMPARE(changes.inserts().size(), 1);
+    QVERIFY(changes.removes().first().isMove());
+    QCOMPARE(changes.removes().first().index, 3);
+    QCOMPARE(changes.inserts().first().index, 4);
+
+    // Changing the filter role inserts and removes items
+    source->setProperty(1, QStringLiteral("shown"), true);
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("fabced"));
+    QCOMPARE(changes.inserts().size(), 1);
+    QCOMPARE(changes.inserts().first().index, 2);
+    source->setProperty(3, QStringLiteral("shown"), false);
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("fbced"));
+    QCOMPARE(changes.removes().size(), 1);
+    QCOMPARE(changes.removes().first().index, 1);
+    QCOMPARE(delegate->property("index").toInt(), -1);
+
+    // Removing a filtered out row doesn't change the items
+    QMetaObject::invokeMethod(object.data(), "removeRow", 3);
+    QVERIFY(changes.isEmpty());
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("fbced"));
+
+    delegateModel->setSortOrder(Qt::DescendingOrder);
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("decbf"));
+
+    delegateModel->setFilterPredicate(engine.evaluate(QStringLiteral("(shown) => !shown")));
+    QCOMPARE(sortFilterNames(delegateModel), QString());
+
+    delegateModel->setFilterRole(QString());
+    delegateModel->setSortComparator(engine.evaluate(QStringLiteral("(a, b) => (a % 4) - (b % 4)")));
+    // Items with equal keys keep their order in the model
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("cdbef"));
+
+    delegateModel->setSortRole(QString());
+    QCOMPARE(sortFilterNames(delegateModel), QStringLiteral("dbecf"));
+}
+
+class RoleCountingModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    enum Roles { A = Qt::UserRole, B, C };
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : 5;
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        return { { A, "a" }, { B, "b" }, { C, "c" } };
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        ++dataCalls;
+        return QString(QChar(u'a' + role - A)) + QString::number(index.row() + revision);
+    }
+
+    void multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const override
+    {
+        ++multiDataCalls;
+        QAbstractListModel::multiData(index, roleDataSpan);
+    }
+
+    void change(int row, int role)
+    {
+        ++revision;
+        emit dataChanged(index(row), index(row), { role });
+    }
+
+    void move(int from, int to)
+    {
+        beginMoveRows(QModelIndex(), from, from, QModelIndex(), to > from ? to + 1 : to);
+        endMoveRows();
+    }
+
+    mutable int dataCalls = 0;
+    mutable int multiDataCalls = 0;
+    int revision = 0;
+};
+
+void tst_QQmlDelegateModel::batchedRoles()
+{
+    RoleCountingModel model;
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("batchedRoles.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> object(c.createWithInitialProperties(
+            { { "model", QVariant::fromValue(&model) } }));
+    QQmlDelegateModel *delegateModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(delegateModel);
+    QCOMPARE(delegateModel->count(), 5);
+
+    QList<QObject *> delegates;
+    for (int i = 0; i < 5; ++i) {
+        QObject *delegate = delegateModel->object(i);
+        QVERIFY(delegate);
+        QCOMPARE(delegate->property("text").toString(),
+                 QString("a%1b%1c%1").arg(i));
+        delegates.append(delegate);
+    }
+
+    // Each role of each row is read from the model only once. Once the first
+    // delegate has told which roles are used, a row takes a single call.
+    QCOMPARE(model.dataCalls, 15);
+    QCOMPARE_LE(model.multiDataCalls, 3 + 4);
+
+    // Only the changed role is fetched again.
+    model.change(2, RoleCountingModel::B);
+    QCOMPARE(model.dataCalls, 16);
+    QCOMPARE(delegates.at(2)->property("text").toString(), QStringLiteral("a2b3c2"));
+    QCOMPARE(delegates.at(1)->property("text").toString(), QStringLiteral("a1b1c1"));
+
+    for (QObject *delegate : std::as_const(delegates))
+        delegateModel->release(delegate);
+}
+
+void tst_QQmlDelegateModel::batchedRolesMovedAndReused()
+{
+    RoleCountingModel model;
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("movedAndReusedRoles.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> object(c.createWithInitialProperties(
+            { { "model", QVariant::fromValue(&model) } }));
+    QQmlDelegateModel *delegateModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(delegateModel);
+
+    QObject *delegate = delegateModel->object(1);
+    QVERIFY(delegate);
+    QCOMPARE(delegate->property("text").toString(), QStringLiteral("1:a1b1"));
+
+    // The values of this model depend on the row only, so a moved item has
+    // to read them again from its new row.
+    model.move(1, 3);
+    QCOMPARE(delegate->property("text").toString(), QStringLiteral("3:a3b3"));
+    QVERIFY(!delegate->property("texts").toStringList().contains(QStringLiteral("3:a1b1")));
+
+    // A reused item never shows the values of the row it was created for.
+    QCOMPARE(delegateModel->release(delegate, QQmlInstanceModel::Reusable),
+             QQmlInstanceModel::Pooled);
+    QObject *reused = delegateModel->object(0);
+    QCOMPARE(reused, delegate);
+    QCOMPARE(reused->property("text").toString(), QStringLiteral("0:a0b0"));
+    QVERIFY(!reused->property("texts").toStringList().contains(QStringLiteral("0:a3b3")));
+
+    delegateModel->release(reused);
+}
+
+void tst_QQmlDelegateModel::coalesceChanges()
+{
+    QStringListModel model({ "a", "b" });
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("coalesceChanges.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> object(c.createWithInitialProperties(
+            { { "model", QVariant::fromValue(&model) } }));
+    QQmlDelegateModel *delegateModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(delegateModel);
+    QVERIFY(delegateModel->coalesceChanges());
+    QCOMPARE(delegateModel->count(), 2);
+
+    QSignalSpy updatedSpy(delegateModel, &QQmlDelegateModel::modelUpdated);
+    const int countChanges = delegateModel->property("countChanges").toInt();
+    const int updates = delegateModel->property("updates").toInt();
+
+    // Rows inserted one by one are reported as one change
+    for (int i = 0; i < 5; ++i)
+        model.insertRows(model.rowCount(), 1);
+    QCOMPARE(updatedSpy.size(), 0);
+    QCOMPARE(delegateModel->property("countChanges").toInt(), countChanges);
+
+    QTRY_COMPARE(updatedSpy.size(), 1);
+    const QQmlChangeSet changeSet = updatedSpy.at(0).at(0).value<QQmlChangeSet>();
+    QCOMPARE(changeSet.inserts().size(), 1);
+    QCOMPARE(changeSet.inserts().at(0).index, 2);
+    QCOMPARE(changeSet.inserts().at(0).count, 5);
+    QCOMPARE(delegateModel->count(), 7);
+    QCOMPARE(delegateModel->property("countChanges").toInt(), countChanges + 1);
+    QCOMPARE(delegateModel->property("updates").toInt(), updates + 1);
+
+    // Asking for an item reports the pending changes first
+    model.removeRows(0, 1);
+    model.removeRows(0, 1);
+    QCOMPARE(updatedSpy.size(), 1);
+    QObject *delegate = delegateModel->object(0);
+    QVERIFY(delegate);
+    QCOMPARE(updatedSpy.size(), 2);
+    QCOMPARE(updatedSpy.at(1).at(0).value<QQmlChangeSet>().removes().size(), 1);
+    QCOMPARE(updatedSpy.at(1).at(0).value<QQmlChangeSet>().removes().at(0).count, 2);
+    delegateModel->release(delegate);
+
+    // Without coalescing, each change is reported immediately
+    delegateModel->setCoalesceChanges(false);
+    model.insertRows(0, 1);
+    QCOMPARE(updatedSpy.size(), 3);
+    model.insertRows(0, 1);
+    QCOMPARE(updatedSpy.size(), 4);
+}
+
+void tst_QQmlDelegateModel::coalesceChangesFromHandler()
+{
+    QStringListModel model({ "a", "b" });
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("coalesceChanges.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> object(c.createWithInitialProperties(
+            { { "model", QVariant::fromValue(&model) } }));
+    QQmlDelegateModel *delegateModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(delegateModel);
+
+    // A flush that is attempted from within a changed handler must not leave
+    // the changes pending forever.
+    bool inserted = false;
+    connect(delegateModel->items(), &QQmlDelegateModelGroup::changed, delegateModel, [&]() {
+        if (inserted)
+            return;
+        inserted = true;
+        model.insertRows(model.rowCount(), 1);
+        QCoreApplication::sendPostedEvents(delegateModel, QEvent::UpdateLater);
+    });
+
+    QSignalSpy updatedSpy(delegateModel, &QQmlDelegateModel::modelUpdated);
+    const auto reportedInserts = [&]() {
+        int count = 0;
+        for (const QList<QVariant> &arguments : std::as_const(updatedSpy)) {
+            for (const QQmlChangeSet::Change &insert : arguments.at(0).value<QQmlChangeSet>().inserts())
+                count += insert.count;
+        }
+        return count;
+    };
+
+    model.insertRows(model.rowCount(), 1);
+    QTRY_COMPARE(reportedInserts(), 2);
+    QVERIFY(inserted);
+
+    model.insertRows(model.rowCount(), 1);
+    QTRY_COMPARE(reportedInserts(), 3);
+    QCOMPARE(delegateModel->count(), 5);
+}
+
 QTEST_MAIN(tst_QQmlDelegateModel)
 
 #include "tst_qqmldelegatemodel.moc"
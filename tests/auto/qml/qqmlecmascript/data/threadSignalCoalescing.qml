@@ -0,0 +1,12 @@
+import Qt.test 1.0
+import QtQml
+
+MyWorkerObject {
+    id: worker
+    property int evaluations: 0
+    property int observed: { ++evaluations; return worker.value }
+    property int ticks: 0
+    property string sequence
+    onTick: { ++ticks; sequence += "t" }
+    onValueChanged: sequence += "v"
+}
@@ -234,6 +234,83 @@ void MyWorkerObject::doIt()
     m_thread = new MyWorkerObjectThread(this);
 }
 
+class MyPublisherThread : public QThread
+{
+public:
+    MyPublisherThread(MyWorkerObject *o, int count) : QThread(o), o(o), count(count) { start(); }
+
+    void run() override {
+        for (int i = 1; i <= count; ++i) {
+            o->m_value.storeRelease(i);
+            emit o->valueChanged();
+        }
+    }
+
+    MyWorkerObject *o;
+    int count;
+};
+
+void MyWorkerObject::publish(int count)
+{
+    Q_ASSERT(!m_thread);
+    m_thread = new MyPublisherThread(this, count);
+}
+
+class MyTickerThread : public QThread
+{
+public:
+    MyTickerThread(MyWorkerObject *o, int count) : QThread(o), o(o), count(count) { start(); }
+
+    void run() override {
+        for (int i = 0; i < count; ++i)
+            emit o->tick();
+    }
+
+    MyWorkerObject *o;
+    int count;
+};
+
+void MyWorkerObject::tickRepeatedly(int count)
+{
+    startThread(new MyTickerThread(this, count));
+}
+
+class MyInterleavingThread : public QThread
+{
+public:
+    MyInterleavingThread(MyWorkerObject *o) : QThread(o), o(o) { start(); }
+
+    void run() override {
+        o->m_value.storeRelease(o->m_value.loadAcquire() + 1);
+        emit o->valueChanged();
+        emit o->tick();
+        o->m_value.storeRelease(o->m_value.loadAcquire() + 1);
+        emit o->valueChanged();
+    }
+
+    MyWorkerObject *o;
+};
+
+void MyWorkerObject::changeAroundTick()
+{
+    startThread(new MyInterleavingThread(this));
+}
+
+void MyWorkerObject::startThread(QThread *thread)
+{
+    if (m_thread) {
+        m_thread->wait();
+        delete m_thread;
+    }
+    m_thread = thread;
+}
+
+void MyWorkerObject::waitForThread()
+{
+    if (m_thread)
+        m_thread->wait();
+}
+
 class MyDateClass : public QObject
 {
     Q_OBJECT
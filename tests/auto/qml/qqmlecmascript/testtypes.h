@@ -4,6 +4,7 @@
 #define TESTTYPES_H
 
 #include <QtCore/qiterable.h>
+#include <QtCore/qatomic.h>
 #include <QtCore/qobject.h>
 #include <QtQml/qqml.h>
 #include <QtQml/qqmlexpression.h>
@@ -1736,17 +1737,31 @@ private:
 class MyWorkerObject : public QObject
 {
     Q_OBJECT
+    Q_PROPERTY(int value READ value NOTIFY valueChanged)
 public:
     ~MyWorkerObject();
 
+    int value() const { return m_value.loadAcquire(); }
+    void waitForThread();
+
 public Q_SLOTS:
     void doIt();
+    void publish(int count);
+    void tickRepeatedly(int count);
+    void changeAroundTick();
 
 Q_SIGNALS:
     void done(const QString &result);
+    void valueChanged();
+    void tick();
 
 private:
+    friend class MyPublisherThread;
+    friend class MyTickerThread;
+    friend class MyInterleavingThread;
+    void startThread(QThread *thread);
     QThread *m_thread = nullptr;
+    QAtomicInt m_value;
 };
 
 class MyUnregisteredEnumTypeObject : public QObject
@@ -311,6 +311,7 @@ private slots:
     void bindingSuppression();
     void signalEmitted();
     void threadSignal();
+    void threadSignalCoalescing();
     void qqmldataDestroyed();
     void secondAlias();
     void varAlias();
@@ -8255,6 +8256,43 @@ void tst_qqmlecmascript::threadSignal()
     }
 }
 
+void tst_qqmlecmascript::threadSignalCoalescing()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("threadSignalCoalescing.qml"));
+    QScopedPointer<QObject> object(c.create());
+    QVERIFY2(object, qPrintable(c.errorString()));
+    MyWorkerObject *worker = qobject_cast<MyWorkerObject *>(object.data());
+    QVERIFY(worker);
+    QCOMPARE(object->property("evaluations").toInt(), 1);
+
+    // All notifications are emitted before the event loop runs again.
+    // They are delivered as a single notification.
+    worker->publish(1000);
+    worker->waitForThread();
+    QTRY_COMPARE(object->property("observed").toInt(), 1000);
+    QCOMPARE(object->property("evaluations").toInt(), 2);
+    QCoreApplication::processEvents();
+    QCOMPARE(object->property("evaluations").toInt(), 2);
+
+    // Signals that are not the change signal of a property are each delivered.
+    worker->tickRepeatedly(1000);
+    worker->waitForThread();
+    QTRY_COMPARE(object->property("ticks").toInt(), 1000);
+    QCoreApplication::processEvents();
+    QCOMPARE(object->property("ticks").toInt(), 1000);
+
+    // A change signal emitted after another signal is not delivered ahead of it,
+    // even though an earlier change of the same property is still pending.
+    object->setProperty("sequence", QString());
+    worker->changeAroundTick();
+    worker->waitForThread();
+    QTRY_COMPARE(object->property("sequence").toString(), QStringLiteral("vtv"));
+    QCoreApplication::processEvents();
+    QCOMPARE(object->property("sequence").toString(), QStringLiteral("vtv"));
+    QCOMPARE(object->property("observed").toInt(), 1002);
+}
+
 // ensure that the qqmldata::destroyed() handler doesn't cause problems
 void tst_qqmlecmascript::qqmldataDestroyed()
 {
@@ -0,0 +1,30 @@
+import QtQml
+import QtQml.Models
+
+QtObject {
+    property ListModel model: ListModel {
+        ListElement { name: "initial"; value: -1 }
+    }
+
+    function rows(count, offset) {
+        var result = [];
+        for (var i = 0; i < count; ++i)
+            result.push({ name: "row" + (i + offset), value: i + offset });
+        return result;
+    }
+
+    function replaceRows(count, offset) {
+        model.replace(rows(count, offset));
+    }
+
+    function insertRows(index, count, offset) {
+        model.insert(index, rows(count, offset));
+    }
+
+    function replaceMixed() {
+        model.replace([{ name: "a", value: 1 },
+                       { value: 2, name: "b" },
+                       { name: "c", flag: true },
+                       { value: "oops" }]);
+    }
+}
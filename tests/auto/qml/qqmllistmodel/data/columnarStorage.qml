@@ -0,0 +1,30 @@
+import QtQml
+import QtQml.Models
+
+QtObject {
+    property ListModel model: ListModel {
+        columnarStorage: true
+    }
+
+    function fill() {
+        var rows = [];
+        for (var i = 0; i < 100; ++i) {
+            rows.push({
+                name: "row" + (i % 10),
+                value: i,
+                even: i % 2 === 0,
+                when: new Date(1000 * i),
+                link: new URL("https://www.qt.io/" + i)
+            });
+        }
+        model.append(rows);
+    }
+
+    function removeRows(index, count) {
+        model.remove(index, count);
+    }
+
+    function appendNested() {
+        model.append({ name: "nested", nested: [ { a: 1 } ] });
+    }
+}
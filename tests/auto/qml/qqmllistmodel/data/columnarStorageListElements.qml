@@ -0,0 +1,33 @@
+import QtQml
+import QtQml.Models
+
+QtObject {
+    property ListModel model: ListModel {
+        columnarStorage: true
+
+        ListElement { name: "Apple"; cost: 2.45; fresh: true; label: qsTr("fruit") }
+        ListElement { name: "Orange"; cost: 3.25; fresh: false; label: qsTr("citrus") }
+        ListElement {
+            name: "Banana"
+            cost: 1.95
+            fresh: true
+            label: qsTr("fruit")
+            attributes: [
+                ListElement { description: "Tropical" }
+            ]
+        }
+    }
+
+    function rollRows(count, keep) {
+        for (var i = 0; i < count; ++i) {
+            model.append({ name: "row" + i, label: "label" + i });
+            if (model.count > keep)
+                model.remove(0);
+        }
+    }
+
+    function overwrite(row, count) {
+        for (var i = 0; i < count; ++i)
+            model.setProperty(row, "name", "value" + i);
+    }
+}
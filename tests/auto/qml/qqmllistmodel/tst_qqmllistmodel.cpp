@@ -8,6 +8,7 @@
 #include <QtQuick/private/qquickrepeater_p.h>
 #include <QtQml/private/qqmlengine_p.h>
 #include <QtQmlModels/private/qqmllistmodel_p.h>
+#include <QtQmlModels/private/qqmllistmodel_p_p.h>
 #include <QtQml/private/qqmlexpression_p.h>
 #include <QtQml/private/qqmlsignalnames_p.h>
 #include <QQmlComponent>
@@ -123,6 +124,10 @@ private slots:
     void protectQObjectFromGC();
     void nestedLists();
     void deadModelData();
+    void columnarStorage();
+    void columnarStorageListElements();
+    void columnarStorageStringPool();
+    void bulkReplace();
 };
 
 bool tst_qqmllistmodel::compareVariantList(const QVariantList &testList, QVariant object)
@@ -2128,6 +2133,247 @@ void tst_qqmllistmodel::deadModelData()
     }
 }
 
+void tst_qqmllistmodel::columnarStorage()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("columnarStorage.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> o(component.create());
+    QVERIFY(!o.isNull());
+
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(o->property("model").value<QObject *>());
+    QVERIFY(model);
+    QVERIFY(model->columnarStorage());
+
+    QMetaObject::invokeMethod(o.data(), "fill");
+    QCOMPARE(model->count(), 100);
+
+    const QHash<int, QByteArray> roleNames = model->roleNames();
+    const int name = roleNames.key("name");
+    const int value = roleNames.key("value");
+    const int even = roleNames.key("even");
+    const int when = roleNames.key("when");
+    const int link = roleNames.key("link");
+    QCOMPARE(roleNames.size(), 5);
+
+    QCOMPARE(model->data(13, name).toString(), u"row3"_s);
+    QCOMPARE(model->data(13, value).toDouble(), 13.0);
+    QCOMPARE(model->data(13, even).toBool(), false);
+    QCOMPARE(model->data(14, even).toBool(), true);
+    QCOMPARE(model->data(13, when).toDateTime(), QDateTime::fromMSecsSinceEpoch(13000));
+    QCOMPARE(model->data(13, link).toUrl(), QUrl(u"https://www.qt.io/13"_s));
+
+    // Writes through get() and setProperty()
+    QSignalSpy dataChanged(model, &QAbstractItemModel::dataChanged);
+    QJSValue element = model->get(5);
+    element.setProperty("value", 42);
+    QCOMPARE(model->data(5, value).toDouble(), 42.0);
+    QCOMPARE(element.property("value").toInt(), 42);
+    QCOMPARE(dataChanged.size(), 1);
+
+    model->setProperty(6, u"name"_s, u"changed"_s);
+    QCOMPARE(model->data(6, name).toString(), u"changed"_s);
+    QCOMPARE(model->data(16, name).toString(), u"row6"_s);
+    QCOMPARE(dataChanged.size(), 2);
+
+    // Setting the same value again is not a change
+    model->setProperty(6, u"name"_s, u"changed"_s);
+    QCOMPARE(dataChanged.size(), 2);
+
+    // The object returned by get() follows its row
+    model->move(0, 90, 10);
+    QCOMPARE(model->data(0, value).toDouble(), 10.0);
+    QCOMPARE(model->data(95, value).toDouble(), 42.0);
+    QCOMPARE(element.property("value").toInt(), 42);
+    QCOMPARE(element.property("name").toString(), u"row5"_s);
+
+    model->move(95, 0, 1);
+    QCOMPARE(model->data(0, value).toDouble(), 42.0);
+    QCOMPARE(model->data(1, value).toDouble(), 10.0);
+
+    QMetaObject::invokeMethod(o.data(), "removeRows", Q_ARG(QVariant, 1), Q_ARG(QVariant, 10));
+    QCOMPARE(model->count(), 90);
+    QCOMPARE(model->data(1, value).toDouble(), 20.0);
+    QCOMPARE(element.property("value").toInt(), 42);
+
+    // Roles that need per-element objects are rejected
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression(".*Can't store role 'nested' in a ListModel with columnar storage"));
+    QMetaObject::invokeMethod(o.data(), "appendNested");
+    QCOMPARE(model->count(), 91);
+    QCOMPARE(model->data(90, name).toString(), u"nested"_s);
+    QCOMPARE(model->roleNames().size(), 5);
+
+    model->clear();
+    QCOMPARE(model->count(), 0);
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression(".*unable to change the storage of this model as it is not empty"));
+    model->setColumnarStorage(false);
+    QVERIFY(model->columnarStorage());
+}
+
+void tst_qqmllistmodel::columnarStorageListElements()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("columnarStorageListElements.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    // The storage mode is known before the declared elements are added.
+    QTest::failOnWarning(QRegularExpression(".*unable to change the storage of this model.*"));
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression(".*ListElement: nested lists are not supported with columnar storage"));
+    QScopedPointer<QObject> o(component.create());
+    QVERIFY(!o.isNull());
+
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(o->property("model").value<QObject *>());
+    QVERIFY(model);
+    QVERIFY(model->columnarStorage());
+    QVERIFY(model->listModel()->isColumnar());
+    QCOMPARE(model->count(), 3);
+
+    const QHash<int, QByteArray> roleNames = model->roleNames();
+    const int name = roleNames.key("name");
+    const int cost = roleNames.key("cost");
+    const int fresh = roleNames.key("fresh");
+    const int label = roleNames.key("label");
+    QCOMPARE(roleNames.size(), 4);
+
+    QCOMPARE(model->data(0, name).toString(), u"Apple"_s);
+    QCOMPARE(model->data(1, cost).toDouble(), 3.25);
+    QCOMPARE(model->data(1, fresh).toBool(), false);
+    QCOMPARE(model->data(2, fresh).toBool(), true);
+
+    // Translations are resolved when the elements are added
+    QCOMPARE(model->data(0, label).toString(), u"fruit"_s);
+    QCOMPARE(model->data(1, label).toString(), u"citrus"_s);
+
+    // The nested list was dropped, the rest of its element was kept
+    QCOMPARE(model->data(2, name).toString(), u"Banana"_s);
+    QCOMPARE(model->data(2, cost).toDouble(), 1.95);
+}
+
+void tst_qqmllistmodel::columnarStorageStringPool()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("columnarStorageListElements.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression(".*ListElement: nested lists are not supported with columnar storage"));
+    QScopedPointer<QObject> o(component.create());
+    QVERIFY(!o.isNull());
+
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(o->property("model").value<QObject *>());
+    QVERIFY(model);
+    const ListColumns *columns = model->listModel()->columns();
+    QVERIFY(columns);
+
+    // "Apple", "Orange", "Banana", "fruit" and "citrus"
+    QCOMPARE(columns->pooledStringCount(), 5);
+
+    // Strings of removed rows are released while the model never becomes empty.
+    QMetaObject::invokeMethod(o.data(), "rollRows", Q_ARG(QVariant, 1000), Q_ARG(QVariant, 10));
+    QCOMPARE(model->count(), 10);
+    QCOMPARE(columns->pooledStringCount(), 20);
+    const int name = model->roleNames().key("name");
+    QCOMPARE(model->data(0, name).toString(), u"row990"_s);
+    QCOMPARE(model->data(9, name).toString(), u"row999"_s);
+
+    // So are overwritten strings.
+    QMetaObject::invokeMethod(o.data(), "overwrite", Q_ARG(QVariant, 0), Q_ARG(QVariant, 1000));
+    QCOMPARE(columns->pooledStringCount(), 20);
+    QCOMPARE(model->data(0, name).toString(), u"value999"_s);
+
+    // Strings still referenced by other rows stay in the pool.
+    model->setProperty(1, u"name"_s, u"row992"_s);
+    QCOMPARE(columns->pooledStringCount(), 19);
+    model->setProperty(2, u"name"_s, u"other"_s);
+    QCOMPARE(columns->pooledStringCount(), 20);
+    QCOMPARE(model->data(1, name).toString(), u"row992"_s);
+    QCOMPARE(model->data(2, name).toString(), u"other"_s);
+
+    model->clear();
+    QCOMPARE(columns->pooledStringCount(), 0);
+}
+
+void tst_qqmllistmodel::bulkReplace()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("bulkReplace.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> o(component.create());
+    QVERIFY(!o.isNull());
+
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(o->property("model").value<QObject *>());
+    QVERIFY(model);
+    QCOMPARE(model->count(), 1);
+
+    QSignalSpy reset(model, &QAbstractItemModel::modelReset);
+    QSignalSpy inserted(model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removed(model, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy countChanged(model, &QQmlListModel::countChanged);
+
+    // The whole content is swapped with a single reset
+    QMetaObject::invokeMethod(o.data(), "replaceRows", Q_ARG(QVariant, 1000), Q_ARG(QVariant, 0));
+    QCOMPARE(model->count(), 1000);
+    QCOMPARE(reset.size(), 1);
+    QCOMPARE(inserted.size(), 0);
+    QCOMPARE(removed.size(), 0);
+    QCOMPARE(countChanged.size(), 1);
+
+    const int name = roleFromName(model, u"name"_s);
+    const int value = roleFromName(model, u"value"_s);
+    QCOMPARE(model->data(0, name).toString(), u"row0"_s);
+    QCOMPARE(model->data(999, value).toDouble(), 999.0);
+
+    // Same number of rows: no count change
+    QMetaObject::invokeMethod(o.data(), "replaceRows", Q_ARG(QVariant, 1000), Q_ARG(QVariant, 5));
+    QCOMPARE(reset.size(), 2);
+    QCOMPARE(countChanged.size(), 1);
+    QCOMPARE(model->data(0, value).toDouble(), 5.0);
+
+    // An array insert is one rowsInserted, and keeps get() objects on their rows
+    QJSValue element = model->get(10);
+    QMetaObject::invokeMethod(o.data(), "insertRows", Q_ARG(QVariant, 5), Q_ARG(QVariant, 20),
+                              Q_ARG(QVariant, 2000));
+    QCOMPARE(inserted.size(), 1);
+    QCOMPARE(inserted.first().at(1).toInt(), 5);
+    QCOMPARE(inserted.first().at(2).toInt(), 24);
+    QCOMPARE(model->count(), 1020);
+    QCOMPARE(model->data(5, value).toDouble(), 2000.0);
+    QCOMPARE(model->data(30, value).toDouble(), 15.0);
+    element.setProperty("value", 42);
+    QCOMPARE(model->data(30, value).toDouble(), 42.0);
+
+    // Rows of different shapes still end up in the right roles
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression(".*Can't assign to existing role 'value' of different type \\[String -> Number\\]"));
+    QMetaObject::invokeMethod(o.data(), "replaceMixed");
+    QCOMPARE(model->count(), 4);
+    const int flag = roleFromName(model, u"flag"_s);
+    QCOMPARE(model->data(1, name).toString(), u"b"_s);
+    QCOMPARE(model->data(1, value).toDouble(), 2.0);
+    QCOMPARE(model->data(2, flag).toBool(), true);
+
+    // The C++ entry points behave the same
+    QList<QVariantMap> rows;
+    for (int i = 0; i < 50; ++i)
+        rows.append({ { u"name"_s, u"cpp%1"_s.arg(i) }, { u"value"_s, double(i) } });
+
+    model->replace(rows);
+    QCOMPARE(model->count(), 50);
+    QCOMPARE(reset.size(), 4);
+    QCOMPARE(model->data(49, name).toString(), u"cpp49"_s);
+
+    model->insert(50, rows);
+    QCOMPARE(model->count(), 100);
+    QCOMPARE(inserted.size(), 2);
+    QCOMPARE(model->data(75, value).toDouble(), 25.0);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*insert: index 101 out of range"));
+    model->insert(101, rows);
+    QCOMPARE(model->count(), 100);
+}
+
 QTEST_MAIN(tst_qqmllistmodel)
 
 #include "tst_qqmllistmodel.moc"
@@ -81,7 +81,9 @@ private slots:
     void worker_remove_list();
     void dynamic_role_data();
     void dynamic_role();
+    void columnar_sync();
     void correctMoves();
+    void journaled_sync();
 };
 
 bool tst_qqmllistmodelworkerscript::compareVariantList(const QVariantList &testList, QVariant object)
@@ -819,6 +821,73 @@ void tst_qqmllistmodelworkerscript::dynamic_role()
     qApp->processEvents();
 }
 
+void tst_qqmllistmodelworkerscript::columnar_sync()
+{
+    QQmlListModel model;
+    model.setColumnarStorage(true);
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("model.qml"));
+    std::unique_ptr<QQuickItem> item = createWorkerTest(&engine, &component, &model);
+    QVERIFY(item);
+
+    RUNEVAL(item.get(), "for (var i = 0; i < 10; ++i) model.append({roleA: i, roleB: 'b' + i})");
+    const int roleA = roleFromName(&model, "roleA");
+    const int roleB = roleFromName(&model, "roleB");
+    QVERIFY(roleA >= 0);
+    QVERIFY(roleB >= 0);
+
+    QSignalSpy reset(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy dataChanged(&model, &QAbstractItemModel::dataChanged);
+    QSignalSpy inserted(&model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removed(&model, &QAbstractItemModel::rowsRemoved);
+
+    // Only the rows and roles that differ are reported
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList({ QStringLiteral("setProperty(3, 'roleA', -3)"),
+                                          QStringLiteral("setProperty(7, 'roleB', '')") }))));
+    waitForWorker(item.get());
+    QCOMPARE(dataChanged.size(), 2);
+    QCOMPARE(dataChanged.at(0).at(0).value<QModelIndex>().row(), 3);
+    QCOMPARE(dataChanged.at(0).at(2).value<QVector<int>>(), QVector<int>({ roleA }));
+    QCOMPARE(dataChanged.at(1).at(0).value<QModelIndex>().row(), 7);
+    QCOMPARE(dataChanged.at(1).at(2).value<QVector<int>>(), QVector<int>({ roleB }));
+    QCOMPARE(model.data(3, roleA).toInt(), -3);
+
+    // An empty string is not the same as an unset role
+    QVERIFY(!model.data(7, roleB).toString().isNull());
+    QVERIFY(model.data(7, roleB).toString().isEmpty());
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList(QStringLiteral("setProperty(7, 'roleB', undefined)")))));
+    waitForWorker(item.get());
+    QCOMPARE(dataChanged.size(), 3);
+    QVERIFY(model.data(7, roleB).toString().isNull());
+
+    // Rows are appended and removed at the end instead of resetting the model
+    dataChanged.clear();
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList(QStringLiteral("append([{roleA: 10}, {roleA: 11}])")))));
+    waitForWorker(item.get());
+    QCOMPARE(model.count(), 12);
+    QCOMPARE(inserted.size(), 1);
+    QCOMPARE(inserted.first().at(1).toInt(), 10);
+    QCOMPARE(inserted.first().at(2).toInt(), 11);
+    QCOMPARE(dataChanged.size(), 0);
+    QCOMPARE(model.data(11, roleA).toInt(), 11);
+
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList(QStringLiteral("remove(8, 4)")))));
+    waitForWorker(item.get());
+    QCOMPARE(model.count(), 8);
+    QCOMPARE(removed.size(), 1);
+    QCOMPARE(removed.first().at(1).toInt(), 8);
+    QCOMPARE(removed.first().at(2).toInt(), 11);
+    QCOMPARE(dataChanged.size(), 0);
+    QCOMPARE(reset.size(), 0);
+
+    item.reset();
+    qApp->processEvents();
+}
+
 void tst_qqmllistmodelworkerscript::correctMoves()
 {
     QQmlEngine engine;
@@ -835,6 +904,112 @@ void tst_qqmllistmodelworkerscript::correctMoves()
     QTRY_VERIFY(check());
 }
 
+void tst_qqmllistmodelworkerscript::journaled_sync()
+{
+    QQmlListModel model;
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("model.qml"));
+    std::unique_ptr<QQuickItem> item = createWorkerTest(&engine, &component, &model);
+    QVERIFY(item);
+
+    RUNEVAL(item.get(), "for (var i = 0; i < 100; ++i) model.append({roleA: i, roleB: 'b' + i})");
+    const int roleA = roleFromName(&model, "roleA");
+    QVERIFY(roleA >= 0);
+
+    QSignalSpy dataChanged(&model, &QAbstractItemModel::dataChanged);
+    QSignalSpy inserted(&model, &QAbstractItemModel::rowsInserted);
+
+    // Only the row the worker touched is reported
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList(QStringLiteral("get(42).roleA = -42")))));
+    waitForWorker(item.get());
+    QCOMPARE(model.data(42, roleA).toInt(), -42);
+    QCOMPARE(dataChanged.size(), 1);
+    QCOMPARE(dataChanged.first().at(0).value<QModelIndex>().row(), 42);
+
+    // Nothing changed, nothing to report
+    dataChanged.clear();
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList(QStringLiteral("count")))));
+    waitForWorker(item.get());
+    QCOMPARE(dataChanged.size(), 0);
+
+    // Structural changes still end up in the right place
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList({ QStringLiteral("insert(10, {roleA: 1000})"),
+                                          QStringLiteral("setProperty(60, 'roleA', -60)") }))));
+    waitForWorker(item.get());
+    QCOMPARE(model.count(), 101);
+    QCOMPARE(inserted.size(), 1);
+    QCOMPARE(model.data(10, roleA).toInt(), 1000);
+    QCOMPARE(model.data(43, roleA).toInt(), -42);
+    QCOMPARE(model.data(60, roleA).toInt(), -60);
+    QCOMPARE(model.data(61, roleA).toInt(), 60);
+
+    // Changes made on the main thread meanwhile are overwritten by the
+    // worker's copy, as before
+    model.setProperty(0, "roleA", 500);
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList(QStringLiteral("setProperty(1, 'roleA', -1)")))));
+    waitForWorker(item.get());
+    QCOMPARE(model.data(0, roleA).toInt(), 0);
+    QCOMPARE(model.data(1, roleA).toInt(), -1);
+
+    // Insertions, removals and moves are replayed as the worker made them,
+    // rather than by comparing every row
+    inserted.clear();
+    dataChanged.clear();
+    QSignalSpy removed(&model, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy moved(&model, &QAbstractItemModel::rowsMoved);
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList({ QStringLiteral("append({roleA: 200})"),
+                                          QStringLiteral("append({roleA: 201})"),
+                                          QStringLiteral("append({roleA: 202})"),
+                                          QStringLiteral("remove(0)"),
+                                          QStringLiteral("remove(0)"),
+                                          QStringLiteral("move(0, 50, 1)"),
+                                          QStringLiteral("setProperty(10, 'roleA', -10)") }))));
+    waitForWorker(item.get());
+    QCOMPARE(model.count(), 102);
+    QCOMPARE(inserted.size(), 1);
+    QCOMPARE(inserted.first().at(1).toInt(), 101);
+    QCOMPARE(inserted.first().at(2).toInt(), 103);
+    QCOMPARE(removed.size(), 1);
+    QCOMPARE(removed.first().at(1).toInt(), 0);
+    QCOMPARE(removed.first().at(2).toInt(), 1);
+    QCOMPARE(moved.size(), 1);
+    QCOMPARE(dataChanged.size(), 1);
+    QCOMPARE(dataChanged.first().at(0).value<QModelIndex>().row(), 10);
+    QCOMPARE(model.data(0, roleA).toInt(), 3);
+    QCOMPARE(model.data(10, roleA).toInt(), -10);
+    QCOMPARE(model.data(50, roleA).toInt(), 2);
+    QCOMPARE(model.data(99, roleA).toInt(), 200);
+    QCOMPARE(model.data(101, roleA).toInt(), 202);
+
+    // Inserted rows are filled in from where they ended up, even when they
+    // were moved or removed again before the sync
+    inserted.clear();
+    removed.clear();
+    moved.clear();
+    QVERIFY(QMetaObject::invokeMethod(item.get(), "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList({ QStringLiteral("insert(5, {roleA: 300})"),
+                                          QStringLiteral("insert(6, {roleA: 301})"),
+                                          QStringLiteral("move(5, 0, 1)"),
+                                          QStringLiteral("remove(6)") }))));
+    waitForWorker(item.get());
+    QCOMPARE(model.count(), 103);
+    QCOMPARE(inserted.size(), 1);
+    QCOMPARE(moved.size(), 1);
+    QCOMPARE(removed.size(), 1);
+    QCOMPARE(model.data(0, roleA).toInt(), 300);
+    QCOMPARE(model.data(1, roleA).toInt(), 3);
+    QCOMPARE(model.data(6, roleA).toInt(), 8);
+    QCOMPARE(model.data(7, roleA).toInt(), 9);
+
+    item.reset();
+    qApp->processEvents();
+}
+
 QTEST_MAIN(tst_qqmllistmodelworkerscript)
 
 #include "tst_qqmllistmodelworkerscript.moc"
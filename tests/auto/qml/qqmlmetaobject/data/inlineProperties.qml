@@ -0,0 +1,23 @@
+import QtQuick 2.0
+
+QtObject {
+    property int intProperty: 19
+    property real realProperty: 2.5
+    property bool boolProperty: true
+    property string stringProperty: "foo"
+    property url urlProperty: "http://www.qt.io/"
+    property color colorProperty: "#ff0000"
+    property var varProperty: intProperty + 1
+
+    property string summary: stringProperty + ":" + intProperty + ":" + realProperty + ":"
+                             + boolProperty + ":" + colorProperty
+
+    function bump() {
+        intProperty += 1
+        realProperty *= 2
+        boolProperty = !boolProperty
+        stringProperty = stringProperty + "bar"
+        urlProperty = "http://www.qt.io/bump"
+        colorProperty = "#00ff00"
+    }
+}
@@ -4,6 +4,7 @@
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
 #include <QtCore/QScopedPointer>
+#include <QtGui/QColor>
 #include <QtQml/qqmlcomponent.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQuickTestUtils/private/qmlutils_p.h>
@@ -30,6 +31,7 @@ private slots:
     void property();
     void method_data();
     void method();
+    void inlineProperties();
 
 private:
     MyQmlObject myQmlObject;
@@ -363,6 +365,49 @@ void tst_QQmlMetaObject::method()
     QCOMPARE(method.returnType(), returnType);
 }
 
+void tst_QQmlMetaObject::inlineProperties()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("inlineProperties.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object, qPrintable(component.errorString()));
+
+    QCOMPARE(object->property("intProperty"), QVariant(19));
+    QCOMPARE(object->property("realProperty"), QVariant(2.5));
+    QCOMPARE(object->property("boolProperty"), QVariant(true));
+    QCOMPARE(object->property("stringProperty"), QVariant(QStringLiteral("foo")));
+    QCOMPARE(object->property("urlProperty"), QVariant(QUrl(QStringLiteral("http://www.qt.io/"))));
+    QCOMPARE(object->property("colorProperty").value<QColor>(), QColor(Qt::red));
+    QCOMPARE(object->property("varProperty"), QVariant(20));
+    QCOMPARE(object->property("summary"), QVariant(QStringLiteral("foo:19:2.5:true:#ff0000")));
+
+    QSignalSpy intSpy(object.get(), SIGNAL(intPropertyChanged()));
+    QSignalSpy colorSpy(object.get(), SIGNAL(colorPropertyChanged()));
+
+    // Writing the same value again must not notify.
+    QVERIFY(object->setProperty("intProperty", 19));
+    QVERIFY(object->setProperty("colorProperty", QColor(Qt::red)));
+    QCOMPARE(intSpy.size(), 0);
+    QCOMPARE(colorSpy.size(), 0);
+
+    QVERIFY(object->setProperty("intProperty", 41));
+    QCOMPARE(intSpy.size(), 1);
+    QCOMPARE(object->property("varProperty"), QVariant(42));
+
+    QMetaObject::invokeMethod(object.get(), "bump");
+    QCOMPARE(intSpy.size(), 2);
+    QCOMPARE(colorSpy.size(), 1);
+    QCOMPARE(object->property("intProperty"), QVariant(42));
+    QCOMPARE(object->property("realProperty"), QVariant(5.0));
+    QCOMPARE(object->property("boolProperty"), QVariant(false));
+    QCOMPARE(object->property("stringProperty"), QVariant(QStringLiteral("foobar")));
+    QCOMPARE(object->property("urlProperty"),
+             QVariant(QUrl(QStringLiteral("http://www.qt.io/bump"))));
+    QCOMPARE(object->property("colorProperty").value<QColor>(), QColor(Qt::green));
+    QCOMPARE(object->property("summary"),
+             QVariant(QStringLiteral("foobar:42:5:false:#00ff00")));
+}
+
 QTEST_MAIN(tst_QQmlMetaObject)
 
 #include "tst_qqmlmetaobject.moc"
@@ -0,0 +1,38 @@
+import QtQml
+
+QtObject {
+    property int a: 0
+    property int b: 0
+    property var log: []
+    property int sum: {
+        log.push(a + b);
+        return a + b;
+    }
+
+    property QtObject other: QtObject {
+        property int c: 0
+    }
+    property int totalEvaluations: 0
+    property int total: {
+        ++totalEvaluations;
+        return sum + other.c;
+    }
+    property int scaledEvaluations: 0
+    property int scaled: {
+        ++scaledEvaluations;
+        return total * a;
+    }
+
+    property var handlerLog: []
+    onAChanged: handlerLog.push(["a", a, b, sum, total])
+    onTotalChanged: handlerLog.push(["total", a, b, sum, total])
+
+    signal pinged(int value)
+    property var pingLog: []
+    onPinged: (value) => pingLog.push(value)
+    property int pinger: {
+        pinged(a);
+        pinged(a + b);
+        return 0;
+    }
+}
@@ -233,6 +233,12 @@ private slots:
 
     void connectAliasPropertySignalWithCppSlot();
 
+    void propertyTransaction();
+    void propertyTransactionChainedBindings();
+    void propertyTransactionSignalHandlers();
+    void propertyTransactionOtherSignals();
+    void propertyTransactionMove();
+
 private:
     QQmlEngine engine;
 };
@@ -2689,6 +2695,174 @@ void tst_qqmlproperty::connectAliasPropertySignalWithCppSlot()
     QVERIFY(signalHandler.triggered());
 }
 
+void tst_qqmlproperty::propertyTransaction()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("propertyTransaction.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(!root.isNull());
+    QObject *other = root->property("other").value<QObject *>();
+    QVERIFY(other);
+
+    const auto log = [&]() {
+        return root->property("log").value<QJSValue>().toVariant().toList();
+    };
+    QCOMPARE(log(), QVariantList({ 0 }));
+
+    QQmlPropertyTransaction transaction;
+    QVERIFY(!transaction.isActive());
+    transaction.begin();
+    QVERIFY(transaction.isActive());
+    QVERIFY(transaction.write(root.data(), "a", 1));
+    QVERIFY(transaction.write(root.data(), "b", 5));
+    QVERIFY(transaction.write(root.data(), "b", 2));
+    QVERIFY(transaction.write(other, "c", 10));
+    QVERIFY(!transaction.write(root.data(), "doesNotExist", 1));
+
+    // Nothing is applied before the commit
+    QCOMPARE(root->property("a").toInt(), 0);
+    QCOMPARE(root->property("total").toInt(), 0);
+
+    QVERIFY(transaction.commit());
+    QVERIFY(!transaction.isActive());
+    QCOMPARE(root->property("sum").toInt(), 3);
+    QCOMPARE(root->property("total").toInt(), 13);
+
+    // The binding depending on both a and b ran once, with both values in place
+    QCOMPARE(log(), QVariantList({ 0, 3 }));
+
+    transaction.begin();
+    QVERIFY(transaction.write(root.data(), "a", 100));
+    transaction.discard();
+    QVERIFY(!transaction.isActive());
+    QVERIFY(!transaction.commit());
+    QCOMPARE(root->property("a").toInt(), 1);
+
+    // Inactive transactions write through immediately
+    QVERIFY(transaction.write(root.data(), "a", 4));
+    QCOMPARE(root->property("sum").toInt(), 6);
+    QCOMPARE(log(), QVariantList({ 0, 3, 6 }));
+}
+
+void tst_qqmlproperty::propertyTransactionChainedBindings()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("propertyTransaction.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(!root.isNull());
+    QObject *other = root->property("other").value<QObject *>();
+    QVERIFY(other);
+
+    const auto evaluations = [&](const char *name) { return root->property(name).toInt(); };
+    QCOMPARE(evaluations("totalEvaluations"), 1);
+    QCOMPARE(evaluations("scaledEvaluations"), 1);
+
+    // "total" depends on "c" directly and on "a" and "b" through "sum". "scaled" depends
+    // on "a" directly and through "total". Each of them is evaluated once.
+    QQmlPropertyTransaction transaction;
+    transaction.begin();
+    QVERIFY(transaction.write(other, "c", 10));
+    QVERIFY(transaction.write(root.data(), "a", 1));
+    QVERIFY(transaction.write(root.data(), "b", 2));
+    QVERIFY(transaction.commit());
+
+    QCOMPARE(root->property("total").toInt(), 13);
+    QCOMPARE(root->property("scaled").toInt(), 13);
+    QCOMPARE(evaluations("totalEvaluations"), 2);
+    QCOMPARE(evaluations("scaledEvaluations"), 2);
+    QCOMPARE(root->property("log").value<QJSValue>().toVariant().toList(), QVariantList({ 0, 3 }));
+}
+
+void tst_qqmlproperty::propertyTransactionSignalHandlers()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("propertyTransaction.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(!root.isNull());
+    QObject *other = root->property("other").value<QObject *>();
+    QVERIFY(other);
+
+    const auto handlerLog = [&]() {
+        return root->property("handlerLog").value<QJSValue>().toVariant().toList();
+    };
+    QVERIFY(handlerLog().isEmpty());
+
+    QQmlPropertyTransaction transaction;
+    transaction.begin();
+    QVERIFY(transaction.write(root.data(), "a", 1));
+    QVERIFY(transaction.write(root.data(), "b", 2));
+    QVERIFY(transaction.write(other, "c", 10));
+    QVERIFY(transaction.commit());
+
+    // Handlers run once each, after all writes and bindings, and only see the final values.
+    const QVariantList final = { 1, 2, 3, 13 };
+    QCOMPARE(handlerLog(), QVariantList({ QVariantList { QStringLiteral("a") } + final,
+                                          QVariantList { QStringLiteral("total") } + final }));
+
+    // Outside of a transaction, handlers run as the signals are emitted.
+    root->setProperty("a", 2);
+    QCOMPARE(handlerLog().size(), 4);
+}
+
+void tst_qqmlproperty::propertyTransactionOtherSignals()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("propertyTransaction.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(!root.isNull());
+
+    const auto pingLog = [&]() {
+        return root->property("pingLog").value<QJSValue>().toVariant().toList();
+    };
+    const qsizetype initialPings = pingLog().size();
+
+    QQmlPropertyTransaction transaction;
+    transaction.begin();
+    QVERIFY(transaction.write(root.data(), "a", 1));
+    QVERIFY(transaction.write(root.data(), "b", 2));
+    QVERIFY(transaction.commit());
+
+    // Signals that are not the change signal of a written property are not coalesced.
+    // Their handlers run once per emission, in order, with the arguments of each.
+    const QVariantList pings = pingLog();
+    QCOMPARE(pings.size(), initialPings + 2);
+    QCOMPARE(pings.mid(initialPings), QVariantList({ 1, 3 }));
+}
+
+void tst_qqmlproperty::propertyTransactionMove()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("propertyTransaction.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(!root.isNull());
+
+    QQmlPropertyTransaction transaction;
+    transaction.begin();
+    QVERIFY(transaction.write(root.data(), "a", 1));
+
+    QQmlPropertyTransaction moved(std::move(transaction));
+    QVERIFY(moved.isActive());
+
+    QQmlPropertyTransaction assigned;
+    assigned = std::move(moved);
+    QVERIFY(assigned.isActive());
+    QCOMPARE(root->property("a").toInt(), 0);
+    QVERIFY(assigned.commit());
+    QCOMPARE(root->property("a").toInt(), 1);
+
+    QQmlPropertyTransaction first;
+    QQmlPropertyTransaction second;
+    second.begin();
+    first.swap(second);
+    QVERIFY(first.isActive());
+    QVERIFY(!second.isActive());
+}
+
 QTEST_MAIN(tst_qqmlproperty)
 
 #include "tst_qqmlproperty.moc"
@@ -10,6 +10,7 @@
 #include <private/qqmlcontextdata_p.h>
 #include <private/qqmlpropertycachecreator_p.h>
 #include <QCryptographicHash>
+#include <QThread>
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 
 class tst_qqmlpropertycache : public QQmlDataTest
@@ -37,6 +38,10 @@ private slots:
     void rejectOverriddenFinal();
     void overriddenSignals();
     void duplicateIdsAndGeneralizedGroupProperties();
+    void lookupTableOverriddenProperties();
+    void lookupTableLinkedParents();
+    void lookupTableMissingNames();
+    void lookupTableBuiltOnOtherThread();
 
 private:
     QQmlEngine engine;
@@ -180,6 +185,24 @@ Q_SIGNALS:
     void signalA();
 };
 
+class OverridingObject : public DerivedObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int propertyB READ propertyB NOTIFY propertyBChanged)
+    Q_PROPERTY(int propertyF READ propertyF CONSTANT)
+public:
+    OverridingObject(QObject *parent = nullptr) : DerivedObject(parent) {}
+
+    int propertyB() const { return 1; }
+    int propertyF() const { return 2; }
+
+public Q_SLOTS:
+    void slotA() {}
+
+Q_SIGNALS:
+    void propertyBChanged();
+};
+
 const QQmlPropertyData *cacheProperty(const QQmlPropertyCache::ConstPtr &cache, const char *name)
 {
     return cache->property(QLatin1String(name), nullptr, nullptr);
@@ -789,4 +812,119 @@ void tst_qqmlpropertycache::duplicateIdsAndGeneralizedGroupProperties()
     QScopedPointer<QObject> o(c.create());
 }
 
+void tst_qqmlpropertycache::lookupTableOverriddenProperties()
+{
+    OverridingObject object;
+    const QMetaObject *metaObject = object.metaObject();
+
+    QQmlPropertyCache::ConstPtr baseCache
+            = QQmlPropertyCache::createStandalone(&BaseObject::staticMetaObject);
+    QQmlPropertyCache::ConstPtr derivedCache
+            = baseCache->copyAndAppend(&DerivedObject::staticMetaObject, QTypeRevision());
+    QQmlPropertyCache::ConstPtr cache
+            = derivedCache->copyAndAppend(metaObject, QTypeRevision());
+
+    // The most derived property or method wins, in the derived cache only.
+    const QQmlPropertyData *data;
+    QVERIFY((data = cacheProperty(cache, "propertyB")));
+    QCOMPARE(data->coreIndex(), metaObject->indexOfProperty("propertyB"));
+    QCOMPARE(data->propType(), QMetaType::fromType<int>());
+    QVERIFY((data = cacheProperty(cache, "slotA")));
+    QVERIFY(data->isFunction());
+    QCOMPARE(data->coreIndex(), metaObject->indexOfMethod("slotA()"));
+
+    QVERIFY((data = cacheProperty(baseCache, "propertyB")));
+    QCOMPARE(data->coreIndex(), BaseObject::staticMetaObject.indexOfProperty("propertyB"));
+    QCOMPARE(data->propType(), QMetaType::fromType<QString>());
+    QVERIFY((data = cacheProperty(baseCache, "slotA")));
+    QCOMPARE(data->coreIndex(), BaseObject::staticMetaObject.indexOfMethod("slotA()"));
+
+    // Querying again uses the table built by the first lookup.
+    QVERIFY((data = cacheProperty(cache, "propertyB")));
+    QCOMPARE(data->coreIndex(), metaObject->indexOfProperty("propertyB"));
+}
+
+void tst_qqmlpropertycache::lookupTableLinkedParents()
+{
+    OverridingObject object;
+    const QMetaObject *metaObject = object.metaObject();
+
+    QQmlPropertyCache::ConstPtr baseCache
+            = QQmlPropertyCache::createStandalone(&BaseObject::staticMetaObject);
+    // Build the parent's table before the derived caches link to its names.
+    QVERIFY(cacheProperty(baseCache, "propertyA"));
+    QQmlPropertyCache::ConstPtr derivedCache
+            = baseCache->copyAndAppend(&DerivedObject::staticMetaObject, QTypeRevision());
+    QQmlPropertyCache::ConstPtr cache
+            = derivedCache->copyAndAppend(metaObject, QTypeRevision());
+
+    // Every property and method is found through the most derived cache, whichever cache
+    // in the chain declared it.
+    for (int i = 0; i < metaObject->propertyCount(); ++i) {
+        const QMetaProperty property = metaObject->property(i);
+        const QQmlPropertyData *data = cacheProperty(cache, property.name());
+        QVERIFY2(data, property.name());
+        QCOMPARE(data->coreIndex(), metaObject->indexOfProperty(property.name()));
+    }
+    for (int i = 0; i < metaObject->methodCount(); ++i) {
+        const QMetaMethod method = metaObject->method(i);
+        if (method.access() == QMetaMethod::Private)
+            continue;
+        const QQmlPropertyData *data = cacheProperty(cache, method.name().constData());
+        QVERIFY2(data, method.name().constData());
+        QCOMPARE(metaObject->method(data->coreIndex()).name(), method.name());
+    }
+
+    // Names of derived caches are not visible through their parents.
+    QVERIFY(cacheProperty(derivedCache, "propertyC"));
+    QVERIFY(!cacheProperty(derivedCache, "propertyF"));
+    QVERIFY(!cacheProperty(baseCache, "propertyC"));
+    QVERIFY(!cacheProperty(baseCache, "signalB"));
+}
+
+void tst_qqmlpropertycache::lookupTableMissingNames()
+{
+    QQmlPropertyCache::ConstPtr parentCache
+            = QQmlPropertyCache::createStandalone(&BaseObject::staticMetaObject);
+    QQmlPropertyCache::ConstPtr cache
+            = parentCache->copyAndAppend(&DerivedObject::staticMetaObject, QTypeRevision());
+
+    QVERIFY(!cacheProperty(cache, ""));
+    QVERIFY(!cacheProperty(cache, "notAProperty"));
+    QVERIFY(!cacheProperty(cache, "property"));
+    QVERIFY(!cacheProperty(cache, "propertyAA"));
+    QVERIFY(!cacheProperty(cache, "PropertyA"));
+    QVERIFY(cacheProperty(cache, "propertyA"));
+
+    // Missing names are reported the same way for QString keys.
+    QVERIFY(!cache->property(QStringLiteral("propertyZ"), nullptr, nullptr));
+    QVERIFY(cache->property(QStringLiteral("propertyD"), nullptr, nullptr));
+
+    // A cache without a parent only knows its own names.
+    QQmlPropertyCache::ConstPtr emptyCache
+            = QQmlPropertyCache::createStandalone(&QObject::staticMetaObject);
+    QVERIFY(!cacheProperty(emptyCache, "propertyA"));
+    QVERIFY(cacheProperty(emptyCache, "objectName"));
+}
+
+void tst_qqmlpropertycache::lookupTableBuiltOnOtherThread()
+{
+    QQmlPropertyCache::Ptr cache = QQmlPropertyCache::createStandalone(&BaseObject::staticMetaObject);
+    const QQmlPropertyCache::ConstPtr constCache(cache.data());
+
+    // A type loader thread may do the first lookup by name...
+    bool found = false;
+    QScopedPointer<QThread> thread(QThread::create([&]() {
+        found = cacheProperty(constCache, "propertyA") != nullptr;
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+    QVERIFY(found);
+
+    // ...and the cache may then be modified on the GUI thread, which drops the table.
+    cache->invalidate(&BaseObject::staticMetaObject);
+    QVERIFY(cacheProperty(constCache, "propertyA"));
+    QVERIFY(!cacheProperty(constCache, "propertyC"));
+}
+
 QTEST_MAIN(tst_qqmlpropertycache)
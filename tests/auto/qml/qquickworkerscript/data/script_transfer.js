@@ -0,0 +1,8 @@
+WorkerScript.onMessage = function(message) {
+    var bytes = new Uint8Array(message.buffer);
+    var sum = 0;
+    for (var i = 0; i < bytes.length; ++i)
+        sum += bytes[i];
+    WorkerScript.sendMessage({ "buffer": message.buffer, "again": message.buffer, "sum": sum,
+                               "same": message.again === message.buffer }, [ message.buffer ]);
+}
@@ -0,0 +1,46 @@
+import QtQml
+import QtQml.WorkerScript
+
+WorkerScript {
+    id: worker
+    source: "script_transfer.js"
+
+    property int sentLength: -1
+    property int receivedLength: -1
+    property int receivedSum: -1
+    property int copiedLength: -1
+    property bool receivedOnce: false
+    property bool invalidTransferRejected: false
+
+    signal done()
+
+    function testTransfer() {
+        var buffer = new ArrayBuffer(256);
+        var bytes = new Uint8Array(buffer);
+        for (var i = 0; i < bytes.length; ++i)
+            bytes[i] = i;
+
+        try {
+            worker.sendMessage({ "buffer": buffer }, [ buffer, buffer ]);
+        } catch (e) {
+            invalidTransferRejected = e instanceof TypeError && buffer.byteLength === 256;
+        }
+
+        worker.sendMessage({ "buffer": buffer, "again": buffer }, [ buffer ]);
+        sentLength = buffer.byteLength;
+    }
+
+    function testCopy() {
+        var buffer = new ArrayBuffer(16);
+        worker.sendMessage({ "buffer": buffer, "again": buffer });
+        copiedLength = buffer.byteLength;
+    }
+
+    onMessage: function(message) {
+        receivedLength = message.buffer.byteLength;
+        receivedSum = message.sum;
+        // A buffer the message refers to twice arrives as one object, both ways
+        receivedOnce = message.same && message.again === message.buffer;
+        done();
+    }
+}
@@ -28,6 +28,7 @@ private slots:
     void messaging_sendQObjectList();
     void messaging_sendJsObject();
     void messaging_sendExternalObject();
+    void messaging_transferArrayBuffer();
     void script_with_pragma();
     void script_included();
     void scriptError_onLoad();
@@ -193,6 +194,32 @@ void tst_QQuickWorkerScript::messaging_sendExternalObject()
     QTest::qWait(100); // shouldn't crash.
 }
 
+void tst_QQuickWorkerScript::messaging_transferArrayBuffer()
+{
+    QQmlComponent component(&m_engine, testFileUrl("worker_transfer.qml"));
+    std::unique_ptr<QQuickWorkerScript> worker { qobject_cast<QQuickWorkerScript*>(component.create()) };
+    QVERIFY(worker);
+
+    // Transferred buffers are detached on the sending side, and arrive intact
+    QVERIFY(QMetaObject::invokeMethod(worker.get(), "testTransfer"));
+    QVERIFY(worker->property("invalidTransferRejected").toBool());
+    QCOMPARE(worker->property("sentLength").toInt(), 0);
+    waitForEchoMessage(worker.get());
+    QCOMPARE(worker->property("receivedLength").toInt(), 256);
+    QCOMPARE(worker->property("receivedSum").toInt(), 255 * 256 / 2);
+    QVERIFY(worker->property("receivedOnce").toBool());
+
+    // Buffers that are not in the transfer list are copied
+    QVERIFY(QMetaObject::invokeMethod(worker.get(), "testCopy"));
+    QCOMPARE(worker->property("copiedLength").toInt(), 16);
+    waitForEchoMessage(worker.get());
+    QCOMPARE(worker->property("receivedLength").toInt(), 16);
+    QCOMPARE(worker->property("receivedSum").toInt(), 0);
+    QVERIFY(worker->property("receivedOnce").toBool());
+
+    qApp->processEvents();
+}
+
 void tst_QQuickWorkerScript::script_with_pragma()
 {
     QVariant value(100);
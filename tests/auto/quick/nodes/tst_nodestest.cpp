@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QtCore/QString>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QScopeGuard>
 #include <QtTest/QTest>
 
 #include <QtQuick/qsgnode.h>
@@ -12,7 +15,9 @@
 
 #include <QtQuick/qsgsimplerectnode.h>
 #include <QtQuick/qsgsimpletexturenode.h>
+#include <QtQuick/qsgflatcolormaterial.h>
 #include <QtQuick/private/qsgplaintexture_p.h>
+#include <QtQuick/private/qsgrhiatlastexture_p.h>
 
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/qpa/qplatformintegration.h>
@@ -75,6 +80,12 @@ private Q_SLOTS:
     void textureNodeTextureOwnership();
     void textureNodeRect_data();
     void textureNodeRect();
+    void textureAtlasCompaction_data();
+    void textureAtlasCompaction();
+
+    // Batch renderer
+    void partialRebuildMatchesFullRebuild_data();
+    void partialRebuildMatchesFullRebuild();
 
 private:
     void rhiTestData();
@@ -484,6 +495,259 @@ void NodesTest::textureNodeRect()
     renderContext->invalidate();
 }
 
+void NodesTest::textureAtlasCompaction_data()
+{
+    rhiTestData();
+}
+
+void NodesTest::textureAtlasCompaction()
+{
+    INIT_RHI();
+
+    {
+        // The atlas is 512x512 for this surface size
+        QSGRhiAtlasTexture::Manager manager(renderContext, QSize(512, 512), nullptr);
+        const auto createTexture = [&manager](int size) {
+            QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+            image.fill(Qt::red);
+            return manager.create(image, true);
+        };
+
+        // Fill the atlas with 4x4 images, which are padded by one pixel
+        QList<QSGTexture *> textures;
+        for (int i = 0; i < 16; ++i) {
+            QSGTexture *texture = createTexture(126);
+            QVERIFY(texture);
+            textures.append(texture);
+        }
+        QSGRhiAtlasTexture::Manager::Statistics stats = manager.statistics();
+        QCOMPARE(stats.atlasCount, 1);
+        QCOMPARE(stats.totalArea, 512 * 512);
+        QCOMPARE(stats.usedArea, stats.totalArea);
+        QCOMPARE(stats.fallbackCount, 0);
+
+        // Removing every other image leaves half of the atlas free, but only
+        // in pieces that are too small for larger images
+        QList<QSGTexture *> kept;
+        for (int i = 0; i < textures.size(); ++i) {
+            if (i % 2)
+                delete textures.at(i);
+            else
+                kept.append(textures.at(i));
+        }
+        stats = manager.statistics();
+        QCOMPARE(stats.usedArea * 2, stats.totalArea);
+        QVERIFY(stats.fragmentation > 0);
+
+        // So the atlas is retired, and the image goes into a fresh one
+        QSGTexture *large = createTexture(200);
+        QVERIFY(large);
+        stats = manager.statistics();
+        QCOMPARE(stats.compactionCount, 1);
+        QCOMPARE(stats.retiredAtlasCount, 1);
+        QCOMPARE(stats.atlasCount, 2);
+        QCOMPARE(stats.fallbackCount, 0);
+
+        // The retired atlas stays alive while textures use it...
+        manager.endFrame();
+        stats = manager.statistics();
+        QCOMPARE(stats.retiredAtlasCount, 1);
+        QCOMPARE(stats.releasedAtlasCount, 0);
+
+        // ...and is released at the end of the frame in which the last of
+        // them goes away, which is logged
+        QLoggingCategory::setFilterRules(QStringLiteral("qt.scenegraph.general.debug=true"));
+        auto restoreFilterRules = qScopeGuard([] {
+            QLoggingCategory::setFilterRules(QString());
+        });
+        qDeleteAll(kept);
+        QCOMPARE(manager.statistics().retiredAtlasCount, 1);
+        QTest::ignoreMessage(QtDebugMsg, QRegularExpression(
+                QStringLiteral("^rhi texture atlas statistics: 1 atlases \\(0 retired\\).* 1 retired, 1 released, ")));
+        manager.endFrame();
+        stats = manager.statistics();
+        QCOMPARE(stats.retiredAtlasCount, 0);
+        QCOMPARE(stats.releasedAtlasCount, 1);
+        QCOMPARE(stats.atlasCount, 1);
+
+        delete large;
+        manager.invalidate();
+    }
+
+    renderContext->invalidate();
+}
+
+void NodesTest::partialRebuildMatchesFullRebuild_data()
+{
+    rhiTestData();
+}
+
+static QSGGeometryNode *createRectNode(int cell, const QColor &color)
+{
+    // Every node gets its own cell, so that nothing overlaps and all
+    // compatible alpha nodes can end up in the same batch.
+    QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 4);
+    QSGGeometry::updateRectGeometry(geometry, QRectF((cell % 10) * 50, (cell / 10) * 50, 40, 40));
+    QSGFlatColorMaterial *material = new QSGFlatColorMaterial;
+    material->setColor(color);
+
+    QSGGeometryNode *node = new QSGGeometryNode;
+    node->setGeometry(geometry);
+    node->setMaterial(material);
+    node->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+    return node;
+}
+
+static QImage renderFrame(QRhi *rhi, QSGBatchRenderer::Renderer *renderer,
+                          QRhiTextureRenderTarget *rt, QRhiTexture *texture)
+{
+    QRhiCommandBuffer *cb = nullptr;
+    if (rhi->beginOffscreenFrame(&cb) != QRhi::FrameOpSuccess)
+        return QImage();
+
+    renderer->setRenderTarget({ rt, rt->renderPassDescriptor(), cb });
+    renderer->renderScene();
+
+    QRhiReadbackResult readResult;
+    QRhiResourceUpdateBatch *readbackBatch = rhi->nextResourceUpdateBatch();
+    readbackBatch->readBackTexture(texture, &readResult);
+    cb->resourceUpdate(readbackBatch);
+    rhi->endOffscreenFrame();
+
+    return QImage(reinterpret_cast<const uchar *>(readResult.data.constData()),
+                  readResult.pixelSize.width(), readResult.pixelSize.height(),
+                  QImage::Format_RGBA8888_Premultiplied).copy();
+}
+
+static QStringList describeBatches(const QList<QSGBatchRenderer::Renderer::BatchSnapshot> &batches,
+                                   const QSGNode *parent)
+{
+    QHash<const QSGNode *, int> indices;
+    for (int i = 0; i < parent->childCount(); ++i)
+        indices.insert(parent->childAtIndex(i), i);
+
+    // Opaque batches rely on the depth buffer, so neither the order of the
+    // batches nor the order of the nodes within them affects the result.
+    // Alpha batches are drawn in order.
+    QStringList opaque;
+    QStringList alpha;
+    for (const QSGBatchRenderer::Renderer::BatchSnapshot &batch : batches) {
+        QList<int> nodes;
+        for (QSGGeometryNode *node : batch.nodes)
+            nodes.append(indices.value(node, -1));
+        if (batch.isOpaque)
+            std::sort(nodes.begin(), nodes.end());
+
+        QStringList nodeList;
+        for (int index : std::as_const(nodes))
+            nodeList.append(QString::number(index));
+        const QString description = QStringLiteral("merged=%1 vertices=%2 indices=%3 nodes=%4")
+                .arg(batch.merged ? 1 : 0).arg(batch.vertexCount).arg(batch.indexCount)
+                .arg(nodeList.join(QLatin1Char(',')));
+        (batch.isOpaque ? opaque : alpha).append(description);
+    }
+    opaque.sort();
+    return QStringList(QStringLiteral("opaque")) + opaque + QStringList(QStringLiteral("alpha")) + alpha;
+}
+
+void NodesTest::partialRebuildMatchesFullRebuild()
+{
+    INIT_RHI();
+
+    {
+        const QSize size(512, 512);
+        QScopedPointer<QRhiTexture> texture(rhi->newTexture(QRhiTexture::RGBA8, size, 1,
+                                                            QRhiTexture::RenderTarget | QRhiTexture::UsedAsTransferSource));
+        QVERIFY(texture->create());
+        QScopedPointer<QRhiRenderBuffer> ds(rhi->newRenderBuffer(QRhiRenderBuffer::DepthStencil, size, 1));
+        QVERIFY(ds->create());
+        QRhiTextureRenderTargetDescription rtDesc(QRhiColorAttachment(texture.data()));
+        rtDesc.setDepthStencilBuffer(ds.data());
+        QScopedPointer<QRhiTextureRenderTarget> rt(rhi->newTextureRenderTarget(rtDesc));
+        QScopedPointer<QRhiRenderPassDescriptor> rp(rt->newCompatibleRenderPassDescriptor());
+        rt->setRenderPassDescriptor(rp.data());
+        QVERIFY(rt->create());
+
+        const auto createRenderer = [&](QSGRootNode *root) {
+            QSGBatchRenderer::Renderer *renderer = new QSGBatchRenderer::Renderer(renderContext);
+            renderer->setRootNode(root);
+            renderer->setDeviceRect(size);
+            renderer->setViewportRect(size);
+            renderer->setProjectionMatrixToRect(QRectF(QPointF(), size));
+            return renderer;
+        };
+
+        const QColor colors[] = { QColor(Qt::red), QColor(Qt::green), QColor(0, 0, 255, 128) };
+        int cell = 0;
+
+        // The clip node is a batch root, so adding nodes below it only
+        // rebuilds the render lists of that root, as long as there are
+        // render orders left for them.
+        QSGGeometry clipGeometry(QSGGeometry::defaultAttributes_Point2D(), 4);
+        QSGGeometry::updateRectGeometry(&clipGeometry, QRectF(QPointF(), size));
+        QSGRootNode root;
+        QSGClipNode *clip = new QSGClipNode;
+        clip->setIsRectangular(true);
+        clip->setClipRect(QRectF(QPointF(), size));
+        clip->setGeometry(&clipGeometry);
+        root.appendChildNode(clip);
+        for (int i = 0; i < 24; ++i)
+            clip->appendChildNode(createRectNode(cell++, colors[i % 3]));
+
+        QScopedPointer<QSGBatchRenderer::Renderer> renderer(createRenderer(&root));
+        QVERIFY(!renderFrame(rhi.data(), renderer.data(), rt.data(), texture.data()).isNull());
+        QCOMPARE(renderer->fullRebuildCount(), 1);
+        QCOMPARE(renderer->partialRebuildCount(), 0);
+
+        // Additions, both appended and in between existing nodes
+        clip->appendChildNode(createRectNode(cell++, colors[0]));
+        clip->insertChildNodeBefore(createRectNode(cell++, colors[2]), clip->childAtIndex(5));
+        clip->insertChildNodeBefore(createRectNode(cell++, colors[1]), clip->childAtIndex(11));
+        QVERIFY(!renderFrame(rhi.data(), renderer.data(), rt.data(), texture.data()).isNull());
+        QCOMPARE(renderer->fullRebuildCount(), 1);
+        QCOMPARE(renderer->partialRebuildCount(), 1);
+
+        // Removals, of an opaque and an alpha node
+        for (int index : { 3, 7 }) {
+            QSGNode *node = clip->childAtIndex(index);
+            clip->removeChildNode(node);
+            delete node;
+        }
+        QVERIFY(!renderFrame(rhi.data(), renderer.data(), rt.data(), texture.data()).isNull());
+        QCOMPARE(renderer->fullRebuildCount(), 1);
+
+        // Reorders, moving an alpha node further back and an opaque one to the end
+        QSGNode *node = clip->childAtIndex(2);
+        clip->removeChildNode(node);
+        clip->insertChildNodeBefore(node, clip->childAtIndex(14));
+        node = clip->childAtIndex(1);
+        clip->removeChildNode(node);
+        clip->appendChildNode(node);
+        const QImage partialImage = renderFrame(rhi.data(), renderer.data(), rt.data(), texture.data());
+        QVERIFY(!partialImage.isNull());
+        QCOMPARE(renderer->fullRebuildCount(), 1);
+        QCOMPARE(renderer->partialRebuildCount(), 2);
+
+        const QStringList partialBatches = describeBatches(renderer->batchSnapshot(), clip);
+        renderer.reset();
+
+        // A new renderer has to build everything from scratch
+        renderer.reset(createRenderer(&root));
+        const QImage fullImage = renderFrame(rhi.data(), renderer.data(), rt.data(), texture.data());
+        QVERIFY(!fullImage.isNull());
+        QCOMPARE(renderer->fullRebuildCount(), 1);
+        QCOMPARE(renderer->partialRebuildCount(), 0);
+
+        const QStringList fullBatches = describeBatches(renderer->batchSnapshot(), clip);
+        QCOMPARE(partialBatches, fullBatches);
+        QCOMPARE(partialImage, fullImage);
+
+        renderer.reset();
+    }
+
+    renderContext->invalidate();
+}
+
 QTEST_MAIN(NodesTest);
 
 #include "tst_nodestest.moc"
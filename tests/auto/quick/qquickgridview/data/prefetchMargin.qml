@@ -0,0 +1,17 @@
+import QtQuick
+
+GridView {
+    width: 100
+    height: 100
+    cellWidth: 50
+    cellHeight: 10
+    cacheBuffer: 0
+    prefetchMargin: 4
+
+    delegate: Text {
+        required property string display
+        width: 50
+        height: 10
+        text: display
+    }
+}
@@ -197,6 +197,7 @@ private slots:
     void keyNavigationEnabled();
     void releaseItems();
     void removeAccessibleChildrenEvenIfReusingItems();
+    void prefetchMargin();
 
 private:
     QList<int> toIntList(const QVariantList &list);
@@ -6913,6 +6914,59 @@ void tst_QQuickGridView::removeAccessibleChildrenEvenIfReusingItems()
     QTRY_COMPARE(gridView->child(3)->text(QAccessible::Text::Name), "item24");
 }
 
+class TestPrefetchModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    int rowCount(const QModelIndex &parent) const override
+    {
+        return parent.isValid() ? 0 : 100;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (role == Qt::DisplayRole)
+            return QString::number(index.row());
+        return {};
+    }
+
+    void multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const override
+    {
+        m_requestedRows.append(index.row());
+        QAbstractListModel::multiData(index, roleDataSpan);
+    }
+
+    mutable QList<int> m_requestedRows;
+};
+
+void tst_QQuickGridView::prefetchMargin()
+{
+    TestPrefetchModel model;
+    QQuickView window;
+    window.setInitialProperties({{ "model", QVariant::fromValue(&model) }});
+    QVERIFY(QQuickTest::showView(window, testFileUrl("prefetchMargin.qml")));
+    auto *gridView = qobject_cast<QQuickGridView *>(window.rootObject());
+    QVERIFY(gridView);
+    QCOMPARE(gridView->prefetchMargin(), 4);
+
+    // Cells 0 to 19 are visible; the margin counts cells, not rows.
+    for (int row = 20; row < 24; ++row)
+        QVERIFY2(model.m_requestedRows.contains(row), qPrintable(QString::number(row)));
+    QVERIFY(!model.m_requestedRows.contains(24));
+
+    // Cells with delegates aren't prefetched.
+    QVERIFY(!model.m_requestedRows.contains(5));
+
+    // Scrolling the prefetched cells into view doesn't request them again.
+    gridView->setContentY(20);
+    QVERIFY(QQuickTest::qWaitForPolish(gridView));
+    QQuickItem *item = gridView->itemAtIndex(22);
+    QVERIFY(item);
+    QCOMPARE(item->property("text").toString(), QStringLiteral("22"));
+    QCOMPARE(model.m_requestedRows.count(22), 1);
+    QVERIFY(model.m_requestedRows.contains(24));
+}
 
 QTEST_MAIN(tst_QQuickGridView)
 
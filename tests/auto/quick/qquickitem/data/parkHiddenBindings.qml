@@ -0,0 +1,20 @@
+import QtQuick
+
+Item {
+    id: root
+    property int source: 0
+    property int evaluations: 0
+    property bool contentVisible: false
+
+    Item {
+        id: content
+        objectName: "content"
+        visible: root.contentVisible
+
+        Item {
+            id: inner
+            objectName: "inner"
+            property int mirror: { ++root.evaluations; return root.source }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+import QtQuick
+
+Item {
+    id: root
+    property int source: 0
+    property int evaluations: 0
+    property int itemHeight: 10
+    property real columnOpacity: 0
+
+    Column {
+        objectName: "column"
+        opacity: root.columnOpacity
+
+        Item {
+            objectName: "first"
+            width: 10
+            height: root.itemHeight
+            property int label: { ++root.evaluations; return root.source }
+        }
+        Item {
+            objectName: "second"
+            width: 10
+            height: 10
+        }
+    }
+
+    Item {
+        objectName: "sibling"
+        Item {}
+    }
+}
@@ -4,12 +4,14 @@
 #include <qtest.h>
 
 #include <QtQml/QQmlComponent>
+#include <QtQml/QQmlExpression>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/qquickwindow.h>
 #include <QtQuick/qquickview.h>
 #include "private/qquickfocusscope_p.h"
 #include "private/qquickrectangle_p.h"
 #include "private/qquickitem_p.h"
+#include <QtQml/private/qqmldata_p.h>
 #include <QtGui/private/qevent_p.h>
 #include <qpa/qwindowsysteminterface.h>
 #ifdef Q_OS_WIN
@@ -231,6 +233,8 @@ private slots:
     void listsAreNotLists();
 
     void transformChanged();
+    void parkHiddenBindings();
+    void parkHiddenBindingsSubtree();
 
 private:
 
@@ -2677,6 +2681,112 @@ void tst_qquickitem::transformChanged()
     QCOMPARE(transformItem.mapToScene(QPoint(0, 0)), parents[1][0]->position());
 }
 
+void tst_qquickitem::parkHiddenBindings()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("parkHiddenBindings.qml"));
+    QScopedPointer<QQuickItem> root(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(root, qPrintable(component.errorString()));
+    QQuickItem *content = root->findChild<QQuickItem *>("content");
+    QVERIFY(content);
+    QQuickItem *inner = root->findChild<QQuickItem *>("inner");
+    QVERIFY(inner);
+    QCOMPARE(root->property("evaluations").toInt(), 1);
+
+    // Without the policy, hidden bindings are evaluated as usual.
+    root->setProperty("source", 1);
+    QCOMPARE(root->property("evaluations").toInt(), 2);
+    QCOMPARE(inner->property("mirror").toInt(), 1);
+
+    QQuickItemPrivate::get(content)->setParkBindingsWhenHidden(true);
+    root->setProperty("source", 2);
+    root->setProperty("source", 3);
+    QCOMPARE(root->property("evaluations").toInt(), 2);
+
+    // Reading the property through the meta-object system evaluates the pending binding.
+    QCOMPARE(inner->property("mirror").toInt(), 3);
+    QCOMPARE(root->property("evaluations").toInt(), 3);
+    QCOMPARE(inner->property("mirror").toInt(), 3);
+    QCOMPARE(root->property("evaluations").toInt(), 3);
+
+    // So does reading it from QML.
+    root->setProperty("source", 4);
+    QCOMPARE(root->property("evaluations").toInt(), 3);
+    QQmlExpression expression(qmlContext(root.get()), inner, QStringLiteral("mirror"));
+    QCOMPARE(expression.evaluate().toInt(), 4);
+    QCOMPARE(root->property("evaluations").toInt(), 4);
+
+    // The binding on "visible" is not parked, and showing the item flushes the rest.
+    root->setProperty("source", 5);
+    QCOMPARE(root->property("evaluations").toInt(), 4);
+    root->setProperty("contentVisible", true);
+    QVERIFY(content->isVisible());
+    QCOMPARE(root->property("evaluations").toInt(), 5);
+    QCOMPARE(inner->property("mirror").toInt(), 5);
+
+    root->setProperty("source", 6);
+    QCOMPARE(root->property("evaluations").toInt(), 6);
+
+    // Full transparency parks the bindings, too.
+    content->setOpacity(0);
+    root->setProperty("source", 7);
+    QCOMPARE(root->property("evaluations").toInt(), 6);
+    content->setOpacity(0.5);
+    QCOMPARE(root->property("evaluations").toInt(), 7);
+    QCOMPARE(inner->property("mirror").toInt(), 7);
+}
+
+void tst_qquickitem::parkHiddenBindingsSubtree()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("parkHiddenBindingsSubtree.qml"));
+    QScopedPointer<QQuickItem> root(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(root, qPrintable(component.errorString()));
+    QQuickItem *column = root->findChild<QQuickItem *>("column");
+    QVERIFY(column);
+    QQuickItem *first = root->findChild<QQuickItem *>("first");
+    QVERIFY(first);
+    QQuickItem *second = root->findChild<QQuickItem *>("second");
+    QVERIFY(second);
+    QQuickItem *sibling = root->findChild<QQuickItem *>("sibling");
+    QVERIFY(sibling);
+    QCOMPARE(root->property("evaluations").toInt(), 1);
+    QVERIFY(!QQmlData::get(second)->hasInterceptorMetaObject);
+
+    QQuickItemPrivate::get(column)->setParkBindingsWhenHidden(true);
+
+    // The column is transparent, so the label binding is parked...
+    root->setProperty("source", 1);
+    QCOMPARE(root->property("evaluations").toInt(), 1);
+
+    // ...but geometry bindings stay live, and the positioner lays out current sizes.
+    root->setProperty("itemHeight", 30);
+    QCOMPARE(first->height(), 30);
+    QVERIFY(QMetaObject::invokeMethod(column, "forceLayout"));
+    QCOMPARE(second->y(), 30);
+
+    // Items outside the opted-in subtree are not walked or parked.
+    QVERIFY(!QQuickItemPrivate::get(sibling)->subtreeMayParkBindings);
+    QVERIFY(QQuickItemPrivate::get(root.get())->subtreeMayParkBindings);
+
+    // Parked items get an interceptor meta-object so that reads flush their
+    // bindings, and lose it again when they are shown.
+    QVERIFY(QQmlData::get(second)->hasInterceptorMetaObject);
+    root->setProperty("columnOpacity", 1);
+    QCOMPARE(root->property("evaluations").toInt(), 2);
+    QVERIFY(!QQmlData::get(second)->hasInterceptorMetaObject);
+    QCOMPARE(second->metaObject(), &QQuickItem::staticMetaObject);
+
+    // Turning parking off evaluates what is still pending.
+    root->setProperty("columnOpacity", 0);
+    root->setProperty("source", 2);
+    QCOMPARE(root->property("evaluations").toInt(), 2);
+    QQuickItemPrivate::get(column)->setParkBindingsWhenHidden(false);
+    QCOMPARE(root->property("evaluations").toInt(), 3);
+    root->setProperty("source", 3);
+    QCOMPARE(root->property("evaluations").toInt(), 4);
+}
+
 QTEST_MAIN(tst_qquickitem)
 
 #include "tst_qquickitem.moc"
@@ -0,0 +1,29 @@
+import QtQuick
+
+ListView {
+    width: 200
+    height: 200
+    cacheItemSizes: true
+
+    model: ListModel {
+        id: listModel
+        Component.onCompleted: {
+            for (let i = 0; i < 100; ++i)
+                append({ size: i % 10 === 0 ? 200 : 10 })
+        }
+    }
+
+    delegate: Rectangle {
+        required property int size
+        width: ListView.view.width
+        height: size
+    }
+
+    function removeRow(row) {
+        listModel.remove(row)
+    }
+
+    function moveRow(from, to) {
+        listModel.move(from, to, 1)
+    }
+}
@@ -0,0 +1,20 @@
+import QtQuick
+import QtQml.Models
+
+ListView {
+    id: root
+    width: 100
+    height: 100
+
+    property var sourceModel
+
+    model: DelegateModel {
+        coalesceChanges: true
+        model: root.sourceModel
+        delegate: Text {
+            required property string display
+            height: 10
+            text: display
+        }
+    }
+}
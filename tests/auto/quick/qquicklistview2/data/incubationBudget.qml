@@ -0,0 +1,15 @@
+import QtQuick
+
+ListView {
+    width: 100
+    height: 100
+    cacheBuffer: 0
+    incubationBudget: 5
+    model: 1000
+
+    delegate: Rectangle {
+        required property int index
+        width: 100
+        height: 10
+    }
+}
@@ -0,0 +1,14 @@
+import QtQuick
+
+ListView {
+    width: 100
+    height: 100
+    cacheBuffer: 0
+    prefetchMargin: 5
+
+    delegate: Text {
+        required property string display
+        height: 10
+        text: display
+    }
+}
@@ -7,8 +7,11 @@
 #include <QtQuick/qquickview.h>
 #include <QtQuick/private/qquickitemview_p_p.h>
 #include <QtQuick/private/qquicklistview_p.h>
+#include <QtQuick/private/qquicklistviewsizecache_p.h>
+#include <QtQuick/private/qquickwindow_p.h>
 #include <QtQuickTest/QtQuickTest>
 #include <QStringListModel>
+#include <QRandomGenerator>
 #include <QQmlApplicationEngine>
 #include <QtQml/QQmlComponent>
 
@@ -81,6 +84,13 @@ private slots:
     void delegateModelAccess_data();
     void delegateModelAccess();
 
+    void sizeCache();
+    void sizeCacheLargeModel();
+    void cacheItemSizes();
+    void prefetchMargin();
+    void incubationBudgetJump();
+    void coalesceChangesUntilPolish();
+
 private:
     void flickWithTouch(QQuickWindow *window, const QPoint &from, const QPoint &to);
     std::unique_ptr<QPointingDevice> touchscreen{QTest::createTouchDevice()};
@@ -1480,6 +1490,275 @@ void tst_QQuickListView2::delegateModelAccess()
     QCOMPARE(delegate->property("modelX").toDouble(), expected);
 }
 
+void tst_QQuickListView2::sizeCache()
+{
+    QQuickListViewSizeCache cache;
+    QCOMPARE(cache.indexAt(0, 10, 0), -1);
+
+    cache.reset(10);
+    QCOMPARE(cache.knownCount(), 0);
+    QCOMPARE(cache.offset(10, 10, 1), 110.0);
+    QCOMPARE(cache.indexAt(54, 10, 1), 4);
+    QCOMPARE(cache.indexAt(55, 10, 1), 5);
+    QCOMPARE(cache.indexAt(1000, 10, 1), 9);
+
+    cache.setSize(2, 50);
+    cache.setSize(7, 30);
+    QCOMPARE(cache.knownCount(), 2);
+    QCOMPARE(cache.averageSize(), 40.0);
+    QCOMPARE(cache.offset(3, 10, 0), 70.0);
+    QCOMPARE(cache.offset(10, 10, 0), 160.0);
+    QCOMPARE(cache.sizeOf(2, 8, 10), 120.0);
+    QCOMPARE(cache.indexAt(69, 10, 0), 2);
+    QCOMPARE(cache.indexAt(70, 10, 0), 3);
+
+    // A size can be measured again.
+    cache.setSize(2, 20);
+    QCOMPARE(cache.knownCount(), 2);
+    QCOMPARE(cache.offset(3, 10, 0), 40.0);
+
+    cache.insert(0, 2);
+    QCOMPARE(cache.count(), 12);
+    QVERIFY(!cache.isKnown(2));
+    QVERIFY(cache.isKnown(4));
+    QCOMPARE(cache.size(9, 10), 30.0);
+
+    cache.remove(3, 2);
+    QCOMPARE(cache.count(), 10);
+    QCOMPARE(cache.knownCount(), 1);
+    QCOMPARE(cache.offset(10, 10, 0), 120.0);
+}
+
+void tst_QQuickListView2::sizeCacheLargeModel()
+{
+    // Random edits are checked against a plain list of sizes, where 0 is unknown.
+    QQuickListViewSizeCache cache;
+    QList<int> sizes(2000, 0);
+    cache.reset(int(sizes.size()));
+    QRandomGenerator random(42);
+    for (int step = 0; step < 2000; ++step) {
+        const int count = int(sizes.size());
+        const int operation = random.bounded(4);
+        if (operation == 0 || count == 0) {
+            const int index = random.bounded(count + 1);
+            const int inserted = random.bounded(1, 20);
+            sizes.insert(index, inserted, 0);
+            cache.insert(index, inserted);
+        } else if (operation == 1) {
+            const int index = random.bounded(count);
+            const int removed = random.bounded(1, qMin(20, count - index) + 1);
+            sizes.remove(index, removed);
+            cache.remove(index, removed);
+        } else {
+            const int index = random.bounded(count);
+            sizes[index] = random.bounded(1, 100);
+            cache.setSize(index, sizes.at(index));
+        }
+
+        if (step % 100 != 0)
+            continue;
+        QCOMPARE(cache.count(), sizes.size());
+        qreal offset = 0;
+        int known = 0;
+        for (int i = 0; i < sizes.size(); ++i) {
+            QCOMPARE(cache.isKnown(i), sizes.at(i) != 0);
+            QCOMPARE(cache.offset(i, 10, 1), offset);
+            QCOMPARE(cache.indexAt(offset, 10, 1), i);
+            offset += (sizes.at(i) ? sizes.at(i) : 10) + 1;
+            known += sizes.at(i) ? 1 : 0;
+        }
+        QCOMPARE(cache.offset(int(sizes.size()), 10, 1), offset);
+        QCOMPARE(cache.knownCount(), known);
+    }
+
+    // Inserting and removing in a large model does not touch the other items.
+    const int count = 1000000;
+    cache.reset(count);
+    for (int i = 0; i < count; i += 1000)
+        cache.setSize(i, 110);
+    for (int i = 0; i < 10000; ++i) {
+        const int index = int(random.bounded(count / 1000)) * 1000 + 1;
+        cache.insert(index, 5);
+        cache.remove(index, 5);
+    }
+    QCOMPARE(cache.count(), count);
+    QCOMPARE(cache.knownCount(), count / 1000);
+    QCOMPARE(cache.offset(count, 10, 0), count * 10.0 + count / 1000 * 100.0);
+    QCOMPARE(cache.indexAt(500 * 1000 * 10.0 + 500 * 100.0, 10, 0), 500 * 1000);
+    cache.remove(0, count / 2);
+    QCOMPARE(cache.knownCount(), count / 2000);
+    QCOMPARE(cache.offset(count / 2, 10, 0), count / 2 * 10.0 + count / 2000 * 100.0);
+}
+
+void tst_QQuickListView2::cacheItemSizes()
+{
+    QQuickView window;
+    QVERIFY(QQuickTest::showView(window, testFileUrl("cacheItemSizes.qml")));
+    auto *listView = qobject_cast<QQuickListView *>(window.rootObject());
+    QVERIFY(listView);
+    QVERIFY(listView->cacheItemSizes());
+    QCOMPARE(listView->count(), 100);
+
+    // Every tenth item is 200 high and the others are 10 high, so an
+    // average of the created items can be far off.
+    for (int i = 0; i < 100; i += 5)
+        listView->positionViewAtIndex(i, QQuickListView::Beginning);
+    listView->positionViewAtBeginning();
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QCOMPARE(listView->contentHeight(), 2900.0);
+
+    // All sizes are known, so the view lands exactly on the item.
+    listView->positionViewAtIndex(95, QQuickListView::Beginning);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QQuickItem *item = listView->itemAtIndex(95);
+    QVERIFY(item);
+    QCOMPARE(item->y() - listView->originY(), 10 * 200.0 + 85 * 10);
+    QCOMPARE(listView->contentY(), item->y());
+
+    // The sizes follow the rows when rows are removed.
+    QVERIFY(QMetaObject::invokeMethod(listView, "removeRow", Q_ARG(QVariant, 10)));
+    listView->positionViewAtBeginning();
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QCOMPARE(listView->count(), 99);
+    QCOMPARE(listView->contentHeight(), 2700.0);
+
+    // Moved rows keep their measured size, even when they are moved out of view.
+    QVERIFY(QMetaObject::invokeMethod(listView, "moveRow", Q_ARG(QVariant, 0), Q_ARG(QVariant, 98)));
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QVERIFY(!listView->itemAtIndex(98));
+    QCOMPARE(listView->contentHeight(), 2700.0);
+    listView->positionViewAtEnd();
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    item = listView->itemAtIndex(98);
+    QVERIFY(item);
+    QCOMPARE(item->height(), 200.0);
+    QCOMPARE(item->y() - listView->originY(), 2500.0);
+
+    listView->setCacheItemSizes(false);
+    QVERIFY(!listView->cacheItemSizes());
+}
+
+class TestPrefetchModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    int rowCount(const QModelIndex &parent) const override
+    {
+        return parent.isValid() ? 0 : 100;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (role == Qt::DisplayRole)
+            return QString::number(index.row());
+        return {};
+    }
+
+    void multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const override
+    {
+        m_prefetchedRows.append(index.row());
+        QAbstractListModel::multiData(index, roleDataSpan);
+    }
+
+    mutable QList<int> m_prefetchedRows;
+};
+
+void tst_QQuickListView2::prefetchMargin()
+{
+    TestPrefetchModel model;
+    QQuickView window;
+    window.setInitialProperties({{ "model", QVariant::fromValue(&model) }});
+    QVERIFY(QQuickTest::showView(window, testFileUrl("prefetchMargin.qml")));
+    auto *listView = qobject_cast<QQuickListView *>(window.rootObject());
+    QVERIFY(listView);
+    QCOMPARE(listView->prefetchMargin(), 5);
+
+    // Items 0 to 9 are visible; the data of the next five rows is requested.
+    for (int row = 10; row < 15; ++row)
+        QVERIFY2(model.m_prefetchedRows.contains(row), qPrintable(QString::number(row)));
+    QVERIFY(!model.m_prefetchedRows.contains(15));
+
+    // Each row is only requested once while the items around it stay the same.
+    QCOMPARE(model.m_prefetchedRows.count(12), 1);
+
+    model.m_prefetchedRows.clear();
+    listView->positionViewAtIndex(50, QQuickListView::Beginning);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    for (int row = 60; row < 65; ++row)
+        QVERIFY2(model.m_prefetchedRows.contains(row), qPrintable(QString::number(row)));
+    QVERIFY(!model.m_prefetchedRows.contains(65));
+
+    // Rows whose delegates are created aren't prefetched.
+    QVERIFY(!model.m_prefetchedRows.contains(55));
+
+    // The delegates of prefetched rows get the prefetched data.
+    listView->positionViewAtIndex(55, QQuickListView::Beginning);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QQuickItem *item = listView->itemAtIndex(62);
+    QVERIFY(item);
+    QCOMPARE(item->property("text").toString(), QStringLiteral("62"));
+    QCOMPARE(model.m_prefetchedRows.count(62), 1);
+}
+
+void tst_QQuickListView2::incubationBudgetJump()
+{
+    QQuickView window;
+    QVERIFY(QQuickTest::showView(window, testFileUrl("incubationBudget.qml")));
+    auto *listView = qobject_cast<QQuickListView *>(window.rootObject());
+    QVERIFY(listView);
+    QCOMPARE(listView->incubationBudget(), 5);
+    // The budget was set before the view was in a window
+    QQuickWindowPrivate *windowPrivate = QQuickWindowPrivate::get(&window);
+    QCOMPARE(windowPrivate->incubationBudget(), 5);
+
+    // The item that is jumped to is created right away, and the other
+    // visible items are incubated over the following frames.
+    listView->positionViewAtIndex(500, QQuickListView::Beginning);
+    QQuickItem *target = listView->itemAtIndex(500);
+    QVERIFY(target);
+    QCOMPARE(listView->contentY(), target->y());
+    QVERIFY(!listView->itemAtIndex(501));
+
+    QTRY_VERIFY(listView->itemAtIndex(509));
+    QCOMPARE(listView->itemAtIndex(509)->y(), target->y() + 90);
+
+    // The smallest budget in the window caps the time spent per frame
+    QQuickListView other(window.contentItem());
+    other.setIncubationBudget(2);
+    QCOMPARE(windowPrivate->incubationBudget(), 2);
+    listView->setIncubationBudget(1);
+    QCOMPARE(windowPrivate->incubationBudget(), 1);
+
+    // Views that leave the window take their budget with them
+    listView->setIncubationBudget(0);
+    QCOMPARE(windowPrivate->incubationBudget(), 2);
+    QQuickWindow otherWindow;
+    other.setParentItem(otherWindow.contentItem());
+    QCOMPARE(windowPrivate->incubationBudget(), 0);
+    QCOMPARE(QQuickWindowPrivate::get(&otherWindow)->incubationBudget(), 2);
+}
+
+void tst_QQuickListView2::coalesceChangesUntilPolish()
+{
+    QStringListModel model({ "a", "b" });
+    QQuickView window;
+    window.setInitialProperties({{ "sourceModel", QVariant::fromValue(&model) }});
+    QVERIFY(QQuickTest::showView(window, testFileUrl("coalesceChanges.qml")));
+    auto *listView = qobject_cast<QQuickListView *>(window.rootObject());
+    QVERIFY(listView);
+    QCOMPARE(listView->count(), 2);
+
+    // The changes reach the view in its next polish, all at once.
+    for (int i = 0; i < 5; ++i)
+        model.insertRows(model.rowCount(), 1);
+    QCOMPARE(listView->count(), 2);
+    QVERIFY(QQuickTest::qIsPolishScheduled(listView));
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    QCOMPARE(listView->count(), 7);
+    QVERIFY(listView->itemAtIndex(6));
+}
+
 QTEST_MAIN(tst_QQuickListView2)
 
 #include "tst_qquicklistview2.moc"
@@ -0,0 +1,18 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "steelblue"
+    Rectangle {
+        objectName: "small"
+        x: 10
+        y: 20
+        width: 30
+        height: 40
+        color: "palegreen"
+    }
+}
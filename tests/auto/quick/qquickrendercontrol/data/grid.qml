@@ -0,0 +1,23 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+Item {
+    width: 200
+    height: 200
+
+    property int highlighted: -1
+
+    Repeater {
+        model: 400
+        delegate: Rectangle {
+            required property int index
+            x: (index % 20) * 10
+            y: Math.floor(index / 20) * 10
+            width: 9
+            height: 9
+            color: index === highlighted ? "red" : "gray"
+        }
+    }
+}
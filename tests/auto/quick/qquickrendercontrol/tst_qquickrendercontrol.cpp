@@ -27,6 +27,7 @@
 #endif
 
 #include <QOperatingSystemVersion>
+#include <QScopeGuard>
 
 class AnimationDriver : public QAnimationDriver
 {
@@ -63,6 +64,10 @@ private slots:
     void renderAndReadBackWithRhi();
     void renderAndReadBackWithVulkanNative();
     void renderAndReadBackWithVulkanAndCustomDepthTexture();
+    void damageRegion();
+    void partialBatchUpload();
+    void partialBatchUploadContents_data();
+    void partialBatchUploadContents();
 
 private:
 #if QT_CONFIG(vulkan)
@@ -828,6 +833,292 @@ void tst_RenderControl::renderAndReadBackWithVulkanAndCustomDepthTexture()
 #endif
 }
 
+void tst_RenderControl::damageRegion()
+{
+    // The damage is computed regardless of the graphics API, so the Null
+    // backend is enough, even though it does not render anything.
+    qputenv("QSG_RENDERER_DAMAGE_TRACKING", "1");
+    auto cleanup = qScopeGuard([] {
+        qunsetenv("QSG_RENDERER_DAMAGE_TRACKING");
+        QQuickWindow::setGraphicsApi(QSGRendererInterface::Unknown);
+    });
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Null);
+
+    QScopedPointer<QQuickRenderControl> renderControl(new QQuickRenderControl);
+    QScopedPointer<QQuickWindow> quickWindow(new QQuickWindow(renderControl.data()));
+
+    QQmlEngine qmlEngine;
+    QQmlComponent qmlComponent(&qmlEngine, testFileUrl(QLatin1String("damage.qml")));
+    QScopedPointer<QQuickItem> rootItem(qobject_cast<QQuickItem *>(qmlComponent.create()));
+    QVERIFY2(rootItem, qPrintable(qmlComponent.errorString()));
+    QQuickItem *small = rootItem->findChild<QQuickItem *>(QStringLiteral("small"));
+    QVERIFY(small);
+
+    quickWindow->contentItem()->setSize(rootItem->size());
+    quickWindow->setGeometry(0, 0, rootItem->width(), rootItem->height());
+    rootItem->setParentItem(quickWindow->contentItem());
+
+    if (!renderControl->initialize())
+        QSKIP("Could not initialize the Null QRhi backend, skipping");
+
+    QRhi *rhi = renderControl->rhi();
+    QVERIFY(rhi);
+
+    const QSize size = rootItem->size().toSize();
+    QScopedPointer<QRhiTexture> tex(rhi->newTexture(QRhiTexture::RGBA8, size, 1, QRhiTexture::RenderTarget));
+    QVERIFY(tex->create());
+    QScopedPointer<QRhiRenderBuffer> ds(rhi->newRenderBuffer(QRhiRenderBuffer::DepthStencil, size, 1));
+    QVERIFY(ds->create());
+    QRhiTextureRenderTargetDescription rtDesc(QRhiColorAttachment(tex.data()));
+    rtDesc.setDepthStencilBuffer(ds.data());
+    QScopedPointer<QRhiTextureRenderTarget> texRt(
+            rhi->newTextureRenderTarget(rtDesc, QRhiTextureRenderTarget::PreserveColorContents));
+    QScopedPointer<QRhiRenderPassDescriptor> rp(texRt->newCompatibleRenderPassDescriptor());
+    texRt->setRenderPassDescriptor(rp.data());
+    QVERIFY(texRt->create());
+    quickWindow->setRenderTarget(QQuickRenderTarget::fromRhiRenderTarget(texRt.data()));
+
+    const auto renderFrame = [&renderControl] {
+        renderControl->polishItems();
+        renderControl->beginFrame();
+        renderControl->sync();
+        renderControl->render();
+        renderControl->endFrame();
+        return renderControl->damageRegion();
+    };
+
+    // Everything is damaged in the first frame
+    QCOMPARE(renderFrame(), QRegion(0, 0, 200, 200));
+
+    // Nothing changed
+    QVERIFY(renderFrame().isEmpty());
+
+    // Moving the item damages where it was and where it is now
+    small->setX(100);
+    QRegion damage = renderFrame();
+    QVERIFY(damage.contains(QRect(10, 20, 30, 40)));
+    QVERIFY(damage.contains(QRect(100, 20, 30, 40)));
+    QVERIFY(!damage.contains(QPoint(70, 40)));
+    QVERIFY(!damage.contains(QPoint(150, 150)));
+
+    // Changing the color only damages the item itself
+    small->setProperty("color", QColor(Qt::red));
+    damage = renderFrame();
+    QVERIFY(damage.contains(QRect(100, 20, 30, 40)));
+    QVERIFY(!damage.contains(QPoint(20, 30)));
+    QVERIFY(damage.boundingRect().width() <= 32);
+
+    // Hiding the item damages the area it covered
+    small->setVisible(false);
+    damage = renderFrame();
+    QVERIFY(damage.contains(QRect(100, 20, 30, 40)));
+    QVERIFY(!damage.contains(QPoint(150, 150)));
+
+    // A new clear color damages everything
+    quickWindow->setColor(Qt::black);
+    QCOMPARE(renderFrame(), QRegion(0, 0, 200, 200));
+}
+
+void tst_RenderControl::partialBatchUpload()
+{
+    // The upload statistics are collected regardless of the graphics API
+    auto cleanup = qScopeGuard([] {
+        QQuickWindow::setGraphicsApi(QSGRendererInterface::Unknown);
+    });
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Null);
+
+    QScopedPointer<QQuickRenderControl> renderControl(new QQuickRenderControl);
+    QScopedPointer<QQuickWindow> quickWindow(new QQuickWindow(renderControl.data()));
+
+    QQmlEngine qmlEngine;
+    QQmlComponent qmlComponent(&qmlEngine, testFileUrl(QLatin1String("grid.qml")));
+    QScopedPointer<QQuickItem> rootItem(qobject_cast<QQuickItem *>(qmlComponent.create()));
+    QVERIFY2(rootItem, qPrintable(qmlComponent.errorString()));
+
+    quickWindow->contentItem()->setSize(rootItem->size());
+    quickWindow->setGeometry(0, 0, rootItem->width(), rootItem->height());
+    rootItem->setParentItem(quickWindow->contentItem());
+
+    if (!renderControl->initialize())
+        QSKIP("Could not initialize the Null QRhi backend, skipping");
+
+    QRhi *rhi = renderControl->rhi();
+    QVERIFY(rhi);
+
+    const QSize size = rootItem->size().toSize();
+    QScopedPointer<QRhiTexture> tex(rhi->newTexture(QRhiTexture::RGBA8, size, 1, QRhiTexture::RenderTarget));
+    QVERIFY(tex->create());
+    QScopedPointer<QRhiRenderBuffer> ds(rhi->newRenderBuffer(QRhiRenderBuffer::DepthStencil, size, 1));
+    QVERIFY(ds->create());
+    QRhiTextureRenderTargetDescription rtDesc(QRhiColorAttachment(tex.data()));
+    rtDesc.setDepthStencilBuffer(ds.data());
+    QScopedPointer<QRhiTextureRenderTarget> texRt(rhi->newTextureRenderTarget(rtDesc));
+    QScopedPointer<QRhiRenderPassDescriptor> rp(texRt->newCompatibleRenderPassDescriptor());
+    texRt->setRenderPassDescriptor(rp.data());
+    QVERIFY(texRt->create());
+    quickWindow->setRenderTarget(QQuickRenderTarget::fromRhiRenderTarget(texRt.data()));
+
+    const auto renderFrame = [&renderControl, &quickWindow] {
+        renderControl->polishItems();
+        renderControl->beginFrame();
+        renderControl->sync();
+        renderControl->render();
+        renderControl->endFrame();
+        return quickWindow->frameStatistics().uploadedVertexBytes;
+    };
+
+    // All 400 rectangles are merged into one batch and uploaded
+    const qint64 fullUpload = renderFrame();
+    QVERIFY(fullUpload >= 400 * 4 * 12); // 4 vertices with position and color each
+    QCOMPARE(quickWindow->frameStatistics().batchCount, 1);
+
+    QCOMPARE(renderFrame(), 0);
+
+    // Changing the color of one rectangle only uploads its own data
+    rootItem->setProperty("highlighted", 42);
+    const qint64 partialUpload = renderFrame();
+    QVERIFY(partialUpload > 0);
+    QVERIFY2(partialUpload * 100 < fullUpload, QByteArray::number(partialUpload));
+
+    rootItem->setProperty("highlighted", 43);
+    QVERIFY(renderFrame() * 50 < fullUpload);
+    QCOMPARE(quickWindow->frameStatistics().batchCount, 1);
+
+    // Updating the batch every frame makes its buffers dynamic, like full
+    // uploads do, which takes one more full upload
+    int fullUploads = 0;
+    for (int i = 0; i < 10; ++i) {
+        rootItem->setProperty("highlighted", 100 + i);
+        const qint64 uploaded = renderFrame();
+        QVERIFY(uploaded > 0);
+        if (uploaded * 2 > fullUpload)
+            ++fullUploads;
+    }
+    QCOMPARE(fullUploads, 1);
+    QCOMPARE(quickWindow->frameStatistics().batchCount, 1);
+}
+
+void tst_RenderControl::partialBatchUploadContents_data()
+{
+    renderAndReadBackWithRhi_data();
+}
+
+void tst_RenderControl::partialBatchUploadContents()
+{
+    QFETCH(QSGRendererInterface::GraphicsApi, api);
+
+#if QT_CONFIG(vulkan)
+    if (api == QSGRendererInterface::Vulkan && !vulkanInstance.isValid())
+        QSKIP("Skipping Vulkan-based QRhi readback test due to failing to create a VkInstance");
+#endif
+
+#ifdef Q_OS_ANDROID
+    // QTBUG-102780
+    if (api == QSGRendererInterface::Vulkan)
+        QSKIP("Vulkan-based rendering tests on Android are flaky.");
+#endif
+
+    auto cleanup = qScopeGuard([] {
+        QQuickWindow::setGraphicsApi(QSGRendererInterface::Unknown);
+    });
+    QQuickWindow::setGraphicsApi(api);
+
+    QScopedPointer<QQuickRenderControl> renderControl(new QQuickRenderControl);
+    QScopedPointer<QQuickWindow> quickWindow(new QQuickWindow(renderControl.data()));
+#if QT_CONFIG(vulkan)
+    if (api == QSGRendererInterface::Vulkan)
+        quickWindow->setVulkanInstance(&vulkanInstance);
+#endif
+
+    QQmlEngine qmlEngine;
+    QQmlComponent qmlComponent(&qmlEngine, testFileUrl(QLatin1String("grid.qml")));
+    QScopedPointer<QQuickItem> rootItem(qobject_cast<QQuickItem *>(qmlComponent.create()));
+    QVERIFY2(rootItem, qPrintable(qmlComponent.errorString()));
+
+    quickWindow->contentItem()->setSize(rootItem->size());
+    quickWindow->setGeometry(0, 0, rootItem->width(), rootItem->height());
+    rootItem->setParentItem(quickWindow->contentItem());
+
+    if (!renderControl->initialize())
+        QSKIP("Could not initialize graphics, perhaps unsupported graphics API, skipping");
+
+    QRhi *rhi = renderControl->rhi();
+    QVERIFY(rhi);
+
+    const QSize size = rootItem->size().toSize();
+    QScopedPointer<QRhiTexture> tex(rhi->newTexture(QRhiTexture::RGBA8, size, 1,
+                                                    QRhiTexture::RenderTarget | QRhiTexture::UsedAsTransferSource));
+    QVERIFY(tex->create());
+    QScopedPointer<QRhiRenderBuffer> ds(rhi->newRenderBuffer(QRhiRenderBuffer::DepthStencil, size, 1));
+    QVERIFY(ds->create());
+    QRhiTextureRenderTargetDescription rtDesc(QRhiColorAttachment(tex.data()));
+    rtDesc.setDepthStencilBuffer(ds.data());
+    QScopedPointer<QRhiTextureRenderTarget> texRt(rhi->newTextureRenderTarget(rtDesc));
+    QScopedPointer<QRhiRenderPassDescriptor> rp(texRt->newCompatibleRenderPassDescriptor());
+    texRt->setRenderPassDescriptor(rp.data());
+    QVERIFY(texRt->create());
+    quickWindow->setRenderTarget(QQuickRenderTarget::fromRhiRenderTarget(texRt.data()));
+
+    const auto renderFrame = [&] {
+        renderControl->polishItems();
+        renderControl->beginFrame();
+        renderControl->sync();
+        renderControl->render();
+
+        QRhiReadbackResult readResult;
+        QImage result;
+        readResult.completed = [&readResult, &result, rhi] {
+            QImage wrapperImage(reinterpret_cast<const uchar *>(readResult.data.constData()),
+                                readResult.pixelSize.width(), readResult.pixelSize.height(),
+                                QImage::Format_RGBA8888_Premultiplied);
+            if (rhi->isYUpInFramebuffer())
+                result = wrapperImage.flipped();
+            else
+                result = wrapperImage.copy();
+        };
+        QRhiResourceUpdateBatch *readbackBatch = rhi->nextResourceUpdateBatch();
+        readbackBatch->readBackTexture(tex.data(), &readResult);
+        renderControl->commandBuffer()->resourceUpdate(readbackBatch);
+
+        renderControl->endFrame();
+        return result;
+    };
+    const auto cellCenter = [](int index) {
+        return QPoint((index % 20) * 10 + 4, (index / 20) * 10 + 4);
+    };
+    const auto isRed = [](QRgb c) {
+        return qRed(c) > 250 && qGreen(c) < 5 && qBlue(c) < 5;
+    };
+
+    const QImage initial = renderFrame();
+    QVERIFY(!initial.isNull());
+    const qint64 fullUpload = quickWindow->frameStatistics().uploadedVertexBytes;
+    QVERIFY(!isRed(initial.pixel(cellCenter(42))));
+
+    // Update the batch in place often enough for its buffers to become
+    // dynamic. The contents must be right with both kinds of buffers.
+    QImage partial;
+    for (int i = 0; i < 10; ++i) {
+        const int highlighted = 42 + i * 21;
+        rootItem->setProperty("highlighted", highlighted);
+        partial = renderFrame();
+        QVERIFY(!partial.isNull());
+        QVERIFY2(isRed(partial.pixel(cellCenter(highlighted))), qPrintable(QString::number(i)));
+        if (i > 0)
+            QVERIFY2(!isRed(partial.pixel(cellCenter(highlighted - 21))), qPrintable(QString::number(i)));
+    }
+
+    // Removing an item and adding it back uploads the whole batch again,
+    // which must not change the result
+    QQuickItem *cell = rootItem->childItems().last();
+    cell->setVisible(false);
+    renderFrame();
+    cell->setVisible(true);
+    const QImage full = renderFrame();
+    QVERIFY(quickWindow->frameStatistics().uploadedVertexBytes * 2 > fullUpload);
+    QCOMPARE(full, partial);
+}
+
 #include "tst_qquickrendercontrol.moc"
 
 QTEST_MAIN(tst_RenderControl)
@@ -8,6 +8,7 @@
 #include <QtQuick/qquickview.h>
 #include <QtQuick/private/qquicktableview_p.h>
 #include <QtQuick/private/qquicktableview_p_p.h>
+#include <QtQuick/private/qquicktableviewsizemodel_p.h>
 #include <QtQuick/private/qquickloader_p.h>
 #include <QtQuick/private/qquickdraghandler_p.h>
 #include <QtQuick/private/qquicktextinput_p.h>
@@ -308,6 +309,11 @@ private slots:
 
     void delegateModelAccess_data();
     void delegateModelAccess();
+    void incubationBudget();
+    void prefetchMargin();
+    void sizeModel();
+    void explicitSizesInEstimates();
+    void rebaseContentPosition();
 
     // Row and column reordering
     void checkVisualRowColumnAfterReorder();
@@ -8642,6 +8648,205 @@ void tst_QQuickTableView::checkSelectionAfterReorder()
     QCOMPARE(selectionModel.hasSelection(), false);
 }
 
+void tst_QQuickTableView::incubationBudget()
+{
+    // Check that a column flicked into view is first filled with
+    // placeholders, which are replaced once the delegate items are ready.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    auto model = TestModelAsVariant(100, 100);
+    tableView->setModel(model);
+    tableView->setReuseItems(false);
+    tableView->setIncubationBudget(5);
+
+    WAIT_UNTIL_POLISHED;
+
+    QVERIFY(tableViewPrivate->placeholderItems.isEmpty());
+    const int rightColumn = tableView->rightColumn();
+
+    tableView->setContentX(150);
+    tableView->polish();
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->rightColumn(), rightColumn + 1);
+    const QPoint cell(rightColumn + 1, tableView->topRow());
+    QVERIFY(tableViewPrivate->placeholderItems.size() > 0);
+    QVERIFY(tableView->itemAtCell(cell));
+    QVERIFY(tableView->itemAtCell(cell)->objectName().isEmpty());
+
+    QTRY_VERIFY(tableViewPrivate->placeholderItems.isEmpty());
+    QQuickItem *item = tableView->itemAtCell(cell);
+    QVERIFY(item);
+    QCOMPARE(item->objectName(), QStringLiteral("tableViewDelegate"));
+    QVERIFY(item->isVisible());
+    QCOMPARE(item->width(), 100);
+    QCOMPARE(item->x(), tableView->itemAtCell(cell - QPoint(1, 0))->x() + 101);
+}
+
+class PrefetchTestModel : public TestModel
+{
+public:
+    using TestModel::TestModel;
+
+    void multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const override
+    {
+        m_requestedCells.append(QPoint(index.column(), index.row()));
+        TestModel::multiData(index, roleDataSpan);
+    }
+
+    mutable QList<QPoint> m_requestedCells;
+};
+
+void tst_QQuickTableView::prefetchMargin()
+{
+    // Check that the cells around the loaded table are requested from the
+    // model ahead of time, and that their delegate items get that data.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    auto model = new PrefetchTestModel(100, 100);
+    tableView->setPrefetchMargin(1);
+    tableView->setModel(QVariant::fromValue(QSharedPointer<TestModel>(model)));
+
+    WAIT_UNTIL_POLISHED;
+
+    const int rightColumn = tableView->rightColumn();
+    const int bottomRow = tableView->bottomRow();
+    QVERIFY(model->m_requestedCells.contains(QPoint(rightColumn + 1, 0)));
+    QVERIFY(model->m_requestedCells.contains(QPoint(0, bottomRow + 1)));
+    QVERIFY(!model->m_requestedCells.contains(QPoint(rightColumn + 2, 0)));
+    QVERIFY(!model->m_requestedCells.contains(QPoint(0, bottomRow + 2)));
+
+    // Cells with delegate items aren't prefetched.
+    QVERIFY(!model->m_requestedCells.contains(QPoint(0, 0)));
+
+    tableView->setContentX(50);
+    tableView->polish();
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->rightColumn(), rightColumn + 1);
+    const QPoint cell(rightColumn + 1, 0);
+    QQuickItem *item = tableView->itemAtCell(cell);
+    QVERIFY(item);
+    QCOMPARE(item->property("modelDataBinding").toString(), QStringLiteral("0"));
+    QCOMPARE(model->m_requestedCells.count(cell), 1);
+    QVERIFY(model->m_requestedCells.contains(QPoint(rightColumn + 2, 0)));
+}
+
+void tst_QQuickTableView::sizeModel()
+{
+    QQuickTableViewSizeModel sizes;
+    QVERIFY(sizes.isEmpty());
+    QCOMPARE(sizes.sizeOf(0, 1000000000, 10.0), 1e10);
+    QCOMPARE(sizes.offset(500000000, 10.0, 1.0), 5.5e9);
+    QCOMPARE(sizes.indexAt(5.5e9, 10.0, 1.0, 1000000000), 500000000);
+    QCOMPARE(sizes.indexAt(-10.0, 10.0, 1.0, 1000000000), 0);
+    QCOMPARE(sizes.indexAt(2e10, 10.0, 1.0, 1000000000), 999999999);
+
+    sizes.insert(5, 100);
+    sizes.insert(2, 0);
+    sizes.insert(100000000, 1010);
+    QCOMPARE(sizes.count(), 3);
+    QVERIFY(sizes.contains(2));
+    QCOMPARE(sizes.size(5, 10), 100.0);
+    QCOMPARE(sizes.size(6, 10), 10.0);
+
+    // Sections 0, 1, 3 and 4 have the default size, 2 is hidden and 5 is 100
+    QCOMPARE(sizes.sizeOf(0, 6, 10), 140.0);
+    QCOMPARE(sizes.offset(5, 10, 1), 45.0);
+    QCOMPARE(sizes.offset(6, 10, 1), 146.0);
+    QCOMPARE(sizes.offset(100000001, 10, 1),
+             (100000001 - 3) * 10.0 + 1110.0 + 100000001);
+
+    QCOMPARE(sizes.indexAt(21, 10, 1, 1000), 1);
+    QCOMPARE(sizes.indexAt(22, 10, 1, 1000), 2);
+    QCOMPARE(sizes.indexAt(23, 10, 1, 1000), 3);
+    QCOMPARE(sizes.indexAt(44, 10, 1, 1000), 4);
+    QCOMPARE(sizes.indexAt(45, 10, 1, 1000), 5);
+    QCOMPARE(sizes.indexAt(145, 10, 1, 1000), 5);
+    QCOMPARE(sizes.indexAt(146, 10, 1, 1000), 6);
+    QCOMPARE(sizes.indexAt(157, 10, 1, 1000), 7);
+    QCOMPARE(sizes.indexAt(1e6, 10, 1, 1000), 999);
+
+    const qreal offset = sizes.offset(100000000, 10, 1);
+    QCOMPARE(sizes.indexAt(offset - 1, 10, 1, 1000000000), 99999999);
+    QCOMPARE(sizes.indexAt(offset + 1000, 10, 1, 1000000000), 100000000);
+    QCOMPARE(sizes.indexAt(offset + 1011, 10, 1, 1000000000), 100000001);
+
+    sizes.insert(5, 10);
+    QCOMPARE(sizes.offset(6, 10, 1), 56.0);
+    QVERIFY(sizes.remove(2));
+    QVERIFY(!sizes.remove(2));
+    QCOMPARE(sizes.offset(6, 10, 1), 66.0);
+
+    sizes.clear();
+    QVERIFY(sizes.isEmpty());
+    QCOMPARE(sizes.offset(6, 10, 1), 66.0);
+}
+
+void tst_QQuickTableView::explicitSizesInEstimates()
+{
+    // Check that the explicit size of a row that is not loaded is
+    // taken into account when estimating the content height, and
+    // which row to show after jumping to a new content position.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    auto model = TestModelAsVariant(1000, 10);
+    tableView->setModel(model);
+
+    WAIT_UNTIL_POLISHED;
+
+    const qreal contentHeight = tableView->contentHeight();
+    tableView->setRowHeight(900, 5050);
+
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->contentHeight(), contentHeight + 5000);
+
+    tableView->setContentY(950 * 51 + 5000);
+    tableView->polish();
+
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->topRow(), 950);
+}
+
+void tst_QQuickTableView::rebaseContentPosition()
+{
+    // Check that positioning the view at a row far out in a huge table moves
+    // the content view back towards zero, without affecting the visible area.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    const int rows = 100000000;
+    auto model = TestModelAsVariant(rows, 10);
+    tableView->setModel(model);
+
+    WAIT_UNTIL_POLISHED;
+
+    const int row = 50000000;
+    tableView->positionViewAtRow(row, QQuickTableView::AlignTop);
+
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->topRow(), row);
+    QVERIFY(qAbs(tableView->contentY()) < kRebaseDistance);
+    QVERIFY(qAbs(tableViewPrivate->loadedTableOuterRect.top()) < kRebaseDistance);
+    QCOMPARE(tableView->itemAtCell(QPoint(0, row))->y(), tableView->contentY());
+    QCOMPARE(tableView->contentY() - tableView->originY(), row * 51.0);
+
+    // Flicking a little should not move the content view again
+    tableView->setContentY(tableView->contentY() + 100);
+    QCOMPARE(tableView->contentY() - tableView->originY(), row * 51.0 + 100);
+
+    // Going back to the beginning should rebase the content view once more
+    tableView->positionViewAtRow(10, QQuickTableView::AlignTop);
+
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->topRow(), 10);
+    QVERIFY(qAbs(tableView->contentY()) < kRebaseDistance);
+    QCOMPARE(tableView->itemAtCell(QPoint(0, 10))->y(), tableView->contentY());
+}
+
 QTEST_MAIN(tst_QQuickTableView)
 
 #include "tst_qquicktableview.moc"
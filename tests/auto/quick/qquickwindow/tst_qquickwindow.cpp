@@ -26,6 +26,7 @@
 #include <QSGRendererInterface>
 #include <QQuickRenderControl>
 #include <QOperatingSystemVersion>
+#include <QScopeGuard>
 #include <functional>
 #include <QtGui/private/qeventpoint_p.h>
 #include <rhi/qrhi.h>
@@ -506,6 +507,8 @@ private slots:
 
     void animatingSignal();
     void frameSignals();
+    void frameStatistics();
+    void occlusionCulling();
 
     void contentItemSize();
 
@@ -2491,6 +2494,98 @@ void tst_qquickwindow::frameSignals()
     QTRY_COMPARE(beforeSpy.size(), afterSpy.size());
 }
 
+void tst_qquickwindow::frameStatistics()
+{
+    QQuickWindow window;
+    window.setTitle(QTest::currentTestFunction());
+    window.setGeometry(100, 100, 300, 200);
+
+    QQuickWindow::FrameStatistics statistics = window.frameStatistics();
+    QCOMPARE(statistics.renderTime, 0);
+    QCOMPARE(statistics.batchCount, 0);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(QByteArray("import QtQuick\n"
+                                 "Item {\n"
+                                 "    Rectangle { width: 100; height: 100; color: \"red\" }\n"
+                                 "    Rectangle { x: 50; width: 100; height: 100; color: \"#8000ff00\" }\n"
+                                 "}"), QUrl());
+    QScopedPointer<QQuickItem> scene(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY(scene);
+    scene->setParentItem(window.contentItem());
+
+    QSignalSpy swappedSpy(&window, &QQuickWindow::frameSwapped);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QTRY_VERIFY(swappedSpy.size() > 0);
+
+    QTRY_VERIFY(window.frameStatistics().renderTime > 0);
+    statistics = window.frameStatistics();
+    QVERIFY(statistics.polishTime >= 0);
+    QVERIFY(statistics.animationTime >= 0);
+    QVERIFY(statistics.syncTime > 0);
+    QVERIFY(statistics.renderPrepareTime > 0);
+    QVERIFY(statistics.swapTime >= 0);
+
+    if (window.rendererInterface()->graphicsApi() == QSGRendererInterface::Software)
+        QSKIP("The counters are only collected by the batch renderer");
+
+    // One opaque and one semi-transparent rectangle
+    QCOMPARE(statistics.batchCount, 2);
+    QCOMPARE(statistics.mergedBatchCount + statistics.unmergedBatchCount, 2);
+    QVERIFY(statistics.materialChangeCount >= 1);
+}
+
+void tst_qquickwindow::occlusionCulling()
+{
+    // Occlusion culling is opt-in, and the renderer reads the setting when
+    // it is created.
+    qputenv("QSG_RENDERER_OCCLUDER_LIMIT", "8");
+    const auto cleanup = qScopeGuard([] { qunsetenv("QSG_RENDERER_OCCLUDER_LIMIT"); });
+
+    QQuickWindow window;
+    window.setTitle(QTest::currentTestFunction());
+    window.setGeometry(100, 100, 300, 200);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(QByteArray("import QtQuick\n"
+                                 "Item {\n"
+                                 "    property alias coverColor: cover.color\n"
+                                 "    property alias coverVisible: cover.visible\n"
+                                 "    property alias effectVisible: effect.visible\n"
+                                 "    Rectangle { width: 100; height: 100; color: \"red\" }\n"
+                                 "    Rectangle { id: cover; width: 200; height: 200; color: \"blue\" }\n"
+                                 "    ShaderEffect { id: effect; width: 200; height: 200; blending: false; visible: false }\n"
+                                 "}"), QUrl());
+    QScopedPointer<QQuickItem> scene(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY(scene);
+    scene->setParentItem(window.contentItem());
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QTRY_VERIFY(window.frameStatistics().renderTime > 0);
+
+    if (window.rendererInterface()->graphicsApi() == QSGRendererInterface::Software)
+        QSKIP("Occlusion culling is only done by the batch renderer");
+
+    // The red rectangle is hidden entirely by the blue one
+    QTRY_COMPARE(window.frameStatistics().culledNodeCount, 1);
+
+    // A semi-transparent rectangle does not hide anything
+    scene->setProperty("coverColor", QColor(0, 0, 255, 128));
+    QTRY_COMPARE(window.frameStatistics().culledNodeCount, 0);
+
+    scene->setProperty("coverColor", QColor(Qt::blue));
+    QTRY_COMPARE(window.frameStatistics().culledNodeCount, 1);
+
+    // Neither does an unblended custom material, as it may discard fragments
+    scene->setProperty("coverVisible", false);
+    scene->setProperty("effectVisible", true);
+    QTRY_COMPARE(window.frameStatistics().culledNodeCount, 0);
+}
+
 // QTBUG-36938
 void tst_qquickwindow::contentItemSize()
 {
@@ -0,0 +1,142 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QTest>
+
+#include <QtQuick/private/qsgareaallocator_p.h>
+
+#include <QtCore/QList>
+#include <QtCore/QRect>
+
+class tst_QSGAreaAllocator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void usedArea();
+    void fillAndFree();
+    void fragmentation();
+    void mergeAfterFragmentation();
+    void serializeKeepsUsage();
+
+private:
+    static QList<QRect> fillWithTiles(QSGAreaAllocator &allocator, int tileSize);
+    static bool isDark(const QRect &tile) { return (tile.x() / tile.width() + tile.y() / tile.height()) % 2 == 0; }
+};
+
+QList<QRect> tst_QSGAreaAllocator::fillWithTiles(QSGAreaAllocator &allocator, int tileSize)
+{
+    QList<QRect> tiles;
+    const int count = (allocator.size().width() / tileSize) * (allocator.size().height() / tileSize);
+    for (int i = 0; i < count; ++i) {
+        const QRect tile = allocator.allocate(QSize(tileSize, tileSize));
+        if (tile.isEmpty())
+            break;
+        tiles.append(tile);
+    }
+    return tiles;
+}
+
+void tst_QSGAreaAllocator::usedArea()
+{
+    QSGAreaAllocator allocator(QSize(256, 256));
+    QCOMPARE(allocator.usedArea(), 0);
+    QCOMPARE(allocator.freeArea(), 256 * 256);
+    QCOMPARE(allocator.largestFreeArea(), 256 * 256);
+    QCOMPARE(allocator.fragmentation(), 0.0);
+
+    const QRect rect = allocator.allocate(QSize(100, 100));
+    QCOMPARE(rect, QRect(0, 0, 100, 100));
+    QCOMPARE(allocator.usedArea(), 100 * 100);
+    QCOMPARE(allocator.freeArea(), 256 * 256 - 100 * 100);
+
+    QVERIFY(allocator.deallocate(rect));
+    QCOMPARE(allocator.usedArea(), 0);
+    QVERIFY(!allocator.deallocate(rect));
+    QCOMPARE(allocator.usedArea(), 0);
+    QCOMPARE(allocator.largestFreeArea(), 256 * 256);
+}
+
+void tst_QSGAreaAllocator::fillAndFree()
+{
+    QSGAreaAllocator allocator(QSize(256, 256));
+    const QList<QRect> tiles = fillWithTiles(allocator, 32);
+    QCOMPARE(tiles.size(), 64);
+    QCOMPARE(allocator.usedArea(), 256 * 256);
+    QCOMPARE(allocator.freeArea(), 0);
+    QCOMPARE(allocator.fragmentation(), 0.0);
+    QVERIFY(allocator.allocate(QSize(32, 32)).isEmpty());
+
+    // A single hole is not fragmented and can be reused.
+    QVERIFY(allocator.deallocate(tiles.at(10)));
+    QCOMPARE(allocator.freeArea(), 32 * 32);
+    QCOMPARE(allocator.fragmentation(), 0.0);
+    QCOMPARE(allocator.allocate(QSize(32, 32)), tiles.at(10));
+}
+
+void tst_QSGAreaAllocator::fragmentation()
+{
+    QSGAreaAllocator allocator(QSize(256, 256));
+    const QList<QRect> tiles = fillWithTiles(allocator, 32);
+    QCOMPARE(tiles.size(), 64);
+
+    for (const QRect &tile : tiles) {
+        if (isDark(tile))
+            QVERIFY(allocator.deallocate(tile));
+    }
+
+    // Half of the area is free, but only in pieces of a single tile.
+    QCOMPARE(allocator.usedArea(), 256 * 256 / 2);
+    QCOMPARE(allocator.freeArea(), 256 * 256 / 2);
+    QCOMPARE(allocator.largestFreeArea(), 32 * 32);
+    QVERIFY(allocator.fragmentation() > 0.9);
+    QVERIFY(allocator.allocate(QSize(64, 64)).isEmpty());
+    QCOMPARE(allocator.usedArea(), 256 * 256 / 2);
+}
+
+void tst_QSGAreaAllocator::mergeAfterFragmentation()
+{
+    QSGAreaAllocator allocator(QSize(256, 256));
+    const QList<QRect> tiles = fillWithTiles(allocator, 32);
+    QCOMPARE(tiles.size(), 64);
+
+    for (const QRect &tile : tiles) {
+        if (isDark(tile))
+            QVERIFY(allocator.deallocate(tile));
+    }
+    QVERIFY(allocator.fragmentation() > 0.9);
+
+    for (const QRect &tile : tiles) {
+        if (!isDark(tile))
+            QVERIFY(allocator.deallocate(tile));
+    }
+
+    // Freeing everything merges the free area back into one rectangle.
+    QCOMPARE(allocator.usedArea(), 0);
+    QCOMPARE(allocator.largestFreeArea(), 256 * 256);
+    QCOMPARE(allocator.fragmentation(), 0.0);
+    QCOMPARE(allocator.allocate(QSize(256, 256)), QRect(0, 0, 256, 256));
+}
+
+void tst_QSGAreaAllocator::serializeKeepsUsage()
+{
+    QSGAreaAllocator allocator(QSize(256, 256));
+    const QList<QRect> tiles = fillWithTiles(allocator, 32);
+    QCOMPARE(tiles.size(), 64);
+    for (const QRect &tile : tiles) {
+        if (isDark(tile))
+            QVERIFY(allocator.deallocate(tile));
+    }
+
+    const QByteArray data = allocator.serialize();
+    QSGAreaAllocator restored(QSize(1, 1));
+    QVERIFY(restored.deserialize(data.constData(), data.size()));
+    QCOMPARE(restored.size(), allocator.size());
+    QCOMPARE(restored.usedArea(), allocator.usedArea());
+    QCOMPARE(restored.largestFreeArea(), allocator.largestFreeArea());
+    QCOMPARE(restored.fragmentation(), allocator.fragmentation());
+}
+
+QTEST_GUILESS_MAIN(tst_QSGAreaAllocator)
+
+#include "tst_qsgareaallocator.moc"
@@ -0,0 +1,48 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+/*
+    A merged batch of opaque rectangles, and alpha batches of translucent
+    rectangles on top of them. Every rectangle takes four vertices, so the
+    first frame uploads (1 + 200 + 100) * 4 = 1204 vertices.
+*/
+
+Rectangle {
+    id: root
+    width: 200
+    height: 100
+    color: "white"
+
+    property int revision: 0
+
+    function change() {
+        ++revision
+    }
+
+    Repeater {
+        model: 200
+        Rectangle {
+            required property int index
+            x: (index % 20) * 10
+            y: Math.floor(index / 20) * 10
+            width: 10
+            height: 10
+            color: Qt.rgba((index * 7 % 20) / 20, (index * 13 % 20) / 20,
+                           (index + root.revision) % 3 == 0 ? 1 : 0, 1)
+        }
+    }
+
+    Repeater {
+        model: 100
+        Rectangle {
+            required property int index
+            x: (index % 10) * 20 + 5 + (index % 2 ? root.revision : 0)
+            y: Math.floor(index / 10) * 10 + 5
+            width: 10
+            height: 5
+            color: Qt.rgba(0, (index % 4) / 4, 1, 0.5)
+        }
+    }
+}
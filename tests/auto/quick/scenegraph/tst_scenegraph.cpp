@@ -98,6 +98,8 @@ private slots:
     void withAdoptedRhi();
     void resizeTextureFromImage();
     void textureNativeInterface();
+    void parallelUpload_data();
+    void parallelUpload();
 
 private:
     QQuickView *createView(const QString &file, QWindow *parent = nullptr, int x = -1, int y = -1, int w = -1, int h = -1);
@@ -841,6 +843,64 @@ void tst_SceneGraph::textureNativeInterface()
 #endif
 }
 
+void tst_SceneGraph::parallelUpload_data()
+{
+    QTest::addColumn<int>("vertexThreshold");
+
+    // parallelUpload.qml uploads 1204 vertices in its first frame.
+    QTest::newRow("every frame") << 1;
+    QTest::newRow("at threshold") << 1204;
+    QTest::newRow("below threshold") << 1205;
+}
+
+void tst_SceneGraph::parallelUpload()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping batch upload test due to not running with QRhi");
+
+    QFETCH(int, vertexThreshold);
+
+    const auto cleanup = qScopeGuard([] {
+        qunsetenv("QSG_RENDERER_UPLOAD_THREADS");
+        qunsetenv("QSG_RENDERER_UPLOAD_VERTEX_THRESHOLD");
+    });
+    qputenv("QSG_RENDERER_UPLOAD_VERTEX_THRESHOLD", QByteArray::number(vertexThreshold));
+
+    // The renderer reads the variables when it is created, so each
+    // configuration renders in a window of its own.
+    const auto render = [this](const QByteArray &threads, QList<QImage> *frames) {
+        qputenv("QSG_RENDERER_UPLOAD_THREADS", threads);
+        QQuickView view;
+        view.setSource(testFileUrl("parallelUpload.qml"));
+        view.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&view));
+        frames->append(view.grabWindow());
+
+        // Changed colors are uploaded into the merged batch as they are, and
+        // moved rectangles make the alpha batches upload again.
+        QVERIFY(QMetaObject::invokeMethod(view.rootObject(), "change"));
+        frames->append(view.grabWindow());
+    };
+
+    QList<QImage> serial;
+    render("1", &serial);
+    if (QTest::currentTestFailed())
+        return;
+    QList<QImage> parallel;
+    render("4", &parallel);
+    if (QTest::currentTestFailed())
+        return;
+
+    QCOMPARE(serial.size(), 2);
+    QCOMPARE(parallel.size(), serial.size());
+    QVERIFY(containsSomethingOtherThanWhite(serial.first()));
+    QString errorMessage;
+    for (qsizetype i = 0; i < serial.size(); ++i) {
+        QVERIFY2(compareImages(parallel.at(i), serial.at(i), &errorMessage),
+                 qPrintable(QStringLiteral("frame %1: %2").arg(i).arg(errorMessage)));
+    }
+}
+
 bool tst_SceneGraph::isRunningOnRhi()
 {
     static bool retval = false;
@@ -0,0 +1,21 @@
+import QtQuick
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "white"
+
+    Rectangle {
+        objectName: "animated"
+        width: 50
+        height: 50
+        color: "red"
+
+        NumberAnimation on x {
+            from: 0
+            to: 150
+            duration: 500
+            loops: Animation.Infinite
+        }
+    }
+}
@@ -0,0 +1,32 @@
+import QtQuick
+
+Rectangle {
+    width: 600
+    height: 400
+    color: "white"
+
+    Grid {
+        anchors.fill: parent
+        anchors.margins: 10
+        columns: 6
+        spacing: 5
+
+        Repeater {
+            model: 24
+            delegate: Rectangle {
+                required property int index
+                width: 90
+                height: 90
+                radius: 8
+                border.width: 2
+                color: Qt.hsla(index / 24, 0.5, 0.6, 0.7)
+                rotation: index % 5 === 0 ? 10 : 0
+
+                Text {
+                    anchors.centerIn: parent
+                    text: parent.index
+                }
+            }
+        }
+    }
+}
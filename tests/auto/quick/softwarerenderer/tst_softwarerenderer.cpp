@@ -5,7 +5,9 @@
 #include <QtQml>
 #include <QGuiApplication>
 
+#include <private/qquickwindow_p.h>
 #include <private/qsgrenderloop_p.h>
+#include <private/qsgsoftwarepixmaprenderer_p.h>
 
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 #include <QtQuickTestUtils/private/viewtestutils_p.h>
@@ -22,6 +24,8 @@ private slots:
     void initTestCase() override;
 
     void renderTarget();
+    void tiledRendering();
+    void pipelinedAnimation();
 };
 
 tst_SoftwareRenderer::tst_SoftwareRenderer()
@@ -31,6 +35,11 @@ tst_SoftwareRenderer::tst_SoftwareRenderer()
 
 void tst_SoftwareRenderer::initTestCase()
 {
+    // Only pipelinedAnimation() shows a window, the other tests render
+    // through QQuickRenderControl and do not depend on the render loop.
+    qputenv("QSG_RENDER_LOOP", "threaded");
+    qputenv("QSG_SOFTWARE_PIPELINED_RENDERING", "1");
+
     QQuickWindow::setGraphicsApi(QSGRendererInterface::Software);
     QSGRenderLoop *loop = QSGRenderLoop::instance();
     qDebug() << "RenderLoop:" << loop
@@ -89,6 +98,85 @@ void tst_SoftwareRenderer::renderTarget()
              qPrintable(errorMessage));
 }
 
+void tst_SoftwareRenderer::tiledRendering()
+{
+    if (QQuickWindow::sceneGraphBackend() != "software")
+        QSKIP("Skipping complex rendering tests due to not running with software");
+
+    QQuickRenderControl rc;
+    QQuickWindow window(&rc);
+    window.resize(600, 400);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("tiledRendering.qml"));
+    QScopedPointer<QQuickItem> scene(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(scene, qPrintable(component.errorString()));
+    scene->setParentItem(window.contentItem());
+
+    rc.polishItems();
+    rc.sync();
+
+    QQuickWindowPrivate *wd = QQuickWindowPrivate::get(&window);
+    QVERIFY(wd->renderer);
+
+    // Painting in tiles on several threads gives the same result as painting serially
+    const auto render = [&](int threads) {
+        QSGSoftwarePixmapRenderer renderer(wd->context);
+        renderer.setRootNode(wd->renderer->rootNode());
+        renderer.setRenderThreadCount(threads);
+        renderer.setDeviceRect(window.size());
+        renderer.setViewportRect(window.size());
+        renderer.setProjectionRect(QRect(QPoint(), window.size()));
+        renderer.setClearColor(Qt::white);
+
+        QImage image(window.size(), QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::red);
+        renderer.renderScene();
+        renderer.render(&image);
+        return image;
+    };
+
+    const QImage serial = render(1);
+    const QImage tiled = render(4);
+    QCOMPARE(serial.pixel(0, 0), qRgb(255, 255, 255));
+    QString errorMessage;
+    QVERIFY2(QQuickVisualTestUtils::compareImages(tiled, serial, &errorMessage),
+             qPrintable(errorMessage));
+}
+
+void tst_SoftwareRenderer::pipelinedAnimation()
+{
+    if (QQuickWindow::sceneGraphBackend() != "software")
+        QSKIP("Skipping complex rendering tests due to not running with software");
+    if (!QSGRenderLoop::instance()->inherits("QSGSoftwareThreadedRenderLoop"))
+        QSKIP("Skipping due to not running with the threaded software render loop");
+
+    QQuickView window;
+    window.setSource(testFileUrl("pipelinedAnimation.qml"));
+    QVERIFY(window.rootObject());
+    QQuickItem *animated = window.rootObject()->findChild<QQuickItem *>("animated");
+    QVERIFY(animated);
+
+    // Frames are swapped on the render thread
+    QAtomicInt frames;
+    connect(&window, &QQuickWindow::frameSwapped, this, [&frames] {
+        frames.fetchAndAddRelaxed(1);
+    }, Qt::DirectConnection);
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    // Syncs are deferred while the render thread is busy with the previous
+    // frame. Every one of them has to be picked up again, otherwise the
+    // window stops updating.
+    for (int i = 0; i < 3; ++i) {
+        const int framesBefore = frames.loadRelaxed();
+        const qreal xBefore = animated->x();
+        QTRY_VERIFY(frames.loadRelaxed() >= framesBefore + 10);
+        QTRY_VERIFY(animated->x() != xBefore);
+    }
+}
+
 #include "tst_softwarerenderer.moc"
 
 QTEST_MAIN(tst_SoftwareRenderer)
@@ -10,6 +10,9 @@
 #include <QtQml/qqmlexpression.h>
 #include <QtQml/qqmlincubator.h>
 #include <QtQuickShapes/private/qquickshape_p.h>
+#include <QtQuickShapes/private/qquickshapegenericrenderer_p.h>
+#include <QtGui/QPainterPath>
+#include <QtCore/QScopeGuard>
 #include <QStandardPaths>
 
 #include <QtQuickTestUtils/private/qmlutils_p.h>
@@ -65,6 +68,8 @@ private slots:
     void multilineStronglyTyped();
     void fillTransform();
     void changeElementsImperatively();
+    void triangulation_data();
+    void triangulation();
 
 private:
     QVector<QPolygonF> m_lowPolyLogo;
@@ -711,6 +716,167 @@ void tst_QQuickShape::changeElementsImperatively()
     QVERIFY(QQuickTest::showView(window, testFileUrl("changeElementsImperatively.qml")));
 }
 
+using Renderer = QQuickShapeGenericRenderer;
+
+struct Triangulation
+{
+    Renderer::VertexContainerType vertices;
+    Renderer::IndexContainerType indices;
+    QSGGeometry::Type indexType = QSGGeometry::UnsignedIntType;
+};
+
+// 16-bit indices are packed in pairs into the 32-bit index container.
+static QList<quint32> triangleIndices(const Triangulation &t)
+{
+    QList<quint32> indices;
+    if (t.indexType == QSGGeometry::UnsignedShortType) {
+        const quint16 *data = reinterpret_cast<const quint16 *>(t.indices.constData());
+        indices.assign(data, data + t.indices.size() * 2);
+    } else {
+        indices.assign(t.indices.cbegin(), t.indices.cend());
+    }
+    return indices;
+}
+
+static qreal triangleArea(const QSGGeometry::ColoredPoint2D &a, const QSGGeometry::ColoredPoint2D &b,
+                          const QSGGeometry::ColoredPoint2D &c)
+{
+    return qAbs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2;
+}
+
+static qreal totalArea(const Triangulation &t, bool strip)
+{
+    qreal area = 0;
+    if (strip) {
+        for (qsizetype i = 2; i < t.vertices.size(); ++i)
+            area += triangleArea(t.vertices.at(i - 2), t.vertices.at(i - 1), t.vertices.at(i));
+    } else {
+        const QList<quint32> indices = triangleIndices(t);
+        for (qsizetype i = 2; i < indices.size(); i += 3) {
+            area += triangleArea(t.vertices.at(indices.at(i - 2)), t.vertices.at(indices.at(i - 1)),
+                                 t.vertices.at(indices.at(i)));
+        }
+    }
+    return area;
+}
+
+static QRectF vertexBounds(const Triangulation &t)
+{
+    if (t.vertices.isEmpty())
+        return QRectF();
+    qreal left = t.vertices.first().x, right = left;
+    qreal top = t.vertices.first().y, bottom = top;
+    for (const QSGGeometry::ColoredPoint2D &v : t.vertices) {
+        left = qMin<qreal>(left, v.x);
+        right = qMax<qreal>(right, v.x);
+        top = qMin<qreal>(top, v.y);
+        bottom = qMax<qreal>(bottom, v.y);
+    }
+    return QRectF(QPointF(left, top), QPointF(right, bottom));
+}
+
+static bool hasColor(const Triangulation &t, const Renderer::Color4ub &color)
+{
+    return std::all_of(t.vertices.cbegin(), t.vertices.cend(), [&color](const QSGGeometry::ColoredPoint2D &v) {
+        return v.r == color.r && v.g == color.g && v.b == color.b && v.a == color.a;
+    });
+}
+
+static bool hasSamePositions(const Triangulation &a, const Triangulation &b)
+{
+    return std::equal(a.vertices.cbegin(), a.vertices.cend(), b.vertices.cbegin(), b.vertices.cend(),
+                      [](const QSGGeometry::ColoredPoint2D &v, const QSGGeometry::ColoredPoint2D &w) {
+        return v.x == w.x && v.y == w.y;
+    });
+}
+
+void tst_QQuickShape::triangulation_data()
+{
+    QTest::addColumn<bool>("stroke");
+
+    QTest::newRow("fill") << false;
+    QTest::newRow("stroke") << true;
+}
+
+void tst_QQuickShape::triangulation()
+{
+    QFETCH(bool, stroke);
+
+    // Enough separate subpaths for the path to be split into parts.
+    QPainterPath path;
+    for (int y = 0; y < 20; ++y) {
+        for (int x = 0; x < 20; ++x)
+            path.addEllipse(QRectF(x * 16, y * 16, 12, 12));
+    }
+
+    const int threadCount = Renderer::tessellationThreadCount();
+    const int cacheSize = Renderer::tessellationCacheSize();
+    auto cleanup = qScopeGuard([threadCount, cacheSize] {
+        Renderer::setTessellationThreadCount(threadCount);
+        Renderer::setTessellationCacheSize(cacheSize);
+        Renderer::clearTessellationCache();
+    });
+    Renderer::setTessellationCacheSize(8192);
+
+    QPen pen;
+    pen.setWidthF(2);
+    const auto triangulate = [&](const Renderer::Color4ub &color) {
+        Triangulation t;
+        if (stroke)
+            Renderer::triangulateStroke(path, pen, color, &t.vertices, QSize(400, 400), 1);
+        else
+            Renderer::triangulateFill(path, color, &t.vertices, &t.indices, &t.indexType, true, 1);
+        return t;
+    };
+
+    const Renderer::Color4ub red = { 255, 0, 0, 255 };
+    const Renderer::Color4ub blue = { 0, 0, 255, 128 };
+
+    Renderer::setTessellationThreadCount(1);
+    Renderer::clearTessellationCache();
+    const Triangulation serial = triangulate(red);
+    QVERIFY(!serial.vertices.isEmpty());
+    QVERIFY(hasColor(serial, red));
+
+    Renderer::setTessellationThreadCount(4);
+    Renderer::clearTessellationCache();
+    const Triangulation split = triangulate(red);
+    QVERIFY(!split.vertices.isEmpty());
+    QVERIFY(hasColor(split, red));
+
+    // The parts may be triangulated differently, but must cover the same area.
+    const qreal serialArea = totalArea(serial, stroke);
+    const qreal splitArea = totalArea(split, stroke);
+    QVERIFY2(qAbs(serialArea - splitArea) <= serialArea * 0.001,
+             qPrintable(QStringLiteral("serial area %1, split area %2").arg(serialArea).arg(splitArea)));
+    const QRectF serialBounds = vertexBounds(serial);
+    const QRectF splitBounds = vertexBounds(split);
+    QVERIFY2(qAbs(serialBounds.left() - splitBounds.left()) < 0.01
+                     && qAbs(serialBounds.top() - splitBounds.top()) < 0.01
+                     && qAbs(serialBounds.right() - splitBounds.right()) < 0.01
+                     && qAbs(serialBounds.bottom() - splitBounds.bottom()) < 0.01,
+             qPrintable(QStringLiteral("serial bounds %1,%2 %3x%4, split bounds %5,%6 %7x%8")
+                        .arg(serialBounds.x()).arg(serialBounds.y())
+                        .arg(serialBounds.width()).arg(serialBounds.height())
+                        .arg(splitBounds.x()).arg(splitBounds.y())
+                        .arg(splitBounds.width()).arg(splitBounds.height())));
+
+    // A cache hit with another color gives the same triangles in the new color,
+    // without affecting the result returned earlier.
+    const Triangulation cached = triangulate(blue);
+    QCOMPARE(cached.vertices.size(), split.vertices.size());
+    QVERIFY(hasSamePositions(cached, split));
+    QVERIFY(hasColor(cached, blue));
+    QCOMPARE(cached.indices, split.indices);
+    QCOMPARE(cached.indexType, split.indexType);
+    QVERIFY(hasColor(split, red));
+
+    const Triangulation cachedAgain = triangulate(red);
+    QVERIFY(hasSamePositions(cachedAgain, split));
+    QVERIFY(hasColor(cachedAgain, red));
+    QVERIFY(hasColor(cached, blue));
+}
+
 QTEST_MAIN(tst_QQuickShape)
 
 #include "tst_qquickshape.moc"
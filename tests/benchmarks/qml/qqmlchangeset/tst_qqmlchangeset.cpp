@@ -5,14 +5,47 @@
 
 #include <QDebug>
 
+#include <memory>
+
+#include <QtCore/qabstractitemmodel.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQuick/qquickitem.h>
+
 #include <private/qqmlchangeset_p.h>
 
+class StreamingModel : public QAbstractListModel
+{
+public:
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_count;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        return role == Qt::DisplayRole ? QVariant(index.row()) : QVariant();
+    }
+
+    void append()
+    {
+        beginInsertRows(QModelIndex(), m_count, m_count);
+        ++m_count;
+        endInsertRows();
+    }
+
+private:
+    int m_count = 0;
+};
+
 class tst_qqmlchangeset : public QObject
 {
     Q_OBJECT
 
 private slots:
     void move();
+    void streamingInserts_data();
+    void streamingInserts();
 };
 
 void tst_qqmlchangeset::move()
@@ -26,5 +59,57 @@ void tst_qqmlchangeset::move()
     }
 }
 
+void tst_qqmlchangeset::streamingInserts_data()
+{
+    QTest::addColumn<bool>("coalesceChanges");
+
+    QTest::newRow("immediate") << false;
+    QTest::newRow("coalesced") << true;
+}
+
+void tst_qqmlchangeset::streamingInserts()
+{
+    // A model that appends its rows one by one, within one turn of the event
+    // loop, and a ListView that is laid out once all of them are appended.
+    QFETCH(bool, coalesceChanges);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(R"(
+        import QtQuick
+        import QtQml.Models
+        ListView {
+            property alias sourceModel: delegateModel.model
+            property alias coalesceChanges: delegateModel.coalesceChanges
+            property int countChanges: 0
+            width: 240
+            height: 320
+            model: DelegateModel {
+                id: delegateModel
+                delegate: Item {
+                    width: 240
+                    height: 20
+                }
+            }
+            onCountChanged: ++countChanges
+        }
+    )", QUrl());
+    std::unique_ptr<QQuickItem> view(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(view, qPrintable(component.errorString()));
+
+    const int rowsPerTurn = 1000;
+    StreamingModel model;
+    view->setProperty("coalesceChanges", coalesceChanges);
+    view->setProperty("sourceModel", QVariant::fromValue(&model));
+
+    QBENCHMARK {
+        for (int i = 0; i < rowsPerTurn; ++i)
+            model.append();
+        QMetaObject::invokeMethod(view.get(), "forceLayout");
+    }
+
+    QCOMPARE(view->property("count").toInt(), model.rowCount());
+}
+
 QTEST_MAIN(tst_qqmlchangeset)
 #include "tst_qqmlchangeset.moc"
@@ -0,0 +1,116 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQmlModels/private/qqmldelegatemodel_p.h>
+#include <QtQmlModels/private/qqmllistmodel_p.h>
+
+class tst_qqmldelegatemodel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void sort();
+    void filter();
+    void insert();
+    void changeSortKey();
+
+private:
+    QQmlDelegateModel *createModel(int count);
+
+    QQmlEngine engine;
+    QScopedPointer<QObject> root;
+};
+
+static const char modelSource[] = R"(
+    import QtQml
+    import QtQml.Models
+
+    DelegateModel {
+        model: ListModel {}
+        delegate: QtObject {}
+
+        function fill(count) {
+            var rows = [];
+            for (var i = 0; i < count; ++i)
+                rows.push({ key: (i * 7919) % count, shown: i % 2 === 0 });
+            model.append(rows);
+        }
+
+        function insertRow(key) {
+            model.insert(0, { key: key, shown: true });
+        }
+    }
+)";
+
+static constexpr int rowCount = 100000;
+
+QQmlDelegateModel *tst_qqmldelegatemodel::createModel(int count)
+{
+    QQmlComponent component(&engine);
+    component.setData(modelSource, QUrl());
+    if (!component.isReady()) {
+        qWarning() << component.errorString();
+        return nullptr;
+    }
+    root.reset(component.create());
+    QMetaObject::invokeMethod(root.data(), "fill", Q_ARG(QVariant, count));
+    return qobject_cast<QQmlDelegateModel *>(root.data());
+}
+
+void tst_qqmldelegatemodel::sort()
+{
+    QQmlDelegateModel *model = createModel(rowCount);
+    QVERIFY(model);
+
+    QBENCHMARK {
+        model->setSortRole(QStringLiteral("key"));
+        model->setSortRole(QString());
+    }
+}
+
+void tst_qqmldelegatemodel::filter()
+{
+    QQmlDelegateModel *model = createModel(rowCount);
+    QVERIFY(model);
+
+    QBENCHMARK {
+        model->setFilterRole(QStringLiteral("shown"));
+        model->setFilterRole(QString());
+    }
+}
+
+void tst_qqmldelegatemodel::insert()
+{
+    QQmlDelegateModel *model = createModel(rowCount);
+    QVERIFY(model);
+    model->setSortRole(QStringLiteral("key"));
+    model->setFilterRole(QStringLiteral("shown"));
+
+    int key = 0;
+    QBENCHMARK {
+        QMetaObject::invokeMethod(model, "insertRow", Q_ARG(QVariant, key));
+        key = (key + 7919) % rowCount;
+    }
+}
+
+void tst_qqmldelegatemodel::changeSortKey()
+{
+    QQmlDelegateModel *model = createModel(rowCount);
+    QVERIFY(model);
+    model->setSortRole(QStringLiteral("key"));
+    QQmlListModel *source = qobject_cast<QQmlListModel *>(model->model().value<QObject *>());
+    QVERIFY(source);
+
+    int row = 0;
+    QBENCHMARK {
+        source->setProperty(row, QStringLiteral("key"), rowCount - row);
+        row = (row + 7919) % rowCount;
+    }
+}
+
+QTEST_MAIN(tst_qqmldelegatemodel)
+#include "tst_qqmldelegatemodel.moc"
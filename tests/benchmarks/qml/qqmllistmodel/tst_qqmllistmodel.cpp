@@ -0,0 +1,176 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQmlModels/private/qqmllistmodel_p.h>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#  include <malloc.h>
+#  define HAVE_MALLINFO2
+#endif
+
+using namespace Qt::StringLiterals;
+
+class tst_qqmllistmodel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void append_data() { storageModes(); }
+    void append();
+    void iterate_data() { storageModes(); }
+    void iterate();
+    void memory_data() { storageModes(); }
+    void memory();
+    void refresh_data();
+    void refresh();
+
+private:
+    void storageModes();
+    QObject *createFiller(bool columnar);
+
+    QQmlEngine engine;
+};
+
+// A log-like model: a handful of flat roles, with heavily repeated strings
+static const char fillerSource[] = R"(
+    import QtQml
+    import QtQml.Models
+
+    QtObject {
+        property ListModel model: ListModel { columnarStorage: %1 }
+
+        function rows(count) {
+            var levels = [ "debug", "info", "warning", "critical" ];
+            var result = [];
+            for (var i = 0; i < count; ++i) {
+                result.push({
+                    level: levels[i % 4],
+                    category: "qt.qml.category" + (i % 16),
+                    message: "message " + (i % 500),
+                    line: i,
+                    timestamp: 1700000000000 + i,
+                    handled: i % 3 === 0
+                });
+            }
+            return result;
+        }
+
+        function fill(count) {
+            model.append(rows(count));
+        }
+
+        function refresh(count, bulk) {
+            var data = rows(count);
+            if (bulk) {
+                model.replace(data);
+            } else {
+                model.clear();
+                for (var i = 0; i < data.length; ++i)
+                    model.append(data[i]);
+            }
+        }
+    }
+)";
+
+void tst_qqmllistmodel::storageModes()
+{
+    QTest::addColumn<bool>("columnar");
+    QTest::newRow("elements") << false;
+    QTest::newRow("columnar") << true;
+}
+
+QObject *tst_qqmllistmodel::createFiller(bool columnar)
+{
+    QQmlComponent component(&engine);
+    component.setData(QString::fromLatin1(fillerSource)
+                              .arg(columnar ? "true"_L1 : "false"_L1).toUtf8(), QUrl());
+    if (!component.isReady()) {
+        qWarning() << component.errorString();
+        return nullptr;
+    }
+    return component.create();
+}
+
+void tst_qqmllistmodel::append()
+{
+    QFETCH(bool, columnar);
+
+    QBENCHMARK {
+        QScopedPointer<QObject> filler(createFiller(columnar));
+        QVERIFY(filler);
+        QMetaObject::invokeMethod(filler.data(), "fill", Q_ARG(QVariant, 20000));
+    }
+}
+
+void tst_qqmllistmodel::iterate()
+{
+    QFETCH(bool, columnar);
+
+    QScopedPointer<QObject> filler(createFiller(columnar));
+    QVERIFY(filler);
+    QMetaObject::invokeMethod(filler.data(), "fill", Q_ARG(QVariant, 200000));
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(
+            filler->property("model").value<QObject *>());
+    QVERIFY(model);
+    const int line = model->roleNames().key("line");
+
+    double sum = 0;
+    QBENCHMARK {
+        for (int i = 0, end = model->count(); i < end; ++i)
+            sum += model->data(i, line).toDouble();
+    }
+    QVERIFY(sum > 0);
+}
+
+void tst_qqmllistmodel::memory()
+{
+#ifdef HAVE_MALLINFO2
+    QFETCH(bool, columnar);
+
+    QScopedPointer<QObject> filler(createFiller(columnar));
+    QVERIFY(filler);
+
+    // Measure the model's footprint after the temporary JS rows are gone
+    engine.collectGarbage();
+    const size_t before = mallinfo2().uordblks;
+    QMetaObject::invokeMethod(filler.data(), "fill", Q_ARG(QVariant, 200000));
+    engine.collectGarbage();
+    const size_t after = mallinfo2().uordblks;
+
+    QTest::setBenchmarkResult(qreal(after > before ? after - before : 0), QTest::BytesAllocated);
+#else
+    QSKIP("Heap statistics are not available on this platform");
+#endif
+}
+
+void tst_qqmllistmodel::refresh_data()
+{
+    QTest::addColumn<bool>("columnar");
+    QTest::addColumn<bool>("bulk");
+    QTest::newRow("elements, append") << false << false;
+    QTest::newRow("elements, replace") << false << true;
+    QTest::newRow("columnar, append") << true << false;
+    QTest::newRow("columnar, replace") << true << true;
+}
+
+void tst_qqmllistmodel::refresh()
+{
+    QFETCH(bool, columnar);
+    QFETCH(bool, bulk);
+
+    QScopedPointer<QObject> filler(createFiller(columnar));
+    QVERIFY(filler);
+    QMetaObject::invokeMethod(filler.data(), "fill", Q_ARG(QVariant, 50000));
+
+    QBENCHMARK {
+        QMetaObject::invokeMethod(filler.data(), "refresh", Q_ARG(QVariant, 50000),
+                                  Q_ARG(QVariant, bulk));
+    }
+}
+
+QTEST_MAIN(tst_qqmllistmodel)
+#include "tst_qqmllistmodel.moc"
@@ -23,6 +23,8 @@ public slots:
 private slots:
     void lookup_data();
     void lookup();
+    void lookupDepth_data();
+    void lookupDepth();
 
 private:
     QQmlEngine engine;
@@ -68,5 +70,34 @@ void tst_qmlmetaproperty::lookup()
     delete obj;
 }
 
+void tst_qmlmetaproperty::lookupDepth_data()
+{
+    QTest::addColumn<QString>("name");
+
+    // From the most derived cache down to QObject
+    QTest::newRow("own property") << QStringLiteral("progress");
+    QTest::newRow("own signal handler") << QStringLiteral("onActivated");
+    QTest::newRow("Rectangle property") << QStringLiteral("color");
+    QTest::newRow("Item property") << QStringLiteral("x");
+    QTest::newRow("QObject property") << QStringLiteral("objectName");
+    QTest::newRow("missing") << QStringLiteral("doesNotExist");
+}
+
+void tst_qmlmetaproperty::lookupDepth()
+{
+    QFETCH(QString, name);
+
+    QQmlComponent c(&engine, SRCDIR "/data/derived_object.qml");
+    QVERIFY(c.isReady());
+
+    QObject *obj = c.create();
+
+    QBENCHMARK {
+        QQmlProperty p(obj, name);
+    }
+
+    delete obj;
+}
+
 QTEST_MAIN(tst_qmlmetaproperty)
 #include "tst_qqmlmetaproperty.moc"
@@ -0,0 +1,26 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+Item {
+    id: root
+    width: 1000
+    height: 1000
+
+    // Changes the color of one in fifty cells, without moving anything
+    property int phase: 0
+
+    Repeater {
+        model: 10000
+        delegate: Rectangle {
+            required property int index
+            x: (index % 100) * 10
+            y: Math.floor(index / 100) * 10
+            width: 9
+            height: 9
+            color: Qt.hsla(((index + (index % 50 === root.phase % 50 ? root.phase : 0)) % 100) / 100,
+                           0.5, 0.5, 1)
+        }
+    }
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+Item {
+    id: root
+    width: 800
+    height: 1080
+
+    // Every step scrolls a new row of delegates in and an old one out
+    property int phase: 0
+
+    ListView {
+        anchors.fill: parent
+        model: 100000
+        cacheBuffer: 0
+        contentY: root.phase * 36
+        delegate: Rectangle {
+            required property int index
+            width: ListView.view.width
+            height: 36
+            color: index % 2 ? "lightsteelblue" : "white"
+
+            Rectangle {
+                x: 8
+                y: 6
+                width: 24
+                height: 24
+                radius: 12
+                color: Qt.hsla((parent.index % 30) / 30, 0.5, 0.6, 1)
+            }
+
+            Text {
+                x: 40
+                anchors.verticalCenter: parent.verticalCenter
+                text: "Delegate " + parent.index
+                font.pixelSize: 14
+            }
+
+            Rectangle {
+                anchors.bottom: parent.bottom
+                width: parent.width
+                height: 1
+                color: "gray"
+                opacity: 0.5
+            }
+        }
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+Item {
+    id: root
+    width: 1920
+    height: 1080
+
+    // Moving every item makes the renderer merge and upload all batches again
+    property int phase: 0
+
+    Repeater {
+        model: 4000
+        delegate: Rectangle {
+            required property int index
+            x: (index % 80) * 24 + root.phase % 2
+            y: Math.floor(index / 80) * 21
+            width: 22
+            height: 19
+            radius: 3
+            color: Qt.hsla((index % 80) / 80, 0.5, 0.6, 1)
+
+            Text {
+                anchors.centerIn: parent
+                text: parent.index % 1000
+                font.pixelSize: 9
+            }
+        }
+    }
+}
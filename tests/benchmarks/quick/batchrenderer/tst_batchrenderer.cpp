@@ -0,0 +1,131 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QtCore/qthread.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQuick/qquickitem.h>
+#include <QtQuick/qquickrendercontrol.h>
+#include <QtQuick/qquickrendertarget.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuickTestUtils/private/qmlutils_p.h>
+#include <rhi/qrhi.h>
+
+#include <memory>
+
+class tst_batchrenderer : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_batchrenderer();
+
+private slots:
+    void initTestCase() override;
+
+    void uploadBatches_data();
+    void uploadBatches();
+    void scrollList();
+    void updateColors();
+
+private:
+    void benchmarkScene(const QString &fileName);
+};
+
+tst_batchrenderer::tst_batchrenderer()
+    : QQmlDataTest(QT_QMLTEST_DATADIR)
+{
+}
+
+void tst_batchrenderer::initTestCase()
+{
+    // The Null backend makes the measurement independent of the GPU and driver
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Null);
+    QQmlDataTest::initTestCase();
+}
+
+void tst_batchrenderer::uploadBatches_data()
+{
+    QTest::addColumn<int>("threads");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+}
+
+void tst_batchrenderer::uploadBatches()
+{
+    // Measure frames in which the geometry of thousands of rectangle and
+    // text nodes has to be merged and uploaded again.
+    QFETCH(int, threads);
+    qputenv("QSG_RENDERER_UPLOAD_THREADS", QByteArray::number(threads));
+
+    benchmarkScene("scene.qml");
+
+    qunsetenv("QSG_RENDERER_UPLOAD_THREADS");
+}
+
+void tst_batchrenderer::scrollList()
+{
+    // Measure frames in which list delegates enter and leave the scene, so
+    // that batches are added to and removed from a batch root.
+    benchmarkScene("list.qml");
+}
+
+void tst_batchrenderer::updateColors()
+{
+    // Measure frames in which only the color of some cells of a large grid
+    // changes, so that the merged batch is updated in place.
+    benchmarkScene("heatmap.qml");
+}
+
+void tst_batchrenderer::benchmarkScene(const QString &fileName)
+{
+    QQuickRenderControl renderControl;
+    QQuickWindow window(&renderControl);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl(fileName));
+    std::unique_ptr<QQuickItem> scene(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(scene, qPrintable(component.errorString()));
+    const QSize size = scene->size().toSize();
+    window.contentItem()->setSize(scene->size());
+    window.setGeometry(0, 0, size.width(), size.height());
+    scene->setParentItem(window.contentItem());
+
+    if (!renderControl.initialize())
+        QSKIP("Could not initialize the Null QRhi backend");
+
+    QRhi *rhi = renderControl.rhi();
+    std::unique_ptr<QRhiTexture> texture(rhi->newTexture(QRhiTexture::RGBA8, size, 1, QRhiTexture::RenderTarget));
+    QVERIFY(texture->create());
+    std::unique_ptr<QRhiRenderBuffer> depthStencil(rhi->newRenderBuffer(QRhiRenderBuffer::DepthStencil, size, 1));
+    QVERIFY(depthStencil->create());
+    QRhiTextureRenderTargetDescription description{QRhiColorAttachment(texture.get())};
+    description.setDepthStencilBuffer(depthStencil.get());
+    std::unique_ptr<QRhiTextureRenderTarget> renderTarget(rhi->newTextureRenderTarget(description));
+    std::unique_ptr<QRhiRenderPassDescriptor> renderPass(renderTarget->newCompatibleRenderPassDescriptor());
+    renderTarget->setRenderPassDescriptor(renderPass.get());
+    QVERIFY(renderTarget->create());
+    window.setRenderTarget(QQuickRenderTarget::fromRhiRenderTarget(renderTarget.get()));
+
+    const auto renderFrame = [&]() {
+        renderControl.polishItems();
+        renderControl.beginFrame();
+        renderControl.sync();
+        renderControl.render();
+        renderControl.endFrame();
+    };
+    renderFrame();
+
+    int phase = 0;
+    QBENCHMARK {
+        scene->setProperty("phase", ++phase);
+        renderFrame();
+    }
+}
+
+QTEST_MAIN(tst_batchrenderer)
+
+#include "tst_batchrenderer.moc"
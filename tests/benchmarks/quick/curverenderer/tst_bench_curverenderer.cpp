@@ -3,8 +3,10 @@
 
 #include <qtest.h>
 #include <QPainterPath>
+#include <QThread>
 #include <QSGNode>
 #include <private/qquickshapecurverenderer_p.h>
+#include <private/qquickshapegenericrenderer_p.h>
 
 class tst_CurveRenderer : public QObject
 {
@@ -18,6 +20,9 @@ private slots:
 
     void render_data();
     void render();
+
+    void tessellate_data();
+    void tessellate();
 };
 
 tst_CurveRenderer::tst_CurveRenderer()
@@ -74,5 +79,62 @@ void tst_CurveRenderer::render()
     }
 }
 
+void tst_CurveRenderer::tessellate_data()
+{
+    QTest::addColumn<QPainterPath>("path");
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<bool>("cached");
+
+    // Many separate subpaths, like a map or a chart
+    QPainterPath circles;
+    for (int y = 0; y < 40; ++y) {
+        for (int x = 0; x < 50; ++x)
+            circles.addEllipse(QRectF(x * 16, y * 16, 12, 12));
+    }
+
+    const int idealThreadCount = QThread::idealThreadCount();
+    QTest::newRow("circles-serial") << circles << 1 << false;
+    QTest::newRow("circles-parallel") << circles << idealThreadCount << false;
+    QTest::newRow("circles-cached") << circles << 1 << true;
+}
+
+void tst_CurveRenderer::tessellate()
+{
+    QFETCH_GLOBAL(bool, hasFill);
+    QFETCH_GLOBAL(int, strokeWidth);
+    QFETCH(QPainterPath, path);
+    QFETCH(int, threadCount);
+    QFETCH(bool, cached);
+
+    const int oldThreadCount = QQuickShapeGenericRenderer::tessellationThreadCount();
+    const int oldCacheSize = QQuickShapeGenericRenderer::tessellationCacheSize();
+    QQuickShapeGenericRenderer::setTessellationThreadCount(threadCount);
+    QQuickShapeGenericRenderer::setTessellationCacheSize(cached ? 8192 : 0);
+    QQuickShapeGenericRenderer::clearTessellationCache();
+
+    const QQuickShapeGenericRenderer::Color4ub color = { 255, 255, 0, 255 };
+    QPen pen;
+    pen.setWidthF(strokeWidth);
+    QQuickShapeGenericRenderer::VertexContainerType vertices;
+    QQuickShapeGenericRenderer::IndexContainerType indices;
+    QSGGeometry::Type indexType;
+
+    QBENCHMARK {
+        if (!cached)
+            QQuickShapeGenericRenderer::clearTessellationCache();
+        if (hasFill) {
+            QQuickShapeGenericRenderer::triangulateFill(path, color, &vertices, &indices, &indexType,
+                                                        true, 1.0);
+        }
+        if (strokeWidth > 0) {
+            QQuickShapeGenericRenderer::triangulateStroke(path, pen, color, &vertices,
+                                                          QSize(800, 640), 1.0);
+        }
+    }
+
+    QQuickShapeGenericRenderer::setTessellationThreadCount(oldThreadCount);
+    QQuickShapeGenericRenderer::setTessellationCacheSize(oldCacheSize);
+}
+
 QTEST_MAIN(tst_CurveRenderer)
 #include "tst_bench_curverenderer.moc"
@@ -0,0 +1,38 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+Rectangle {
+    gradient: Gradient {
+        GradientStop { position: 0; color: "steelblue" }
+        GradientStop { position: 1; color: "lightsteelblue" }
+    }
+
+    Grid {
+        anchors.fill: parent
+        anchors.margins: 20
+        columns: 24
+        spacing: 10
+
+        Repeater {
+            model: 24 * 16
+            delegate: Rectangle {
+                required property int index
+                width: 140
+                height: 110
+                radius: 12
+                border.width: 2
+                border.color: "#40000000"
+                color: Qt.hsla((index % 24) / 24, 0.5, 0.6, 0.8)
+                rotation: index % 7 === 0 ? 5 : 0
+
+                Text {
+                    anchors.centerIn: parent
+                    text: "Item " + parent.index
+                    font.pixelSize: 18
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QtCore/qthread.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQuick/qquickitem.h>
+#include <QtQuick/qquickrendercontrol.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtQuick/private/qsgsoftwarepixmaprenderer_p.h>
+#include <QtQuickTestUtils/private/qmlutils_p.h>
+
+#include <memory>
+
+class tst_softwarerenderer : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_softwarerenderer();
+
+private slots:
+    void initTestCase() override;
+
+    void renderScene_data();
+    void renderScene();
+};
+
+tst_softwarerenderer::tst_softwarerenderer()
+    : QQmlDataTest(QT_QMLTEST_DATADIR)
+{
+}
+
+void tst_softwarerenderer::initTestCase()
+{
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Software);
+    QQmlDataTest::initTestCase();
+}
+
+void tst_softwarerenderer::renderScene_data()
+{
+    QTest::addColumn<int>("threads");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("ideal thread count") << QThread::idealThreadCount();
+}
+
+void tst_softwarerenderer::renderScene()
+{
+    // Measure how long it takes to repaint a full 4K frame, which is what
+    // painting with several threads speeds up.
+    QFETCH(int, threads);
+
+    if (QQuickWindow::sceneGraphBackend() != "software")
+        QSKIP("The software adaptation is not in use");
+
+    const QSize size(3840, 2160);
+
+    QQuickRenderControl renderControl;
+    QQuickWindow window(&renderControl);
+    window.resize(size);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("scene.qml"));
+    std::unique_ptr<QQuickItem> scene(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(scene, qPrintable(component.errorString()));
+    scene->setSize(size);
+    scene->setParentItem(window.contentItem());
+
+    renderControl.polishItems();
+    renderControl.sync();
+
+    QQuickWindowPrivate *wd = QQuickWindowPrivate::get(&window);
+    QVERIFY(wd->renderer);
+    QSGSoftwarePixmapRenderer renderer(wd->context);
+    renderer.setRootNode(wd->renderer->rootNode());
+    renderer.setRenderThreadCount(threads);
+    renderer.setDeviceRect(size);
+    renderer.setViewportRect(size);
+    renderer.setProjectionRect(QRect(QPoint(), size));
+    renderer.setClearColor(Qt::white);
+
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    renderer.renderScene();
+    renderer.render(&image);
+
+    QBENCHMARK {
+        renderer.markDirty();
+        renderer.renderScene();
+        renderer.render(&image);
+    }
+}
+
+QTEST_MAIN(tst_softwarerenderer)
+
+#include "tst_softwarerenderer.moc"
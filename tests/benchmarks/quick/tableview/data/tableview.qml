@@ -0,0 +1,21 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+TableView {
+    width: 800
+    height: 600
+    columnSpacing: 1
+    rowSpacing: 1
+    animate: false
+    delegate: Rectangle {
+        required property string display
+        implicitWidth: 80
+        implicitHeight: 20
+        Text {
+            anchors.centerIn: parent
+            text: parent.display
+        }
+    }
+}
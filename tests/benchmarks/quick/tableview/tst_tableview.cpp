@@ -0,0 +1,111 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QtCore/qabstractitemmodel.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/private/qquicktableview_p.h>
+#include <QtQuickTestUtils/private/qmlutils_p.h>
+
+class BigTableModel : public QAbstractTableModel
+{
+public:
+    BigTableModel(int rows, int columns) : m_rows(rows), m_columns(columns) {}
+
+    int rowCount(const QModelIndex & = QModelIndex()) const override { return m_rows; }
+    int columnCount(const QModelIndex & = QModelIndex()) const override { return m_columns; }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (!index.isValid() || role != Qt::DisplayRole)
+            return QVariant();
+        return QStringLiteral("%1,%2").arg(index.column()).arg(index.row());
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        return { {Qt::DisplayRole, "display"} };
+    }
+
+private:
+    int m_rows;
+    int m_columns;
+};
+
+class tst_tableview : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_tableview();
+
+private slots:
+    void jumpToCell_data();
+    void jumpToCell();
+
+private:
+    QQuickTableView *createTableView(QQuickView &window, QAbstractItemModel *model);
+};
+
+tst_tableview::tst_tableview()
+    : QQmlDataTest(QT_QMLTEST_DATADIR)
+{
+}
+
+QQuickTableView *tst_tableview::createTableView(QQuickView &window, QAbstractItemModel *model)
+{
+    window.setSource(testFileUrl("tableview.qml"));
+    auto tableView = qobject_cast<QQuickTableView *>(window.rootObject());
+    if (!tableView)
+        return nullptr;
+    tableView->setModel(QVariant::fromValue(model));
+    window.show();
+    if (!QTest::qWaitForWindowExposed(&window))
+        return nullptr;
+    return tableView;
+}
+
+void tst_tableview::jumpToCell_data()
+{
+    QTest::addColumn<int>("rows");
+    QTest::addColumn<int>("columns");
+    QTest::addColumn<int>("explicitSizes");
+
+    QTest::newRow("10^6 cells") << 1000 << 1000 << 0;
+    QTest::newRow("10^9 cells") << 100000 << 10000 << 0;
+    QTest::newRow("10^9 cells, 10^4 explicit sizes") << 100000 << 10000 << 10000;
+}
+
+void tst_tableview::jumpToCell()
+{
+    // Measure how long it takes to show a cell far away from the current
+    // one, which requires the table to be rebuilt around the new cell.
+    QFETCH(int, rows);
+    QFETCH(int, columns);
+    QFETCH(int, explicitSizes);
+
+    BigTableModel model(rows, columns);
+    QQuickView window;
+    QQuickTableView *tableView = createTableView(window, &model);
+    QVERIFY(tableView);
+
+    for (int i = 0; i < explicitSizes; ++i) {
+        tableView->setRowHeight((i * 7919) % rows, 40);
+        tableView->setColumnWidth((i * 104729) % columns, 160);
+    }
+    tableView->forceLayout();
+
+    int i = 0;
+    QBENCHMARK {
+        // Jump between cells spread over the whole table
+        ++i;
+        const QPoint cell(int((i * 2654435761u) % uint(columns)), int((i * 40503u * 40503u) % uint(rows)));
+        tableView->positionViewAtCell(cell, QQuickTableView::AlignCenter);
+        tableView->forceLayout();
+        QVERIFY(tableView->itemAtCell(cell));
+    }
+}
+
+QTEST_MAIN(tst_tableview)
+
+#include "tst_tableview.moc"